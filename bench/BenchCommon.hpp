@@ -0,0 +1,51 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <string>
+
+/**
+ * @brief Minimal timing helpers shared by the microbenchmarks.
+ *
+ * Benchmarks are plain executables printing one line per case; build with
+ * -DCMAKE_BUILD_TYPE=Release for numbers worth comparing.
+ */
+namespace bench
+{
+using Clock = std::chrono::steady_clock;
+
+/// Keeps the optimizer from discarding a result the benchmark does not use otherwise.
+template <typename T>
+inline void
+doNotOptimize(const T &value)
+{
+    asm volatile("" : : "g"(&value) : "memory");
+}
+
+inline double
+secondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double>(Clock::now() - start).count();
+}
+
+/// Runs fn() iterations times (after a short warm-up) and returns operations per second.
+template <typename Fn>
+inline double
+opsPerSecond(uint64_t iterations, Fn &&fn)
+{
+    for (uint64_t i = 0; i < iterations / 10 + 1; ++i)
+        fn();
+    const auto start = Clock::now();
+    for (uint64_t i = 0; i < iterations; ++i)
+        fn();
+    const double seconds = secondsSince(start);
+    return seconds > 0.0 ? static_cast<double>(iterations) / seconds : 0.0;
+}
+
+inline void
+report(const std::string &name, double opsPerSec, const char *unit = "ops/s")
+{
+    std::printf("%-48s %14.0f %s\n", name.c_str(), opsPerSec, unit);
+}
+} // namespace bench
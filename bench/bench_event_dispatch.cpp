@@ -0,0 +1,137 @@
+// Client packet dispatch from several IO threads: the pre-table EventDispatcher
+// shape (one dispatchMutex_ around a shared batch and a linear eventType compare
+// chain) against the current one (thread_local batch, eventType hash table).
+// Both push into a real EventQueue drained by one consumer.
+
+#include "BenchCommon.hpp"
+#include "events/EventQueue.hpp"
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+
+namespace
+{
+// EventDispatcher's eventTypes, in its original if/else order.
+const std::vector<std::string> EVENT_TYPES = {"joinGameClient", "joinGameCharacter", "moveCharacter",
+    "disconnectClient", "pingClient", "getConnectedCharacters", "playerAttack", "skillUsage", "itemPickup",
+    "getPlayerInventory", "harvestStart", "harvestCancel", "getNearbyCorpses", "corpseLootPickup",
+    "corpseLootInspect", "getCharacterExperience", "npcInteract", "dialogueChoice", "dialogueClose",
+    "openVendorShop", "openSkillShop", "requestLearnSkill", "buyItem", "sellItem", "buyItemBatch",
+    "sellItemBatch", "openRepairShop", "repairItem", "repairAll", "tradeRequest", "tradeAccept", "tradeDecline",
+    "tradeOfferUpdate", "tradeConfirm", "tradeCancel", "equipItem", "unequipItem", "getEquipment",
+    "respawnRequest", "dropItem", "useItem", "getBestiaryEntry", "getBestiaryOverview", "chatMessage",
+    "playerReady", "getTitles", "equipTitle", "setSkillBarSlot", "useEmote", "worldObjectInteract",
+    "worldObjectChannelCancel"};
+
+// Traffic mix: mostly movement, then combat, then the tail of the chain.
+const std::vector<std::string> TRAFFIC = {"moveCharacter", "moveCharacter", "moveCharacter", "moveCharacter",
+    "moveCharacter", "moveCharacter", "moveCharacter", "playerAttack", "skillUsage", "useEmote"};
+
+void
+queueEvent(std::vector<Event> &batch, int clientId, size_t typeIndex)
+{
+    MovementDataStruct movement;
+    movement.clientId = clientId;
+    movement.characterId = clientId;
+    movement.position.positionX = static_cast<float>(typeIndex);
+    batch.emplace_back(Event::MOVE_CHARACTER, clientId, movement);
+}
+
+class LockedChainDispatcher
+{
+  public:
+    explicit LockedChainDispatcher(EventQueue &queue) : queue_(queue) {}
+
+    void dispatch(const std::string &eventType, int clientId)
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (size_t i = 0; i < EVENT_TYPES.size(); ++i)
+        {
+            if (eventType == EVENT_TYPES[i])
+            {
+                queueEvent(batch_, clientId, i);
+                break;
+            }
+        }
+        queue_.pushBatch(std::move(batch_));
+        batch_.clear();
+    }
+
+  private:
+    EventQueue &queue_;
+    std::mutex mutex_;
+    std::vector<Event> batch_;
+};
+
+class TableDispatcher
+{
+  public:
+    explicit TableDispatcher(EventQueue &queue) : queue_(queue) {}
+
+    void dispatch(const std::string &eventType, int clientId)
+    {
+        static const std::unordered_map<std::string, size_t> handlers = []
+        {
+            std::unordered_map<std::string, size_t> table;
+            for (size_t i = 0; i < EVENT_TYPES.size(); ++i)
+                table.emplace(EVENT_TYPES[i], i);
+            return table;
+        }();
+        thread_local std::vector<Event> batch;
+
+        auto it = handlers.find(eventType);
+        if (it != handlers.end())
+            queueEvent(batch, clientId, it->second);
+        queue_.pushBatch(std::move(batch));
+        batch.clear();
+    }
+
+  private:
+    EventQueue &queue_;
+};
+
+template <typename Dispatcher>
+double
+run(int threads, uint64_t messagesPerThread)
+{
+    EventQueue queue(1 << 16, EventQueueBackend::RING, EventQueueOverflowPolicy::DROP_OLDEST);
+    Dispatcher dispatcher(queue);
+    std::thread consumer([&]
+        {
+            std::vector<Event> events;
+            while (queue.popBatch(events, 256))
+                events.clear(); });
+
+    const auto start = bench::Clock::now();
+    std::vector<std::thread> io;
+    for (int t = 0; t < threads; ++t)
+    {
+        io.emplace_back([&, t]
+            {
+                for (uint64_t i = 0; i < messagesPerThread; ++i)
+                    dispatcher.dispatch(TRAFFIC[i % TRAFFIC.size()], t + 1); });
+    }
+    for (auto &thread : io)
+        thread.join();
+    const double seconds = bench::secondsSince(start);
+
+    queue.stop();
+    consumer.join();
+    return static_cast<double>(messagesPerThread * static_cast<uint64_t>(threads)) / seconds;
+}
+} // namespace
+
+int
+main()
+{
+    constexpr uint64_t MESSAGES = 400000;
+    for (int threads : {1, 2, 4, 8})
+    {
+        const uint64_t perThread = MESSAGES / static_cast<uint64_t>(threads);
+        const double locked = run<LockedChainDispatcher>(threads, perThread);
+        const double table = run<TableDispatcher>(threads, perThread);
+        std::printf("%d IO thread(s)  locked chain %10.0f msg/s | table %10.0f msg/s | %.2fx\n", threads, locked,
+            table, table / locked);
+    }
+    return 0;
+}
@@ -0,0 +1,101 @@
+// EventQueue under contention: the mutex backend against the lock-free ring,
+// for a few producer/consumer mixes. Also shows the resident memory a fresh
+// 10000-event queue of each backend costs before anything is pushed.
+
+#include "BenchCommon.hpp"
+#include "events/EventQueue.hpp"
+#include <fstream>
+#include <thread>
+#include <unistd.h>
+
+namespace
+{
+size_t
+residentBytes()
+{
+    std::ifstream statm("/proc/self/statm");
+    size_t pages = 0, resident = 0;
+    statm >> pages >> resident;
+    return resident * static_cast<size_t>(sysconf(_SC_PAGESIZE));
+}
+
+const char *
+backendName(EventQueueBackend backend)
+{
+    return backend == EventQueueBackend::RING ? "ring " : "mutex";
+}
+
+void
+run(EventQueueBackend backend, int producers, int consumers, uint64_t eventsPerProducer)
+{
+    EventQueue queue(10000, backend, EventQueueOverflowPolicy::DROP_OLDEST);
+    const uint64_t total = eventsPerProducer * static_cast<uint64_t>(producers);
+    std::atomic<uint64_t> consumed{0};
+
+    std::vector<std::thread> consumerThreads;
+    for (int c = 0; c < consumers; ++c)
+    {
+        consumerThreads.emplace_back([&]
+            {
+                std::vector<Event> batch;
+                while (queue.popBatch(batch, 64))
+                {
+                    consumed.fetch_add(batch.size(), std::memory_order_relaxed);
+                    batch.clear();
+                } });
+    }
+
+    const auto start = bench::Clock::now();
+    std::vector<std::thread> producerThreads;
+    for (int p = 0; p < producers; ++p)
+    {
+        producerThreads.emplace_back([&, p]
+            {
+                MovementDataStruct movement;
+                movement.clientId = p + 1;
+                movement.characterId = p + 1;
+                for (uint64_t i = 0; i < eventsPerProducer; ++i)
+                {
+                    movement.position.positionX = static_cast<float>(i);
+                    queue.push(Event(Event::MOVE_CHARACTER, p + 1, movement));
+                } });
+    }
+    for (auto &t : producerThreads)
+        t.join();
+
+    uint64_t dropped = 0;
+    while (consumed.load(std::memory_order_relaxed) + dropped < total)
+    {
+        dropped += queue.getDroppedCount();
+        std::this_thread::yield();
+    }
+    const double seconds = bench::secondsSince(start);
+    queue.stop();
+    for (auto &t : consumerThreads)
+        t.join();
+
+    std::printf("%s %dP/%dC %12.0f events/s  dropped %llu\n", backendName(backend), producers, consumers,
+        static_cast<double>(total) / seconds, static_cast<unsigned long long>(dropped));
+}
+} // namespace
+
+int
+main()
+{
+    std::printf("sizeof(Event) = %zu B\n", sizeof(Event));
+    for (EventQueueBackend backend : {EventQueueBackend::MUTEX, EventQueueBackend::RING})
+    {
+        const size_t before = residentBytes();
+        EventQueue idle(10000, backend);
+        std::printf("%s idle queue resident: %.1f KiB\n", backendName(backend), (residentBytes() - before) / 1024.0);
+    }
+
+    constexpr uint64_t EVENTS = 400000;
+    const int mixes[][2] = {{1, 1}, {4, 1}, {4, 4}};
+    for (const auto &mix : mixes)
+    {
+        for (EventQueueBackend backend : {EventQueueBackend::MUTEX, EventQueueBackend::RING})
+            run(backend, mix[0], mix[1], EVENTS / static_cast<uint64_t>(mix[0]));
+    }
+    return 0;
+}
@@ -0,0 +1,235 @@
+// Outbound JSON: the nlohmann DOM path (ResponseBuilder + generateResponseMessage's
+// copy-into-a-second-DOM-and-dump) against the streaming JsonPackets writers.
+// Reports packets/s, output MB/s and heap allocations per packet.
+
+#include "BenchCommon.hpp"
+#include "network/JsonWriter.hpp"
+#include "utils/ResponseBuilder.hpp"
+#include "utils/TimestampUtils.hpp"
+#include <atomic>
+#include <cstdlib>
+#include <functional>
+#include <new>
+
+namespace
+{
+std::atomic<uint64_t> g_allocations{0};
+} // namespace
+
+// GCC sees the std::free() below paired with a replaced operator new and
+// flags it; both sides of every pair here are malloc/free, so it is noise.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *
+operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// The array forms too, so every new/delete pair goes through the same heap.
+void *
+operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void
+operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace
+{
+/// The pre-streaming NetworkManager::generateResponseMessage.
+std::string
+domEnvelope(const std::string &status, const nlohmann::json &message, const TimestampStruct *timestamps)
+{
+    nlohmann::json response;
+    response["header"] = message["header"];
+    response["header"]["status"] = status;
+    response["header"]["timestamp"] = TimestampUtils::getCurrentTimestamp();
+    response["header"]["version"] = "1.0";
+    if (timestamps)
+    {
+        TimestampStruct finalTimestamps = *timestamps;
+        TimestampUtils::setServerSendTimestamp(finalTimestamps);
+        TimestampUtils::addTimestampsToHeader(response, finalTimestamps);
+    }
+    response["body"] = message["body"];
+    return response.dump() + "\n";
+}
+
+nlohmann::json
+domPosition(const PositionStruct &p)
+{
+    return {{"x", p.positionX}, {"y", p.positionY}, {"z", p.positionZ}, {"rotationZ", p.rotationZ}};
+}
+
+struct PathResult
+{
+    double packetsPerSec = 0.0;
+    double bytesPerSec = 0.0;
+    double allocationsPerPacket = 0.0;
+};
+
+PathResult
+measure(uint64_t iterations, const std::function<std::string()> &encode)
+{
+    size_t bytes = encode().size();
+    const uint64_t allocationsBefore = g_allocations.load(std::memory_order_relaxed);
+    const auto start = bench::Clock::now();
+    for (uint64_t i = 0; i < iterations; ++i)
+        bench::doNotOptimize(encode());
+    const double seconds = bench::secondsSince(start);
+    const uint64_t allocations = g_allocations.load(std::memory_order_relaxed) - allocationsBefore;
+
+    PathResult r;
+    r.packetsPerSec = static_cast<double>(iterations) / seconds;
+    r.bytesPerSec = r.packetsPerSec * static_cast<double>(bytes);
+    r.allocationsPerPacket = static_cast<double>(allocations) / static_cast<double>(iterations);
+    return r;
+}
+
+void
+compare(const std::string &name, uint64_t iterations, const std::function<std::string()> &dom,
+    const std::function<std::string()> &stream)
+{
+    const PathResult d = measure(iterations, dom);
+    const PathResult s = measure(iterations, stream);
+    std::printf("%s\n", name.c_str());
+    std::printf("  dom    %10.0f pkt/s %8.1f MB/s %7.1f allocs/pkt\n", d.packetsPerSec, d.bytesPerSec / 1e6, d.allocationsPerPacket);
+    std::printf("  stream %10.0f pkt/s %8.1f MB/s %7.1f allocs/pkt\n", s.packetsPerSec, s.bytesPerSec / 1e6, s.allocationsPerPacket);
+}
+} // namespace
+
+int
+main()
+{
+    constexpr uint64_t ITERATIONS = 50000;
+
+    MovementDataStruct movement;
+    movement.clientId = 42;
+    movement.characterId = 7;
+    movement.position = {143.5f, 88.2f, 0.0f, 1.57f};
+    TimestampStruct timestamps;
+    timestamps.serverRecvMs = 1760000000000LL;
+    timestamps.clientSendMsEcho = 1759999999950LL;
+    timestamps.requestId = "sync_1760000000000_1_42_ab12";
+
+    compare("characterMoved", ITERATIONS,
+        [&]
+        {
+            nlohmann::json message = ResponseBuilder()
+                                         .setHeader("message", "Movement success for character!")
+                                         .setHeader("hash", "")
+                                         .setHeader("clientId", movement.clientId)
+                                         .setHeader("eventType", "moveCharacter")
+                                         .setTimestamps(timestamps)
+                                         .setBody("character", nlohmann::json{{"id", movement.characterId},
+                                                                   {"position", domPosition(movement.position)},
+                                                                   {"isFalling", movement.isFalling}})
+                                         .build();
+            return domEnvelope("success", message, &timestamps);
+        },
+        [&]
+        { return JsonPackets::encodeCharacterMoved(movement.clientId, movement, timestamps); });
+
+    // One client's view of a 30-mob tick. The stream path serializes the tick once
+    // (shared by every client) and assembles per client; shown per client with the
+    // tick encode amortized over 20 recipients.
+    constexpr size_t MOBS = 30;
+    constexpr size_t CLIENTS_PER_TICK = 20;
+    std::vector<MobMoveUpdateStruct> mobs(MOBS);
+    for (size_t i = 0; i < mobs.size(); ++i)
+    {
+        auto &mob = mobs[i];
+        mob.uid = 1000 + static_cast<int>(i);
+        mob.zoneId = 3;
+        mob.position = {100.0f + i * 13.7f, -250.0f + i * 7.1f, 0.0f, 0.3f * i};
+        mob.dirX = 0.6f;
+        mob.dirY = -0.8f;
+        mob.speed = 180.0f;
+        mob.combatState = 1;
+        mob.stepTimestampMs = 1760000000000LL;
+    }
+    std::vector<uint32_t> indices(MOBS);
+    for (uint32_t i = 0; i < indices.size(); ++i)
+        indices[i] = i;
+
+    size_t tickClient = 0;
+    std::shared_ptr<const MobMoveFragmentsStruct> fragments;
+    compare("mobMoveUpdate (30 mobs, per client)", ITERATIONS / 10,
+        [&]
+        {
+            nlohmann::json mobsJson = nlohmann::json::array();
+            for (const auto &mob : mobs)
+            {
+                mobsJson.push_back({{"uid", mob.uid},
+                    {"zoneId", mob.zoneId},
+                    {"position", domPosition(mob.position)},
+                    {"velocity", {{"dirX", mob.dirX}, {"dirY", mob.dirY}, {"speed", mob.speed}}},
+                    {"combatState", mob.combatState},
+                    {"stepTimestampMs", mob.stepTimestampMs}});
+            }
+            nlohmann::json message = ResponseBuilder()
+                                         .setHeader("message", "Mob movement update")
+                                         .setHeader("hash", "")
+                                         .setHeader("clientId", 42)
+                                         .setHeader("eventType", "mobMoveUpdate")
+                                         .setBody("mobs", mobsJson)
+                                         .build();
+            return domEnvelope("success", message, nullptr);
+        },
+        [&]
+        {
+            if (tickClient++ % CLIENTS_PER_TICK == 0)
+                fragments = JsonPackets::encodeMobMoveFragments(mobs, false);
+            return JsonPackets::assembleMobMoveUpdate(42, *fragments, indices);
+        });
+
+    // Cold packets still start from a ResponseBuilder DOM; only the envelope copy and dump change.
+    const nlohmann::json statsMessage = ResponseBuilder()
+                                            .setHeader("message", "success")
+                                            .setHeader("eventType", "stats_update")
+                                            .setHeader("clientId", 42)
+                                            .setBody("characterId", 7)
+                                            .setBody("health", nlohmann::json{{"current", 870}, {"max", 1000}})
+                                            .setBody("mana", nlohmann::json{{"current", 310}, {"max", 400}})
+                                            .setBody("source", "regen")
+                                            .build();
+    compare("stats_update (envelope only, DOM body)", ITERATIONS,
+        [&]
+        { return domEnvelope("success", statsMessage, nullptr); },
+        [&]
+        { return JsonPackets::encodeResponse("success", statsMessage); });
+    return 0;
+}
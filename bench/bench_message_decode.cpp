@@ -0,0 +1,56 @@
+// Inbound packet decoding: the old per-field re-parse path against parse-once.
+//
+// before: ClientSession parses the packet, then MessageHandler re-parsed the raw
+//         string once per envelope field (event type, client, character,
+//         position, message, timestamps, request id) - 8 parses per packet.
+// after:  one nlohmann::json::parse, then every field is read from that document.
+
+#include "BenchCommon.hpp"
+#include "handlers/MessageHandler.hpp"
+#include "utils/JSONParser.hpp"
+#include <nlohmann/json.hpp>
+
+int
+main()
+{
+    const std::string moveCharacter =
+        R"({"header":{"eventType":"moveCharacter","clientId":42,"hash":"abc123","clientSendMs":1760000000000,)"
+        R"("requestId":"req-1"},"body":{"characterId":7,"posX":143.5,"posY":88.2,"posZ":0.0,"rotZ":1.57}})";
+
+    JSONParser jsonParser;
+    MessageHandler messageHandler(jsonParser);
+    constexpr uint64_t ITERATIONS = 200000;
+
+    const double before = bench::opsPerSecond(ITERATIONS, [&]
+        {
+            const char *data = moveCharacter.data();
+            const size_t length = moveCharacter.size();
+            auto document = nlohmann::json::parse(data, data + length);
+            bench::doNotOptimize(document);
+            auto eventType = jsonParser.parseEventType(data, length);
+            auto clientData = jsonParser.parseClientData(data, length);
+            auto characterData = jsonParser.parseCharacterData(data, length);
+            auto positionData = jsonParser.parsePositionData(data, length);
+            auto messageData = jsonParser.parseMessage(data, length);
+            auto timestamps = jsonParser.parseTimestamps(data, length);
+            auto requestId = jsonParser.parseRequestId(data, length);
+            bench::doNotOptimize(eventType);
+            bench::doNotOptimize(clientData);
+            bench::doNotOptimize(characterData);
+            bench::doNotOptimize(positionData);
+            bench::doNotOptimize(messageData);
+            bench::doNotOptimize(timestamps);
+            bench::doNotOptimize(requestId); });
+
+    const double after = bench::opsPerSecond(ITERATIONS, [&]
+        {
+            auto document = nlohmann::json::parse(moveCharacter.data(), moveCharacter.data() + moveCharacter.size());
+            auto decoded = messageHandler.parseMessageWithTimestamps(document);
+            bench::doNotOptimize(decoded); });
+
+    std::printf("moveCharacter packet, %zu bytes\n", moveCharacter.size());
+    bench::report("before: parse + 7 per-field re-parses", before, "packets/s");
+    bench::report("after:  parse once + decode from document", after, "packets/s");
+    std::printf("speedup: %.2fx\n", before > 0.0 ? after / before : 0.0);
+    return 0;
+}
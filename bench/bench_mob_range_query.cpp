@@ -0,0 +1,107 @@
+// Mob range queries at 1k/10k/50k mobs: the pre-grid full scan of the mob map
+// (sqrt per mob, full MobDataStruct copy per hit) against the SpatialHashGrid
+// lookup MobInstanceManager::getMobsInRange uses now.
+
+#include "BenchCommon.hpp"
+#include "data/DataStructs.hpp"
+#include "services/MobInstanceManager.hpp"
+#include "utils/SpatialHashGrid.hpp"
+#include <cmath>
+#include <random>
+#include <unordered_map>
+
+namespace
+{
+constexpr float WORLD_SIZE = 40000.0f;
+constexpr float GRID_CELL_SIZE = 1000.0f; // MobInstanceManager's grid
+
+std::vector<MobRangeHit>
+scanQuery(const std::unordered_map<int, MobDataStruct> &mobs, float centerX, float centerY, float radius)
+{
+    std::vector<MobDataStruct> copies;
+    for (const auto &[uid, mob] : mobs)
+    {
+        if (mob.isDead)
+            continue;
+        const float dx = mob.position.positionX - centerX;
+        const float dy = mob.position.positionY - centerY;
+        if (std::sqrt(dx * dx + dy * dy) <= radius)
+            copies.push_back(mob);
+    }
+    std::vector<MobRangeHit> hits;
+    hits.reserve(copies.size());
+    for (const auto &mob : copies)
+        hits.push_back({mob.uid, mob.zoneId, mob.position, 0.0f});
+    return hits;
+}
+
+std::vector<MobRangeHit>
+gridQuery(const SpatialHashGrid &grid, const std::unordered_map<int, MobDataStruct> &mobs, float centerX,
+    float centerY, float radius)
+{
+    std::vector<MobRangeHit> hits;
+    grid.forEachInRange(centerX, centerY, radius, [&](int uid, float, float, float distSq)
+        {
+            auto it = mobs.find(uid);
+            if (it == mobs.end() || it->second.isDead)
+                return;
+            hits.push_back({uid, it->second.zoneId, it->second.position, distSq});
+        });
+    return hits;
+}
+
+void
+run(size_t mobCount, float radius)
+{
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> coord(-WORLD_SIZE / 2, WORLD_SIZE / 2);
+
+    std::unordered_map<int, MobDataStruct> mobs;
+    SpatialHashGrid grid(GRID_CELL_SIZE);
+    for (size_t i = 0; i < mobCount; ++i)
+    {
+        MobDataStruct mob;
+        mob.uid = static_cast<int>(i) + 1;
+        mob.zoneId = 1;
+        mob.name = "Forest Wolf";
+        mob.slug = "forest_wolf";
+        mob.position = {coord(rng), coord(rng), 0.0f, 0.0f};
+        grid.update(mob.uid, mob.position.positionX, mob.position.positionY);
+        mobs.emplace(mob.uid, std::move(mob));
+    }
+
+    std::vector<std::pair<float, float>> centers(256);
+    for (auto &c : centers)
+        c = {coord(rng), coord(rng)};
+
+    const uint64_t iterations = std::max<uint64_t>(200, 2000000 / mobCount);
+    size_t hits = 0;
+    size_t next = 0;
+    const double scanRate = bench::opsPerSecond(iterations, [&]
+        {
+            const auto &c = centers[next++ % centers.size()];
+            hits += scanQuery(mobs, c.first, c.second, radius).size();
+        });
+    next = 0;
+    const double gridRate = bench::opsPerSecond(iterations, [&]
+        {
+            const auto &c = centers[next++ % centers.size()];
+            hits += gridQuery(grid, mobs, c.first, c.second, radius).size();
+        });
+    bench::doNotOptimize(hits);
+
+    std::printf("%6zu mobs r=%5.0f  scan %10.0f q/s | grid %10.0f q/s | %.1fx\n", mobCount, radius, scanRate,
+        gridRate, gridRate / scanRate);
+}
+} // namespace
+
+int
+main()
+{
+    for (size_t mobCount : {1000, 10000, 50000})
+    {
+        for (float radius : {500.0f, 1500.0f})
+            run(mobCount, radius);
+    }
+    return 0;
+}
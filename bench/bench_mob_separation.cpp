@@ -0,0 +1,235 @@
+// Mob separation while 500 mobs chase one player: the pre-grid scan of every
+// other mob per candidate step against the NeighborGrid broad phase
+// MobMovementManager builds once per zone tick. Also counts heap allocations
+// per grid rebuild once the grid has grown to the pack's size.
+
+#include "BenchCommon.hpp"
+#include "utils/NeighborGrid.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <new>
+#include <random>
+
+namespace
+{
+std::atomic<uint64_t> g_allocations{0};
+} // namespace
+
+// GCC sees the std::free() below paired with a replaced operator new and
+// flags it; both sides of every pair here are malloc/free, so it is noise.
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+void *
+operator new(std::size_t size)
+{
+    g_allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void
+operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+// The array forms too, so every new/delete pair goes through the same heap.
+void *
+operator new[](std::size_t size)
+{
+    return ::operator new(size);
+}
+
+void
+operator delete[](void *p) noexcept
+{
+    std::free(p);
+}
+
+void
+operator delete[](void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+namespace
+{
+constexpr size_t MOBS = 500;
+constexpr float MIN_SEPARATION = 140.0f;  // MobMovementParams::minSeparationDistance
+constexpr float STEERING_RADIUS = 300.0f; // MobAIConfig::separationRadius
+constexpr float STEP = 40.0f;             // chase step per tick
+constexpr int CANDIDATES = 5;             // calculateNewPosition's direction fan
+
+struct Mob
+{
+    int uid;
+    float x;
+    float y;
+};
+
+/// The pre-grid isValidPositionForChase: every other mob of the tick's position
+/// snapshot, early exit on the first hit.
+bool
+scanAnyWithin(const std::vector<Mob> &mobs, float x, float y, float radius, int excludeId)
+{
+    const float radiusSq = radius * radius;
+    for (const auto &other : mobs)
+    {
+        if (other.uid == excludeId)
+            continue;
+        const float dx = x - other.x;
+        const float dy = y - other.y;
+        if (dx * dx + dy * dy < radiusSq)
+            return true;
+    }
+    return false;
+}
+
+/// One zone tick: each mob steers away from its neighbours, then tries a fan of
+/// candidate steps toward the player until one keeps its separation.
+template <typename AnyWithin, typename Steer>
+size_t
+chaseTick(std::vector<Mob> &mobs, AnyWithin &&anyWithin, Steer &&steer)
+{
+    size_t moved = 0;
+    for (auto &mob : mobs)
+    {
+        float dx = -mob.x;
+        float dy = -mob.y;
+        const float dist = std::sqrt(dx * dx + dy * dy);
+        if (dist < MIN_SEPARATION)
+            continue;
+        dx /= dist;
+        dy /= dist;
+
+        float pushX = 0.0f, pushY = 0.0f;
+        steer(mob, pushX, pushY);
+        dx += pushX * 0.3f;
+        dy += pushY * 0.3f;
+
+        for (int c = 0; c < CANDIDATES; ++c)
+        {
+            const float angle = (c - CANDIDATES / 2) * 0.4f;
+            const float cs = std::cos(angle), sn = std::sin(angle);
+            const float nx = mob.x + (dx * cs - dy * sn) * STEP;
+            const float ny = mob.y + (dx * sn + dy * cs) * STEP;
+            if (!anyWithin(nx, ny, mob.uid))
+            {
+                mob.x = nx;
+                mob.y = ny;
+                ++moved;
+                break;
+            }
+        }
+    }
+    return moved;
+}
+
+std::vector<Mob>
+spawnPack()
+{
+    // The pack starts spread around the player and converges on it tick by tick.
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> angle(0.0f, 6.2831853f);
+    std::uniform_real_distribution<float> radius(300.0f, 3000.0f);
+    std::vector<Mob> mobs(MOBS);
+    for (size_t i = 0; i < mobs.size(); ++i)
+    {
+        const float a = angle(rng), r = radius(rng);
+        mobs[i] = {static_cast<int>(i) + 1, std::cos(a) * r, std::sin(a) * r};
+    }
+    return mobs;
+}
+} // namespace
+
+int
+main()
+{
+    constexpr int TICKS = 200;
+
+    // Both paths test against a position snapshot taken at the start of the tick,
+    // as moveMobsInZone does.
+    std::vector<Mob> scanMobs = spawnPack();
+    std::vector<Mob> snapshot;
+    size_t scanMoved = 0;
+    const double scanRate = bench::opsPerSecond(TICKS, [&]
+        {
+            snapshot = scanMobs;
+            scanMoved += chaseTick(scanMobs,
+                [&](float x, float y, int uid)
+                { return scanAnyWithin(snapshot, x, y, MIN_SEPARATION, uid); },
+                [&](const Mob &mob, float &pushX, float &pushY)
+                {
+                    for (const auto &other : snapshot)
+                    {
+                        const float dx = mob.x - other.x, dy = mob.y - other.y;
+                        const float distSq = dx * dx + dy * dy;
+                        if (other.uid != mob.uid && distSq < STEERING_RADIUS * STEERING_RADIUS && distSq > 0.0f)
+                        {
+                            pushX += dx / distSq;
+                            pushY += dy / distSq;
+                        }
+                    }
+                });
+        });
+
+    std::vector<Mob> gridMobs = spawnPack();
+    NeighborGrid grid;
+    size_t gridMoved = 0;
+    uint64_t steadyAllocations = 0;
+    uint64_t steadyRebuilds = 0;
+    int tick = 0;
+    const double gridRate = bench::opsPerSecond(TICKS, [&]
+        {
+            const uint64_t before = g_allocations.load(std::memory_order_relaxed);
+            grid.reset(std::max(STEERING_RADIUS, MIN_SEPARATION));
+            for (const auto &mob : gridMobs)
+                grid.add(mob.uid, mob.x, mob.y);
+            grid.finalize();
+            if (tick++ > 0)
+            {
+                steadyAllocations += g_allocations.load(std::memory_order_relaxed) - before;
+                ++steadyRebuilds;
+            }
+
+            gridMoved += chaseTick(gridMobs,
+                [&](float x, float y, int uid)
+                { return grid.anyWithin(x, y, MIN_SEPARATION, uid); },
+                [&](const Mob &mob, float &pushX, float &pushY)
+                {
+                    grid.forEachWithin(mob.x, mob.y, STEERING_RADIUS, mob.uid, [&](int, float dx, float dy, float distSq)
+                        {
+                            if (distSq > 0.0f)
+                            {
+                                pushX += dx / distSq;
+                                pushY += dy / distSq;
+                            }
+                        });
+                });
+        });
+    bench::doNotOptimize(scanMoved);
+    bench::doNotOptimize(gridMoved);
+
+    std::printf("%zu mobs chasing one player\n", MOBS);
+    std::printf("  scan %10.0f ticks/s\n", scanRate);
+    std::printf("  grid %10.0f ticks/s | %.1fx\n", gridRate, gridRate / scanRate);
+    std::printf("  grid rebuild allocations after the first tick: %.2f per rebuild\n",
+        steadyRebuilds ? static_cast<double>(steadyAllocations) / static_cast<double>(steadyRebuilds) : 0.0);
+    return 0;
+}
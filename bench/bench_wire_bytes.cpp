@@ -0,0 +1,127 @@
+// Bytes per packet and encode rate: JSON wire against the BinaryCodec framing,
+// for the hot packets that have a binary layout.
+
+#include "BenchCommon.hpp"
+#include "network/BinaryCodec.hpp"
+#include "network/JsonWriter.hpp"
+#include <functional>
+#include <nlohmann/json.hpp>
+
+namespace
+{
+struct WireCase
+{
+    std::string name;
+    std::function<std::string()> json;
+    std::function<std::string()> binary;
+};
+
+void
+run(const WireCase &c, uint64_t iterations)
+{
+    const size_t jsonBytes = c.json().size();
+    const size_t binaryBytes = c.binary().size();
+    const double jsonRate = bench::opsPerSecond(iterations, [&]
+        { bench::doNotOptimize(c.json()); });
+    const double binaryRate = bench::opsPerSecond(iterations, [&]
+        { bench::doNotOptimize(c.binary()); });
+
+    std::printf("%-28s json %6zu B %10.0f pkt/s | binary %6zu B %10.0f pkt/s | %.1fx smaller\n",
+        c.name.c_str(), jsonBytes, jsonRate, binaryBytes, binaryRate,
+        binaryBytes ? static_cast<double>(jsonBytes) / binaryBytes : 0.0);
+}
+
+nlohmann::json
+responseMessage(const std::string &eventType, nlohmann::json body)
+{
+    nlohmann::json message;
+    message["header"] = {{"eventType", eventType}, {"clientId", 42}, {"hash", ""}, {"message", "success"}};
+    message["body"] = std::move(body);
+    return message;
+}
+} // namespace
+
+int
+main()
+{
+    constexpr uint64_t ITERATIONS = 100000;
+
+    MovementDataStruct movement;
+    movement.clientId = 42;
+    movement.characterId = 7;
+    movement.position = {143.5f, 88.2f, 0.0f, 1.57f};
+    TimestampStruct timestamps;
+    timestamps.serverRecvMs = 1760000000000LL;
+    timestamps.clientSendMsEcho = 1759999999950LL;
+    timestamps.requestId = "sync_1760000000000_1_42_ab12";
+
+    std::vector<MobMoveUpdateStruct> mobs(50);
+    for (size_t i = 0; i < mobs.size(); ++i)
+    {
+        auto &mob = mobs[i];
+        mob.uid = 1000 + static_cast<int>(i);
+        mob.zoneId = 3;
+        mob.position = {100.0f + i * 13.7f, -250.0f + i * 7.1f, 0.0f, 0.3f * i};
+        mob.dirX = 0.6f;
+        mob.dirY = -0.8f;
+        mob.speed = 180.0f;
+        mob.combatState = 1;
+        mob.stepTimestampMs = 1760000000000LL;
+        mob.hasWaypoint = i % 2 == 0;
+        mob.waypointX = mob.position.positionX + 200.0f;
+        mob.waypointY = mob.position.positionY - 120.0f;
+    }
+    std::vector<uint32_t> allMobs(mobs.size());
+    for (uint32_t i = 0; i < allMobs.size(); ++i)
+        allMobs[i] = i;
+
+    const nlohmann::json combatResult = responseMessage("combatResult",
+        {{"skillResult", {{"success", true}, {"casterId", 7}, {"targetId", 1200}, {"casterType", 1}, {"targetType", 2},
+                             {"isCritical", true}, {"isBlocked", false}, {"isMissed", false}, {"targetDied", false},
+                             {"damage", 345}, {"finalTargetHealth", 655}, {"finalTargetMana", 0}, {"finalCasterMana", 80},
+                             {"serverTimestamp", 1760000000000LL}, {"skillSlug", "fireball"}}}});
+    const nlohmann::json vitals = responseMessage("stats_update",
+        {{"source", "regen"}, {"characterId", 7}, {"health", {{"current", 870}, {"max", 1000}}},
+            {"mana", {{"current", 310}, {"max", 400}}}});
+
+    const std::vector<WireCase> cases = {
+        {"moveCharacter (client->srv)",
+            [&]
+            {
+                nlohmann::json message;
+                message["header"] = {{"eventType", "moveCharacter"}, {"clientId", 42}, {"hash", "abc123"},
+                    {"clientSendMs", timestamps.clientSendMsEcho}, {"requestId", timestamps.requestId}};
+                message["body"] = {{"characterId", 7}, {"posX", 143.5}, {"posY", 88.2}, {"posZ", 0.0}, {"rotZ", 1.57}};
+                return message.dump() + "\n";
+            },
+            [&]
+            { return BinaryCodec::encodeMoveCharacter(movement, timestamps.clientSendMsEcho); }},
+        {"characterMoved broadcast",
+            [&]
+            { return JsonPackets::encodeCharacterMoved(42, movement, timestamps); },
+            [&]
+            { return BinaryCodec::encodeCharacterMoved(42, movement, timestamps); }},
+        {"mobMoveUpdate (50 mobs)",
+            [&]
+            {
+                auto fragments = JsonPackets::encodeMobMoveFragments(mobs, false);
+                return JsonPackets::assembleMobMoveUpdate(42, *fragments, allMobs);
+            },
+            [&]
+            { return BinaryCodec::encodeMobMoveUpdate(mobs, timestamps.serverRecvMs); }},
+        {"combatResult",
+            [&]
+            { return JsonPackets::encodeResponse("success", combatResult); },
+            [&]
+            { return *BinaryCodec::encodeFromJson(combatResult); }},
+        {"stats_update (regen)",
+            [&]
+            { return JsonPackets::encodeResponse("success", vitals); },
+            [&]
+            { return *BinaryCodec::encodeFromJson(vitals); }},
+    };
+
+    for (const auto &c : cases)
+        run(c, ITERATIONS);
+    return 0;
+}
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "chunk_server/WorldTickPipeline.hpp"
 #include "events/Event.hpp"
 #include "events/EventHandler.hpp"
 #include "events/EventQueue.hpp"
@@ -8,9 +9,13 @@
 #include "services/CharacterManager.hpp"
 #include "services/MobManager.hpp"
 #include "services/SpawnZoneManager.hpp"
+#include "utils/ForkJoinPool.hpp"
+#include "utils/LaneExecutor.hpp"
 #include "utils/Logger.hpp"
 #include "utils/Scheduler.hpp"
 #include "utils/ThreadPool.hpp"
+#include "utils/TimerQueue.hpp"
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <chrono>
@@ -64,13 +69,39 @@ class ChunkServer
     std::mutex eventMutex;
     std::condition_variable eventCondition;
 
+    // Pings only: stateless, and must not wait behind a busy entity lane.
     ThreadPool threadPool_{std::thread::hardware_concurrency()};
 
+    // Per-zone mob simulation inside the tick; the tick thread itself is one of the workers.
+    // Declared before tickPipeline_ so it outlives the tick thread.
+    ForkJoinPool zoneWorkers_{std::max(1u, std::thread::hardware_concurrency()) - 1};
+
+    // World simulation (mobs, combat, effects, regen, ...) at a fixed 50 ms step
+    WorldTickPipeline tickPipeline_{50};
+
+    // Cast completion and DoT/HoT/effect-expiry deadlines, fired at millisecond precision
+    TimerQueue combatTimers_;
+
+    // Game events: serial per entity (client/character/mob), parallel across entities.
+    LaneExecutor eventLanes_{std::thread::hardware_concurrency()};
+
     GameServices &gameServices_;
     std::shared_ptr<spdlog::logger> log_;
     NetworkManager &networkManager_;
     GameServerWorker &gameServerWorker_;
 
+    // Log per-lane depth/latency counters accumulated since the previous call
+    void logLaneStats();
+
+    // Log tick duration/overrun and per-step counters since the previous call
+    void logTickStats();
+
+    // Log combat timer fire latency (scheduled vs actual) since the previous call
+    void logTimerStats();
+
+    // Log socket write coalescing (packets per flush, bytes per syscall) since the previous call
+    void logWriteStats();
+
     // Helper method for sending spawn events to all clients
     void sendSpawnEventsToClients(const SpawnZoneStruct &zone);
 };
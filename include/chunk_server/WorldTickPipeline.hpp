@@ -0,0 +1,136 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+/// Phases run in this order inside every world tick.
+enum class TickPhase
+{
+    INPUT,      ///< tick start: capture shared snapshots
+    AI,         ///< decisions (aggro, targets)
+    MOVEMENT,   ///< mob movement
+    COMBAT,     ///< combat work (cast completion itself fires on ChunkServer::combatTimers_)
+    EFFECTS,    ///< regen, timed systems (DoT/HoT ticks fire on ChunkServer::combatTimers_)
+    REPLICATION ///< outbound world updates
+};
+
+/**
+ * @brief State shared by all phases of one tick.
+ *
+ * Snapshots are taken once in the INPUT phase and reused by later phases
+ * instead of each system re-querying its manager.
+ */
+struct TickContext
+{
+    uint64_t tickIndex = 0;
+    int64_t nowMs = 0;    ///< wall clock (ms since epoch), for packet timestamps
+    float deltaSec = 0.0f; ///< fixed step
+    std::map<int, SpawnZoneStruct> spawnZones;
+    std::vector<int> activeZoneIds; ///< zones with live mobs, filled by the movement step
+    std::vector<int> dormantZoneIds; ///< sorted subset of activeZoneIds with no player nearby (AI LOD)
+};
+
+/// Per-phase counters since the previous collectStats().
+struct TickPhaseStats
+{
+    std::string name;
+    uint64_t runs = 0;
+    uint64_t deferred = 0; ///< times skipped under load
+    uint64_t failed = 0;   ///< runs that threw
+    double avgMs = 0.0;
+    double maxMs = 0.0;
+};
+
+struct TickPipelineStats
+{
+    uint64_t ticks = 0;
+    uint64_t overruns = 0;     ///< ticks longer than the step
+    uint64_t droppedTicks = 0; ///< ticks abandoned when too far behind
+    double avgTickMs = 0.0;
+    double maxTickMs = 0.0;
+    std::vector<TickPhaseStats> phases;
+};
+
+/**
+ * @brief Fixed-timestep world simulation loop with ordered phases.
+ *
+ * Runs on its own thread so housekeeping tasks on the Scheduler can no longer
+ * delay the simulation. Each registered step runs every `periodTicks` ticks in
+ * phase order. When the previous tick overran the step, non-critical steps are
+ * deferred (at most MAX_DEFER_TICKS in a row) so critical phases keep cadence.
+ * When the loop falls more than MAX_CATCH_UP_TICKS behind it drops the backlog
+ * instead of bursting. A step that throws is logged (step name and what())
+ * and counted as failed; the tick carries on with the next step.
+ */
+class WorldTickPipeline
+{
+  public:
+    using StepFn = std::function<void(TickContext &)>;
+
+    explicit WorldTickPipeline(int tickMs = 50);
+    ~WorldTickPipeline();
+
+    /// Register before start(). Steps within one phase run in registration order.
+    /// @param initialDelayTicks first run is postponed by this many ticks
+    void addStep(TickPhase phase, const std::string &name, int periodTicks, bool critical, StepFn fn, int initialDelayTicks = 0);
+
+    void start();
+    void stop();
+
+    int getTickMs() const
+    {
+        return tickMs_;
+    }
+
+    TickPipelineStats collectStats();
+
+  private:
+    static constexpr uint64_t MAX_CATCH_UP_TICKS = 5;
+    static constexpr uint64_t MAX_DEFER_TICKS = 20;
+    /// A step failing every tick logs its first failure, then one line per this many.
+    static constexpr uint64_t FAILURE_LOG_EVERY = 200;
+
+    struct Step
+    {
+        TickPhase phase;
+        std::string name;
+        uint64_t periodTicks;
+        bool critical;
+        StepFn fn;
+
+        uint64_t nextDueTick = 0;
+        uint64_t deferredInRow = 0;
+
+        uint64_t failedInRow = 0; ///< consecutive failing runs, for log throttling
+
+        uint64_t runs = 0;
+        uint64_t deferred = 0;
+        uint64_t failed = 0;
+        double sumMs = 0.0;
+        double maxMs = 0.0;
+    };
+
+    void run();
+    void runTick(uint64_t tickIndex, bool degraded);
+
+    int tickMs_;
+    std::vector<Step> steps_;
+    std::thread thread_;
+    std::atomic<bool> running_{false};
+
+    // Tick counters; guarded by statsMutex_ (steps_ counters too)
+    std::mutex statsMutex_;
+    uint64_t ticks_ = 0;
+    uint64_t overruns_ = 0;
+    uint64_t droppedTicks_ = 0;
+    double tickSumMs_ = 0.0;
+    double tickMaxMs_ = 0.0;
+};
@@ -1,9 +1,12 @@
 #pragma once
 #include "utils/JsonAssertFix.hpp"
 #include "SkillStructs.hpp"
+#include "StatSheet.hpp"
+#include "utils/SymbolTable.hpp"
 #include <boost/asio.hpp>
 #include <chrono>
 #include <cmath>
+#include <memory>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <string>
@@ -66,6 +69,7 @@ struct CharacterAttributeStruct
     int character_id = 0;
     std::string name = "";
     std::string slug = "";
+    SymbolId slugId = NO_SYMBOL; // interned slug; set wherever slug is set
     int value = 0;
 };
 
@@ -75,17 +79,26 @@ struct MobAttributeStruct
     int id = 0;
     std::string name = "";
     std::string slug = "";
+    SymbolId slugId = NO_SYMBOL; // interned slug; set wherever slug is set
     int value = 0;
 };
 
+// When an item attribute takes effect ('equip' | 'use' on the wire)
+enum class ItemAttributeApplyOn : uint8_t
+{
+    EQUIP = 0,
+    USE = 1,
+};
+
 struct ItemAttributeStruct
 {
     int id = 0;
     int item_id = 0;
     std::string name = "";
     std::string slug = "";
+    SymbolId slugId = NO_SYMBOL; // interned slug
     int value = 0;
-    std::string apply_on = "equip"; // 'equip' | 'use'
+    ItemAttributeApplyOn applyOn = ItemAttributeApplyOn::EQUIP;
 };
 
 // Equipment slot identifiers (must match equip_slots table slugs)
@@ -326,6 +339,14 @@ struct PlayerQuestProgressStruct
 };
 
 // Runtime buff/debuff applied to a character (sourced from skill, item, quest, dialogue)
+// DoT/HoT classification of an active effect (effectTypeSlug "dot" / "hot")
+enum class EffectTickKind : uint8_t
+{
+    NONE = 0,
+    DOT = 1,
+    HOT = 2,
+};
+
 struct ActiveEffectStruct
 {
     int64_t id = 0;                  // player_active_effect.id
@@ -334,6 +355,10 @@ struct ActiveEffectStruct
     std::string effectTypeSlug = ""; // e.g. "damage", "dot", "hot"
     int attributeId = 0;             // entity_attributes.id (0 = non-stat effect)
     std::string attributeSlug = "";  // slug matched against CharacterAttributeStruct::slug
+    // Interned forms of the two slugs above; filled by resolveEffectSymbols() when the
+    // effect enters CharacterManager, so tick/stat code never compares strings.
+    SymbolId attributeSlugId = NO_SYMBOL;
+    EffectTickKind tickKind = EffectTickKind::NONE;
     float value = 0.0f;              // stat: additive modifier; dot/hot: per-tick amount
     std::string sourceType = "";     // quest|skill|item|dialogue
     int64_t expiresAt = 0;           // Unix timestamp (seconds); 0 = permanent
@@ -396,6 +421,13 @@ struct CharacterDataStruct
     // Active buffs/debuffs (populated on character join, checked vs expiresAt at runtime)
     std::vector<ActiveEffectStruct> activeEffects;
 
+    // apply_on == "equip" bonuses of worn items; pushed by EquipmentManager on every equipment change
+    std::vector<CharacterAttributeStruct> equipmentAttributes;
+
+    // Compiled from attributes + equipmentAttributes + activeEffects by CharacterManager.
+    // Read through statSheetFor(), which recompiles a stale copy on the fly.
+    CharacterStatSheet statSheet;
+
     // Experience debt: accumulated on death; 50% of earned XP pays it off before going to real progress
     int experienceDebt = 0;
 
@@ -459,6 +491,7 @@ struct ClientDataStruct
     int characterId = 0;
     TimestampStruct timestamps; // Lag compensation timestamps
     bool isWorldReady = false;  // Set to true when client sends playerReady (scene loaded)
+    bool binaryWire = false;    // Client negotiated compact binary framing for hot packets at joinGameClient
 };
 
 /**
@@ -637,6 +670,20 @@ struct EventContext
     MessageStruct messageStruct;
     std::string fullMessage;    // For storing the complete JSON message
     TimestampStruct timestamps; // Lag compensation timestamps
+
+    /// Decoded message document. ClientSession parses each packet exactly once and
+    /// hands the DOM over here; dispatcher handlers read header/body through json()
+    /// instead of re-parsing fullMessage.
+    mutable std::shared_ptr<nlohmann::json> document;
+
+    /// Access the decoded document, parsing fullMessage lazily if the producer
+    /// did not attach one (e.g. synthetic contexts).
+    nlohmann::json &json() const
+    {
+        if (!document)
+            document = std::make_shared<nlohmann::json>(nlohmann::json::parse(fullMessage));
+        return *document;
+    }
 };
 
 struct EventDataStruct
@@ -743,6 +790,15 @@ struct MobAIConfig
     // 0.0 = disabled (hard stop), > 0 = deceleration starts this many units before attack range.
     float arrivalSlowdownDistance = 80.0f;
     float arrivalMinSpeedFraction = 0.25f; // Minimum speed as fraction of full chase speed during arrival
+
+    // ---- AI level of detail (idle mobs far from players) ----
+    // Mobs in combat, returning or fleeing always tick at full rate. Idle mobs
+    // tick every time within lodFullRateRange of the nearest player, every
+    // lodCoarseTickInterval up to lodDormantRange, and not at all beyond it.
+    // lodFullRateRange must stay above aggroRange so aggro is never delayed.
+    float lodFullRateRange = 2000.0f;
+    float lodDormantRange = 6000.0f;
+    float lodCoarseTickInterval = 0.5f; // seconds
 };
 
 /**
@@ -867,6 +923,20 @@ struct MobMovementData
     int64_t lastBroadcastMs = 0;
 };
 
+/**
+ * @brief The MobMovementData fields the replication step reads each tick
+ * besides velocity and combat state, which come from the mob hot store.
+ *
+ * Plain values only — copying it never touches the threat/skill maps.
+ */
+struct MobReplicationState
+{
+    bool forceNextUpdate = false;
+    int64_t lastBroadcastMs = 0;
+    bool hasPatrolTarget = false;
+    PositionStruct patrolTargetPoint;
+};
+
 /**
  * @brief Result of movement calculation
  */
@@ -904,6 +974,48 @@ struct MobMoveUpdateStruct
     bool hasWaypoint = false;
 };
 
+/**
+ * @brief One tick's mob steps, serialized once and shared by every recipient.
+ *
+ * Built by the replication step (JsonPackets::encodeMobMoveFragments). Per-client
+ * MOB_MOVE_UPDATE packets are assembled by concatenating the fragments a client
+ * can see, so serialization cost is O(mobs) per tick rather than O(mobs × clients).
+ * serverSendMs is not cached: each packet is stamped when it is assembled for sending.
+ */
+struct MobMoveFragmentsStruct
+{
+    std::string json;                    // JSON object per mob, back to back
+    std::vector<uint32_t> jsonOffsets;   // mob i = json[jsonOffsets[i], jsonOffsets[i + 1])
+    std::string binaryFrame;             // BinaryCodec frame carrying every mob; empty if no binary client
+    std::vector<uint32_t> binaryOffsets; // mob i's record inside binaryFrame, same indexing
+    std::vector<int> uids;               // mob i's UID, same indexing
+
+    size_t count() const
+    {
+        return jsonOffsets.empty() ? 0 : jsonOffsets.size() - 1;
+    }
+};
+
+/**
+ * @brief MOB_MOVE_UPDATE payload for one client: the tick's shared fragments and
+ * the indices (into them) of the mobs this client sees.
+ */
+struct MobMoveUpdateBatchStruct
+{
+    std::shared_ptr<const MobMoveFragmentsStruct> fragments;
+    std::vector<uint32_t> indices;
+};
+
+/**
+ * @brief Mobs that entered or left one client's area of interest this tick.
+ * Entered mobs get a full snapshot (mobEnteredView); left mobs only their UID.
+ */
+struct MobViewDeltaStruct
+{
+    std::vector<int> enteredUids;
+    std::vector<int> leftUids;
+};
+
 /**
  * @brief Zone boundary utilities — shape-aware (RECT / CIRCLE / ANNULUS).
  *
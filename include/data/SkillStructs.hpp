@@ -1,4 +1,5 @@
 #pragma once
+#include "utils/SymbolTable.hpp"
 #include <string>
 #include <vector>
 
@@ -32,6 +33,11 @@ struct SkillStruct
     std::string skillEffectType = ""; // Тип эффекта (damage, heal, buff, etc.)
     int skillLevel = 1;               // Уровень скила
 
+    // Интернированные slug'и (resolveSkillSymbols) — для кулдаунов и расчёта урона без строк
+    SymbolId skillSlugId = NO_SYMBOL;
+    SymbolId scaleStatId = NO_SYMBOL;
+    SymbolId resistanceId = NO_SYMBOL; // "{school}_resistance"
+
     // Характеристики урона
     float coeff = 0.0f;   // Коэффициент масштабирования
     float flatAdd = 0.0f; // Плоская добавка
@@ -64,6 +70,22 @@ struct SkillStruct
     std::vector<SkillEffectDefinitionStruct> effects;
 };
 
+/// Fill the interned IDs of a skill from skillSlug / scaleStat / school.
+inline void
+resolveSkillSymbols(SkillStruct &skill)
+{
+    skill.skillSlugId = internSymbol(skill.skillSlug);
+    skill.scaleStatId = internSymbol(skill.scaleStat);
+    skill.resistanceId = internSymbol(skill.school + "_resistance");
+}
+
+/// skillSlugId, interning on the spot for a skill that was never resolved.
+inline SymbolId
+skillSymbol(const SkillStruct &skill)
+{
+    return skill.skillSlugId != NO_SYMBOL ? skill.skillSlugId : internSymbol(skill.skillSlug);
+}
+
 // Структура для атрибута entity (персонажа или моба)
 struct EntityAttributeStruct
 {
@@ -101,3 +123,4 @@ struct SkillUsageResult
     int healAmount = 0;
     std::vector<std::string> appliedEffects;
 };
+
@@ -0,0 +1,191 @@
+#pragma once
+
+#include "utils/SymbolTable.hpp"
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+struct CharacterAttributeStruct;
+struct ActiveEffectStruct;
+struct CharacterDataStruct;
+
+/**
+ * @brief Dense index of the attribute slugs the server reads in hot paths.
+ *
+ * Slugs not listed here still work — they land in CharacterStatSheet::extra —
+ * but cost a hash lookup per read.
+ */
+enum class StatId : uint8_t
+{
+    MOVE_SPEED = 0,
+    MAX_HEALTH,
+    MAX_MANA,
+    HP_REGEN_PER_S,
+    MP_REGEN_PER_S,
+    STRENGTH,
+    INTELLIGENCE,
+    CONSTITUTION,
+    WISDOM,
+    LUCK,
+    PHYSICAL_ATTACK,
+    MAGICAL_ATTACK,
+    HEALING_POWER,
+    PHYSICAL_DEFENSE,
+    MAGICAL_DEFENSE,
+    ACCURACY,
+    EVASION,
+    CRIT_CHANCE,
+    CRIT_MULTIPLIER,
+    BLOCK_CHANCE,
+    BLOCK_VALUE,
+    ATTACK_SPEED,
+    CAST_SPEED,
+    PHYSICAL_RESISTANCE,
+    MAGICAL_RESISTANCE,
+    FIRE_RESISTANCE,
+    ICE_RESISTANCE,
+    NATURE_RESISTANCE,
+    ARCANE_RESISTANCE,
+    HOLY_RESISTANCE,
+    SHADOW_RESISTANCE,
+    COUNT
+};
+
+constexpr std::size_t STAT_COUNT = static_cast<std::size_t>(StatId::COUNT);
+
+/// Interned slug → StatId; StatId::COUNT when the slug has no dense slot.
+/// SymbolTable interns the StatId slugs first, so this is a range check.
+inline StatId
+statIdFromSymbol(SymbolId symbol)
+{
+    return (symbol >= 1 && symbol <= STAT_COUNT) ? static_cast<StatId>(symbol - 1) : StatId::COUNT;
+}
+
+/// StatId → interned slug.
+inline SymbolId
+statSymbol(StatId id)
+{
+    return static_cast<SymbolId>(id) + 1;
+}
+
+/// Slug → StatId; StatId::COUNT when the slug has no dense slot.
+StatId statIdFromSlug(const std::string &slug);
+
+/// StatId → slug (empty string for StatId::COUNT).
+const std::string &statSlug(StatId id);
+
+/// Fill attributeSlugId and tickKind from the effect's slugs.
+void resolveEffectSymbols(ActiveEffectStruct &effect);
+
+/**
+ * @brief True for effects that modify an attribute: not flag-only, not DoT/HoT.
+ *
+ * This is the mask of combat stats, the stats_update attributes and the
+ * max-health cap; a periodic effect of another type still counts here.
+ */
+bool isStatModifierEffect(const ActiveEffectStruct &effect);
+
+/**
+ * @brief True for attribute effects without a tick interval (tickMs == 0).
+ *
+ * This is the mask of regen, movement speed and the max-mana cap, which skip
+ * every effect that has a tick interval regardless of its type.
+ */
+bool isNonPeriodicStatEffect(const ActiveEffectStruct &effect);
+
+/**
+ * @brief Compiled per-character stats, split into the layers consumers combine.
+ *
+ *  - base   – attributes from the game server (already include permanent modifiers)
+ *  - equip  – apply_on == "equip" bonuses of the items currently worn
+ *  - effect – non-expired active effects (buffs, titles, masteries, passives),
+ *             summed as float (effect) and rounded per effect before summing
+ *             (roundedEffect), once per consumer mask:
+ *               effect / roundedEffect             – isStatModifierEffect()
+ *               staticEffect / roundedStaticEffect – isNonPeriodicStatEffect()
+ *
+ * Combat reads withEffects(), stats_update reads base + equip + effect, the
+ * max-health cap reads roundedEffect; regen reads effectiveStatic(), movement
+ * validation base + staticEffect, the max-mana cap roundedStaticEffect. extra
+ * holds the isStatModifierEffect() layer only. CharacterManager recompiles the
+ * sheet only when attributes, equipment bonuses or active effects change, so
+ * reads are array indexing. validUntilSec marks the first expiry of an effect
+ * in either mask; past it the sheet is stale until processEffectTicks() drops
+ * the effect.
+ */
+struct CharacterStatSheet
+{
+    struct ExtraStat
+    {
+        int base = 0;
+        int equip = 0;
+        float effect = 0.0f;
+        int roundedEffect = 0;
+        bool inBase = false;
+    };
+
+    std::array<int, STAT_COUNT> base{};
+    std::array<int, STAT_COUNT> equip{};
+    std::array<float, STAT_COUNT> effect{};            // exact sum (stats_update display)
+    std::array<int, STAT_COUNT> roundedEffect{};       // sum of per-effect rounded values (combat, max-health cap)
+    std::array<float, STAT_COUNT> staticEffect{};      // exact sum, tickMs == 0 only (movement speed)
+    std::array<int, STAT_COUNT> roundedStaticEffect{}; // per-effect rounded, tickMs == 0 only (regen, max-mana cap)
+    std::bitset<STAT_COUNT> inBase;  // slug present in the base attribute list
+    std::bitset<STAT_COUNT> present; // slug present in base, equip or the effect layer
+    std::unordered_map<SymbolId, ExtraStat> extra; // slugs without a StatId
+
+    int64_t validUntilSec = 0; // Unix seconds; 0 = no timed contributor
+    bool compiled = false;
+
+    bool isFresh(int64_t nowSec) const
+    {
+        return compiled && (validUntilSec == 0 || nowSec < validUntilSec);
+    }
+
+    /// base + active effects (what damage formulas use).
+    int withEffects(StatId id) const
+    {
+        const auto i = static_cast<std::size_t>(id);
+        return base[i] + roundedEffect[i];
+    }
+
+    /// base + equipment + active effects (what the client is shown).
+    int effective(StatId id) const
+    {
+        const auto i = static_cast<std::size_t>(id);
+        return base[i] + equip[i] + roundedEffect[i];
+    }
+
+    /// base + equipment + effects without a tick interval (what regen uses).
+    int effectiveStatic(StatId id) const
+    {
+        const auto i = static_cast<std::size_t>(id);
+        return base[i] + equip[i] + roundedStaticEffect[i];
+    }
+
+    int withEffects(SymbolId symbol) const;
+    int effective(SymbolId symbol) const;
+};
+
+/**
+ * @brief Build a sheet from the three layers.
+ * @param nowSec Unix seconds; effects expiring at or before it are skipped.
+ */
+CharacterStatSheet compileStatSheet(const std::vector<CharacterAttributeStruct> &attributes,
+    const std::vector<CharacterAttributeStruct> &equipmentAttributes,
+    const std::vector<ActiveEffectStruct> &activeEffects,
+    int64_t nowSec);
+
+/**
+ * @brief Return character.statSheet when it is fresh, otherwise compile into scratch.
+ *
+ * Lets consumers holding a CharacterDataStruct copy (or a temporary one built
+ * from mob attributes) read stats without going back to CharacterManager.
+ */
+const CharacterStatSheet &statSheetFor(const CharacterDataStruct &character,
+    CharacterStatSheet &scratch,
+    int64_t nowSec);
@@ -40,6 +40,7 @@ class Event
         SPAWN_ZONE_MOVE_MOBS,
         MOVE_MOB,
         MOB_MOVE_UPDATE,     // Lightweight per-tick position+velocity update (replaces SPAWN_ZONE_MOVE_MOBS for movement)
+        MOB_VIEW_DELTA,      // Mob spawn/despawn snapshots when mobs enter/leave a client's area of interest
         MOB_DEATH,           // Event to notify clients about mob death/removal
         MOB_TARGET_LOST,     // Event to notify clients when mob loses target
         MOB_HEALTH_UPDATE,   // Event to notify clients when mob HP changes (e.g. leash regen)
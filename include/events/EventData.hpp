@@ -128,7 +128,8 @@ using EventData = std::variant<
     std::vector<ActiveEffectStruct>,                       // Active buffs/debuffs for a character (on join)
     std::vector<PlayerInventoryItemStruct>,                // Inventory items loaded from DB (on join)
     std::pair<int, std::vector<CharacterAttributeStruct>>, // Attribute refresh: {characterId, attrs}
-    std::vector<MobMoveUpdateStruct>,                      // Lightweight mob movement updates
+    MobMoveUpdateBatchStruct,                              // Lightweight mob movement updates (shared per-tick fragments)
+    MobViewDeltaStruct,                                    // Mobs entering/leaving a client's view
     // Vendor / Trade / Repair / Durability payloads
     VendorNPCDataStruct,
     VendorStockUpdateStruct,
@@ -3,7 +3,7 @@
 #include "chunk_server/ChunkServer.hpp"
 #include "events/Event.hpp"
 #include "events/EventQueue.hpp"
-#include <mutex>
+#include <vector>
 
 class EventDispatcher
 {
@@ -11,8 +11,12 @@ class EventDispatcher
     EventDispatcher(EventQueue &eventQueue, EventQueue &eventQueuePing, ChunkServer *chunkServer, GameServices &gameServices);
 
     void dispatch(const EventContext &context, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
+    /// Entry point for moveCharacter frames decoded by BinaryCodec (no EventContext/JSON involved)
+    void dispatchMovement(MovementDataStruct movementData, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
 
   private:
+    void flushBatch();
+    void queueMoveCharacter(MovementDataStruct movementData, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
     void handleJoinGameClient(const EventContext &context, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
     void handleJoinGameCharacter(const EventContext &context, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
     void handleMoveCharacter(const EventContext &context, std::shared_ptr<boost::asio::ip::tcp::socket> socket);
@@ -77,9 +81,9 @@ class EventDispatcher
     EventQueue &eventQueuePing_;
     ChunkServer *chunkServer_;
 
-    std::vector<Event> eventsBatch_;
+    /// Thread-local so concurrent dispatch() calls from io_context threads never share a batch
+    static thread_local std::vector<Event> eventsBatch_;
     constexpr static int BATCH_SIZE = 10;
-    mutable std::mutex dispatchMutex_; ///< CRITICAL-3: serialises concurrent dispatch() calls from io_context threads
 
     GameServices &gameServices_;
     std::shared_ptr<spdlog::logger> log_;
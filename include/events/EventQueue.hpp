@@ -1,21 +1,42 @@
 #pragma once
 #include "Event.hpp"
+#include "utils/MpmcRingBuffer.hpp"
 #include <atomic>
 #include <condition_variable>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <queue>
 
+/// Storage behind an EventQueue, chosen per queue in main.cpp.
+enum class EventQueueBackend
+{
+    MUTEX, ///< std::queue + mutex/condvar (original implementation)
+    RING   ///< bounded lock-free MPMC ring; consumers only sleep when it is empty
+};
+
+/// What a RING queue does when a push finds it full (the MUTEX backend always drops oldest).
+enum class EventQueueOverflowPolicy
+{
+    DROP_OLDEST, ///< pop and discard the oldest event, then retry
+    REJECT,      ///< discard the new event
+    BLOCK        ///< park the producer until a consumer frees a slot (or the queue is stopped)
+};
+
 class EventQueue
 {
   public:
-    EventQueue(size_t maxSize = 10000); // Default max size to prevent memory bloat
+    EventQueue(size_t maxSize = 10000, // Default max size to prevent memory bloat
+        EventQueueBackend backend = EventQueueBackend::MUTEX,
+        EventQueueOverflowPolicy overflowPolicy = EventQueueOverflowPolicy::DROP_OLDEST);
 
     void push(const Event &event);
     void push(Event &&event); // Add rvalue overload for efficient move
     bool pop(Event &event);   // returns false when stopped and queue is empty
 
     void pushBatch(const std::vector<Event> &events);
+    /// Move-only batch push: events are moved out (caller clears the vector afterwards).
+    void pushBatch(std::vector<Event> &&events);
     bool popBatch(std::vector<Event> &events, int batchSize);
     bool empty();
     size_t size(); // Add size method for monitoring
@@ -31,7 +52,8 @@ class EventQueue
     void forceCleanup();
 
     /// HIGH-4: Signal all blocked pop/popBatch callers to return false so that
-    ///         consumer threads can exit cleanly on shutdown.
+    ///         consumer threads can exit cleanly on shutdown. Producers parked by
+    ///         the BLOCK policy are released too and drop their event.
     void stop();
     bool isStopped() const
     {
@@ -39,6 +61,24 @@ class EventQueue
     }
 
   private:
+    // RING backend helpers
+    void ringPush(Event &&event);
+    size_t ringDrain(std::vector<Event> &events, size_t maxCount);
+    bool ringWait(std::vector<Event> &events, size_t maxCount);
+    void wakeConsumers();
+    void waitNotFull();
+    void wakeProducers();
+
+    EventQueueBackend backend_;
+    EventQueueOverflowPolicy overflowPolicy_;
+    std::unique_ptr<MpmcRingBuffer<Event>> ring_;
+    /// Consumers parked on cv (RING): producers only take mtx to notify when this is non-zero.
+    std::atomic<int> sleepingConsumers_{0};
+    /// BLOCK producers parked on notFullCv_; consumers only take notFullMtx_ when this is non-zero.
+    std::atomic<int> sleepingProducers_{0};
+    std::mutex notFullMtx_;
+    std::condition_variable notFullCv_;
+
     std::queue<Event> queue;
     std::mutex mtx;
     std::condition_variable cv;
@@ -7,6 +7,7 @@
 #include "services/GameServices.hpp"
 #include "utils/ResponseBuilder.hpp"
 #include <boost/asio.hpp>
+#include <functional>
 #include <memory>
 
 /**
@@ -150,6 +151,50 @@ class BaseEventHandler
      */
     void broadcastToAllClients(const std::string &responseData, int excludeClientId = -1);
 
+    /**
+     * @brief Broadcast a hot packet that has a compact binary encoding
+     *
+     * Clients that negotiated the binary wire protocol receive binaryFrame; the
+     * JSON encoding is produced lazily, only if at least one JSON client remains.
+     *
+     * @param encodeJson Produces the newline-terminated JSON message
+     * @param binaryFrame BinaryCodec frame (nullptr = JSON for everyone)
+     * @param excludeClientId Client ID to exclude from broadcast (optional)
+     */
+    void broadcastHotPacket(
+        const std::function<std::string()> &encodeJson,
+        std::shared_ptr<const std::string> binaryFrame,
+        int excludeClientId = -1);
+
+    /**
+     * @brief Sockets of clients that can see a player (area of interest)
+     *
+     * Peers in view plus the player's own client. Falls back to every active
+     * socket when interest filtering is disabled.
+     *
+     * @param characterId Player the packet is about
+     * @param excludeClientId Client ID to exclude (optional)
+     */
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> getInterestSockets(int characterId, int excludeClientId = -1);
+
+    /**
+     * @brief Broadcast a player-scoped message to clients that can see the player
+     *
+     * @param characterId Player the message is about
+     * @param responseData JSON response data to broadcast
+     * @param excludeClientId Client ID to exclude from broadcast (optional)
+     */
+    void broadcastToObservers(int characterId, const std::string &responseData, int excludeClientId = -1);
+
+    /**
+     * @brief broadcastHotPacket restricted to clients that can see the player
+     */
+    void broadcastHotPacketToObservers(
+        int characterId,
+        const std::function<std::string()> &encodeJson,
+        std::shared_ptr<const std::string> binaryFrame,
+        int excludeClientId = -1);
+
     /**
      * @brief Check whether a character is alive (HP > 0)
      *
@@ -163,4 +208,10 @@ class BaseEventHandler
     NetworkManager &networkManager_;
     GameServerWorker &gameServerWorker_;
     GameServices &gameServices_;
+
+  private:
+    void sendHotPacket(
+        const std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> &sockets,
+        const std::function<std::string()> &encodeJson,
+        const std::shared_ptr<const std::string> &binaryFrame);
 };
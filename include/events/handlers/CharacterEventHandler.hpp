@@ -3,6 +3,7 @@
 #include "events/Event.hpp"
 #include "events/handlers/BaseEventHandler.hpp"
 #include "events/handlers/SkillEventHandler.hpp"
+#include "network/WorldSnapshot.hpp"
 #include <memory>
 #include <mutex>
 #include <unordered_map>
@@ -65,6 +66,7 @@ class CharacterEventHandler : public BaseEventHandler
 
     /**
      * @brief Set equipment event handler for broadcasting equipment updates on join
+     *        while interest filtering is disabled
      */
     void setEquipmentEventHandler(EquipmentEventHandler *equipmentEventHandler);
 
@@ -119,6 +121,16 @@ class CharacterEventHandler : public BaseEventHandler
         std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
         int excludeCharacterId);
 
+    /**
+     * @brief Queue the getConnectedCharacters list (critical) and one
+     *        PLAYER_EQUIPMENT_UPDATE per character (positioned at the character).
+     *
+     * Entries come from the cached connectedCharactersSnapshot_, rebuilt when a
+     * character is added, removed or reloaded, equipment changes, or after
+     * CHARACTERS_SNAPSHOT_MAX_AGE_MS (positions).
+     */
+    void appendConnectedCharactersSnapshot(int clientID, int excludeCharacterId, WorldSnapshotStream &stream);
+
   public:
     /**
      * @brief Handle set character data event
@@ -168,13 +180,15 @@ class CharacterEventHandler : public BaseEventHandler
     void handlePlayerRespawnEvent(const Event &event);
 
     /**
-     * @brief Broadcast a PLAYER_TITLE_CHANGED packet to all zone clients except one.
+     * @brief Broadcast a PLAYER_TITLE_CHANGED packet to clients that can see the owner.
      *
-     * Sends the currently equipped title slug of @p characterId to every connected
-     * client, excluding @p excludeClientId (use the owner's clientId so they don't
-     * receive a redundant update on top of the private player_titles_update).
+     * Sends the currently equipped title slug of @p characterId to every client in
+     * the owner's area of interest, excluding @p excludeClientId (use the owner's
+     * clientId so they don't receive a redundant update on top of the private
+     * player_titles_update). Players out of view get the title in the
+     * playerEnteredView snapshot instead.
      * Called from:
-     *  – handlePlayerReadyEvent (Phase 4 catch-up, in case titles loaded before ready)
+     *  – handlePlayerReadyEvent (catch-up while interest filtering is disabled)
      *  – EventHandler::handleSetPlayerTitlesEvent (catch-up if titles load after ready)
      *  – EventHandler::handleEquipTitleEvent (live title change by the owner)
      *
@@ -183,6 +197,20 @@ class CharacterEventHandler : public BaseEventHandler
      */
     void broadcastTitleChanged(int characterId, int excludeClientId = -1);
 
+    /**
+     * @brief Move a player in the interest grid and send spawn/despawn snapshots.
+     *
+     * Peers that just came into view receive a playerEnteredView snapshot of this
+     * player (character, equipment, title) and this player receives one batched
+     * snapshot of them; peers that left view get playerLeftView both ways.
+     * Must be called after CharacterManager::setCharacterPosition.
+     *
+     * @param characterId Player that moved, spawned or teleported.
+     * @param clientId    Owning client.
+     * @param position    New position.
+     */
+    void refreshInterest(int characterId, int clientId, const PositionStruct &position);
+
     /**
      * @brief Initialize player skills after successful character join
      *
@@ -208,6 +236,14 @@ class CharacterEventHandler : public BaseEventHandler
      */
     nlohmann::json characterToJson(const CharacterDataStruct &characterData);
 
+    /**
+     * @brief Build one playerEnteredView entry: character, equipment slots and clientId.
+     */
+    nlohmann::json buildViewSnapshotEntry(int characterId, int clientId);
+
+    /// Enter/leave packets for one InterestDelta (runs inside InterestManager::deliverInOrder).
+    void sendInterestDelta(int characterId, int clientId, const InterestDelta &delta);
+
     /**
      * @brief Evict a stale session for a character that is already loaded.
      *
@@ -263,12 +299,23 @@ class CharacterEventHandler : public BaseEventHandler
     // Reference to mob event handler for server-push spawn zones on join
     MobEventHandler *mobEventHandler_;
 
-    // Reference to equipment event handler for broadcasting equipment on player join
-    EquipmentEventHandler *equipmentEventHandler_;
+    // Reference to equipment event handler for the join-time equipment broadcast
+    EquipmentEventHandler *equipmentEventHandler_{nullptr};
 
     // Reference to world-object event handler for sending WIO data on player join
     WorldObjectEventHandler *worldObjectEventHandler_{nullptr};
 
     // Last known GameZone id per characterId — used to detect zone transitions
     std::unordered_map<int, int> lastZoneByCharacter_;
+
+    // movement.speed_buffer_multiplier, read on every movement packet
+    GameConfigKey speedBufferKey_;
+
+    // worldSnapshot.nearRadius: playerReady packets within it go out ahead of the ack
+    GameConfigKey snapshotNearRadiusKey_;
+
+    static constexpr int64_t CHARACTERS_SNAPSHOT_MAX_AGE_MS = 250;
+
+    // {"clientId", "character"} entry + equipment slots per online character
+    WorldSnapshotSection connectedCharactersSnapshot_{CHARACTERS_SNAPSHOT_MAX_AGE_MS};
 };
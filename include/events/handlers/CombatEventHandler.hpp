@@ -62,6 +62,11 @@ class CombatEventHandler : public BaseEventHandler
      */
     void updateOngoingActions();
 
+    /**
+     * @brief Tick DoT/HoT effects (world tick EFFECTS phase)
+     */
+    void tickEffects();
+
     /**
      * @brief Get reference to the CombatSystem for other services
      */
@@ -72,6 +77,8 @@ class CombatEventHandler : public BaseEventHandler
      */
     void sendBroadcast(const nlohmann::json &packet);
 
+    void setCharacterEventHandler(class CharacterEventHandler *handler) { characterEventHandler_ = handler; }
+
   private:
     /**
      * @brief Parse player attack request
@@ -108,6 +115,8 @@ class CombatEventHandler : public BaseEventHandler
     void broadcastSkillExecution(const SkillExecutionResult &result);
 
   private:
+    class CharacterEventHandler *characterEventHandler_ = nullptr;
+
     std::unique_ptr<CombatSystem> combatSystem_;
     std::unique_ptr<SkillSystem> skillSystem_;
     std::unique_ptr<CombatResponseBuilder> responseBuilder_;
@@ -31,8 +31,8 @@ class EquipmentEventHandler : public BaseEventHandler
     void sendWeightStatus(int clientId, int characterId);
 
     /**
-     * Broadcast PLAYER_EQUIPMENT_UPDATE to all clients so they can render
-     * the correct gear visuals on other characters.
+     * Broadcast PLAYER_EQUIPMENT_UPDATE to clients that can see the character
+     * so they can render the correct gear visuals on other characters.
      * @param excludeClientId  Client that already received EQUIPMENT_STATE (owner).
      *                         Pass -1 to broadcast to everyone.
      */
@@ -1,5 +1,6 @@
 #pragma once
 #include "events/handlers/BaseEventHandler.hpp"
+#include "network/WorldSnapshot.hpp"
 #include "services/GameServices.hpp"
 #include <chrono>
 #include <mutex>
@@ -120,6 +121,21 @@ class ItemEventHandler : public BaseEventHandler
         std::shared_ptr<boost::asio::ip::tcp::socket> socket,
         float lootRadius = 5000.0f);
 
+    /**
+     * @brief Queue itemDrop packets (GROUND_ITEMS_CHUNK items each, nearest first)
+     *        for ground items within lootRadius of the player.
+     *        Items come from the cached groundItemsSnapshot_, rebuilt when an item
+     *        is dropped or removed, or after GROUND_ITEMS_SNAPSHOT_MAX_AGE_MS
+     *        (reservationSecondsLeft counts down).
+     * @param clientId   Target client ID
+     * @param hash       Client hash echoed in the header
+     * @param playerPos  Player position
+     * @param lootRadius Radius for nearby item filter
+     * @param stream     Receives the packets
+     */
+    void appendGroundItemsSnapshot(int clientId, const std::string &hash, const PositionStruct &playerPos,
+        float lootRadius, WorldSnapshotStream &stream);
+
     /**
      * @brief Send ground items snapshot with distance throttling.
      *        Called from movement handler; only sends if the character has moved
@@ -132,9 +148,14 @@ class ItemEventHandler : public BaseEventHandler
         std::shared_ptr<boost::asio::ip::tcp::socket> socket);
 
   private:
+    static constexpr size_t GROUND_ITEMS_CHUNK = 32;
+    static constexpr int64_t GROUND_ITEMS_SNAPSHOT_MAX_AGE_MS = 1000;
+
     GameServices &gameServices_;
     std::shared_ptr<spdlog::logger> log_;
 
+    WorldSnapshotSection groundItemsSnapshot_{GROUND_ITEMS_SNAPSHOT_MAX_AGE_MS};
+
     // Per-character item-use cooldown tracker.
     // Key: characterId → (itemId → time when cooldown expires)
     // Protected by itemCooldownMutex_ — handleUseItemEvent may be called
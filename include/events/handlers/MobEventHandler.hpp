@@ -2,6 +2,7 @@
 
 #include "events/Event.hpp"
 #include "events/handlers/BaseEventHandler.hpp"
+#include "network/WorldSnapshot.hpp"
 
 /**
  * @brief Handler for mob-related events
@@ -114,10 +115,20 @@ class MobEventHandler : public BaseEventHandler
      * Full mob data is already known from spawnMobsInZone — only uid/pos/velocity
      * are transmitted here to minimize bandwidth.
      *
-     * @param event Event containing vector<MobMoveUpdateStruct>
+     * @param event Event containing MobMoveUpdateBatchStruct (shared per-tick fragments)
      */
     void handleMobMoveUpdateEvent(const Event &event);
 
+    /**
+     * @brief Handle mobs entering/leaving a client's area of interest.
+     *
+     * Entered mobs are sent as full snapshots (mobEnteredView, same entry format
+     * as spawnMobsInZone); left mobs as a UID list (mobLeftView).
+     *
+     * @param event Event containing MobViewDeltaStruct
+     */
+    void handleMobViewDeltaEvent(const Event &event);
+
     /**
      * @brief Push all spawn zones and their current live mobs to a single client.
      *
@@ -129,7 +140,21 @@ class MobEventHandler : public BaseEventHandler
      */
     void sendSpawnZonesToClient(int clientID, std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket);
 
+    /**
+     * @brief Queue one spawnMobsInZone packet per non-empty spawn zone, positioned at the zone centre.
+     *
+     * Zone bodies come from the cached spawnZoneSnapshot_, shared by every join
+     * until a mob spawns, dies or despawns, or the snapshot is older than
+     * SPAWN_ZONE_SNAPSHOT_MAX_AGE_MS (positions move every tick; joining
+     * clients get live mob updates right after).
+     */
+    void appendSpawnZoneSnapshot(int clientID, WorldSnapshotStream &stream);
+
   private:
+    static constexpr int64_t SPAWN_ZONE_SNAPSHOT_MAX_AGE_MS = 250;
+
+    WorldSnapshotSection spawnZoneSnapshot_{SPAWN_ZONE_SNAPSHOT_MAX_AGE_MS};
+
     /**
      * @brief Convert mob data to JSON format
      *
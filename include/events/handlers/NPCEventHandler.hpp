@@ -2,6 +2,7 @@
 
 #include "events/Event.hpp"
 #include "events/handlers/BaseEventHandler.hpp"
+#include "network/WorldSnapshot.hpp"
 
 /**
  * @brief Handler for NPC-related events
@@ -38,6 +39,15 @@ class NPCEventHandler : public BaseEventHandler
      */
     void sendNPCSpawnDataToClient(int clientId, const PositionStruct &playerPosition, float spawnRadius = 1000.0f);
 
+    /**
+     * @brief Queue spawnNPCs packets for NPCs within spawnRadius, nearest first.
+     *
+     * NPCs come from the cached npcSnapshot_; only the per-character quest
+     * statuses are written per call. Packets carry up to NPC_SPAWN_CHUNK NPCs
+     * and always go on the critical lane (NPC_AMBIENT_POOLS refers to them).
+     */
+    void appendNPCSpawnSnapshot(int clientId, int characterId, float spawnRadius, WorldSnapshotStream &stream);
+
     /**
      * @brief Build and send NPC_AMBIENT_POOLS packet to a client.
      *        Called on playerReady and whenever player context changes.
@@ -50,5 +60,14 @@ class NPCEventHandler : public BaseEventHandler
     void sendAmbientPoolsToClient(int clientId, int characterId, const PositionStruct &playerPosition, float spawnRadius = 50000.0f);
 
   private:
-    nlohmann::json convertNPCToSpawnJson(const NPCDataStruct &npc, int characterId);
+    static constexpr size_t NPC_SPAWN_CHUNK = 32;
+
+    /// Spawn entry without "quests" (per character, see appendNPCSpawnSnapshot)
+    nlohmann::json convertNPCToSpawnJson(const NPCDataStruct &npc);
+
+    /// available | in_progress | completable | turned_in | failed
+    std::string questStatusForNPC(int characterId, const std::string &questSlug);
+
+    // Every NPC minus its per-character quest statuses; rebuilt when NPCManager's version changes
+    WorldSnapshotSection npcSnapshot_{5000};
 };
\ No newline at end of file
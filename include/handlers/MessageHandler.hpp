@@ -13,6 +13,11 @@ class MessageHandler
     std::tuple<std::string, ClientDataStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
     parseMessageWithTimestamps(const std::string &message);
 
+    /// Decode every envelope field from a document that was already parsed once
+    /// by the caller (ClientSession); no further JSON parsing happens here.
+    std::tuple<std::string, ClientDataStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
+    parseMessageWithTimestamps(const nlohmann::json &jsonData);
+
   private:
     JSONParser &jsonParser_;
-};
\ No newline at end of file
+};
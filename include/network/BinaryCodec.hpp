@@ -0,0 +1,89 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include <cstdint>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Message types carried by the compact binary wire format.
+ *
+ * Only high-frequency packets have a binary layout; everything else stays
+ * newline-delimited JSON on the same socket.
+ */
+enum class BinaryMessageType : uint8_t
+{
+    MOVE_CHARACTER = 0x01,  ///< client → server movement input
+    CHARACTER_MOVED = 0x02, ///< server → client movement broadcast
+    MOB_MOVE_UPDATE = 0x03, ///< server → client batched mob steps
+    COMBAT_RESULT = 0x04,   ///< server → client single-target damage result
+    EFFECT_TICK = 0x05,     ///< server → client DoT/HoT tick
+    VITALS_UPDATE = 0x06,   ///< server → client HP/mana refresh (regen stats_update)
+};
+
+struct BinaryFrameHeader
+{
+    BinaryMessageType type = BinaryMessageType::MOVE_CHARACTER;
+    uint32_t payloadLength = 0;
+};
+
+/**
+ * @brief Encoder/decoder for the length-prefixed binary framing.
+ *
+ * A client opts in at joinGameClient with header "wireProtocol": "binary".
+ * Frames start with FRAME_MAGIC, which can never begin a JSON line, so binary
+ * frames and JSON lines can be interleaved on one connection.
+ *
+ * Frame layout (all integers and floats little-endian):
+ *   u8  magic (0xB5)
+ *   u8  BinaryMessageType
+ *   u32 payload length
+ *   ... payload (fixed layout per type, documented next to each encoder)
+ */
+class BinaryCodec
+{
+  public:
+    static constexpr uint8_t FRAME_MAGIC = 0xB5;
+    static constexpr size_t FRAME_HEADER_SIZE = 6;
+
+    enum class PeekResult
+    {
+        INCOMPLETE, ///< not enough bytes buffered yet
+        READY,      ///< full frame available, header filled in
+        INVALID     ///< bad magic or payload larger than maxPayload
+    };
+
+    /// Inspect the start of a receive buffer for a complete frame.
+    static PeekResult peekFrame(const char *data, size_t length, size_t maxPayload, BinaryFrameHeader &header);
+
+    /// Client → server movement. Payload: i32 characterId, f32 x/y/z/rotZ,
+    /// u8 flags (bit0 isFalling), i64 clientSendMs — 29 bytes.
+    static std::string encodeMoveCharacter(const MovementDataStruct &movement, long long clientSendMs);
+    static bool decodeMoveCharacter(const char *payload, size_t length, MovementDataStruct &movement, long long &clientSendMs);
+
+    /// Server → client movement broadcast. Payload: i32 clientId, i32 characterId,
+    /// f32 x/y/z/rotZ, u8 flags, i64 serverRecvMs, i64 serverSendMs, i64 clientSendMsEcho.
+    static std::string encodeCharacterMoved(int clientId, const MovementDataStruct &movement, const TimestampStruct &timestamps);
+
+    /// Server → client mob steps. Payload: i64 serverSendMs, u16 count, then per mob
+    /// i32 uid, i32 zoneId, f32 x/y/z/rotZ, f32 dirX/dirY/speed, u8 combatState,
+    /// u8 flags (bit0 hasWaypoint), i64 stepTimestampMs, [f32 waypointX/Y].
+    /// recordOffsets (optional) receives each mob record's start offset plus the frame end.
+    static std::string encodeMobMoveUpdate(const std::vector<MobMoveUpdateStruct> &mobs, long long serverSendMs,
+        std::vector<uint32_t> *recordOffsets = nullptr);
+
+    /// mobMoveUpdate frame for a subset of a tick's mobs, copied from the cached records
+    /// (fragments.binaryFrame must be set), stamped with serverSendMs.
+    static std::shared_ptr<const std::string> assembleMobMoveUpdate(
+        const MobMoveFragmentsStruct &fragments, const std::vector<uint32_t> &indices, long long serverSendMs);
+
+    /**
+     * @brief Encode a combat/stats JSON packet when its eventType has a binary layout.
+     *
+     * Handles combatResult (successful damage), effectTick and regen stats_update.
+     * @return Frame bytes, or nullptr when the packet must stay JSON.
+     */
+    static std::shared_ptr<const std::string> encodeFromJson(const nlohmann::json &packet);
+};
@@ -13,6 +13,7 @@
 
 // Forward declarations
 class ChunkServer;
+struct BinaryFrameHeader;
 class EventDispatcher;
 class MessageHandler;
 
@@ -63,12 +64,14 @@ class ClientSession : public std::enable_shared_from_this<ClientSession>
   private:
     void doRead();
     void processMessage(const std::string &message);
+    void processBinaryFrame(const BinaryFrameHeader &header, const char *payload);
     void handleClientDisconnect();
     void notifyCleanup(); // Called when session is ending
 
     std::shared_ptr<boost::asio::ip::tcp::socket> socket_;
     std::array<char, 1024> dataBuffer_;
     std::string accumulatedData_;
+    bool binaryWire_ = false; ///< client negotiated BinaryCodec frames at joinGameClient
 
     // Cleanup callback for NetworkManager
     std::function<void(std::shared_ptr<ClientSession>)> cleanupCallback_;
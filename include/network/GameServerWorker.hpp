@@ -6,9 +6,13 @@
 #include "utils/JSONParser.hpp"
 #include "utils/Logger.hpp"
 #include <array>
+#include <atomic>
 #include <boost/asio.hpp>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <nlohmann/json.hpp>
 #include <queue>
 #include <string>
@@ -40,6 +44,12 @@ class GameServerWorker
     /// CRITICAL-2: serialised send queue — only accessed via strand_
     std::queue<std::string> sendQueue_;
     bool writePending_{false};
+    /// Messages accepted by sendDataToGameServer() and not yet handed to async_write
+    std::atomic<size_t> pendingSends_{0};
+    /// Messages accepted by sendDataToGameServer() whose async_write has not completed yet
+    size_t unfinishedSends_{0};
+    std::mutex drainMutex_;
+    std::condition_variable drainCv_;
     /// LOW-8: stored so receiveDataFromGameServer can reconnect on disconnect
     boost::asio::ip::tcp::resolver::results_type endpoints_;
 
@@ -50,6 +60,8 @@ class GameServerWorker
     void processGameServerData(std::string_view data);
     /// Dequeue and async_write the next pending message; must run on strand_.
     void doNextWrite();
+    /// Marks one accepted message as written (or failed) and wakes waitForSendsDrained().
+    void finishSend();
 
   public:
     GameServerWorker(EventQueue &eventQueue,
@@ -58,6 +70,10 @@ class GameServerWorker
     ~GameServerWorker();
     void startIOEventLoop();
     void sendDataToGameServer(const std::string &data);
+    /// Back-pressure signal for PersistenceJournal; safe to call from any thread.
+    size_t pendingSendCount() const { return pendingSends_.load(std::memory_order_relaxed); }
+    /// Blocks until every accepted message has been written (or failed); false on timeout.
+    bool waitForSendsDrained(std::chrono::milliseconds timeout);
     void receiveDataFromGameServer();
     void connect(boost::asio::ip::tcp::resolver::results_type endpoints, int currentRetryCount = 0);
     void closeConnection();
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Streaming JSON writer that appends straight into a caller-owned string.
+ *
+ * No DOM is built: keys and values are written as they arrive and commas are
+ * placed automatically. The caller reserves the buffer once, so a packet costs
+ * one allocation (the buffer) instead of one per node.
+ *
+ * Floats are written in the shortest form that round-trips (std::to_chars);
+ * NaN and infinity become null, as with nlohmann::json::dump().
+ *
+ * Nesting is limited to MAX_DEPTH containers; opening one more throws
+ * std::length_error instead of writing misplaced commas.
+ *
+ * Example:
+ *   std::string out;
+ *   out.reserve(256);
+ *   JsonWriter w(out);
+ *   w.beginObject().field("id", 7).key("pos").beginObject().field("x", 1.5f).endObject().endObject();
+ */
+class JsonWriter
+{
+  public:
+    static constexpr int MAX_DEPTH = 16;
+
+    explicit JsonWriter(std::string &out)
+        : out_(out)
+    {
+    }
+
+    JsonWriter &beginObject();
+    JsonWriter &endObject();
+    JsonWriter &beginArray();
+    JsonWriter &endArray();
+
+    /// Object key; the next value() / begin*() call is its value.
+    JsonWriter &key(std::string_view name);
+
+    JsonWriter &value(std::string_view v);
+    JsonWriter &value(const char *v)
+    {
+        return value(std::string_view(v));
+    }
+    JsonWriter &value(const std::string &v)
+    {
+        return value(std::string_view(v));
+    }
+    JsonWriter &value(bool v);
+    JsonWriter &value(std::nullptr_t);
+    JsonWriter &value(double v);
+    JsonWriter &value(float v);
+
+    template <typename T, std::enable_if_t<std::is_integral_v<T> && !std::is_same_v<T, bool>, int> = 0>
+    JsonWriter &value(T v)
+    {
+        if constexpr (std::is_signed_v<T>)
+            return writeSigned(static_cast<long long>(v));
+        else
+            return writeUnsigned(static_cast<unsigned long long>(v));
+    }
+
+    /// Embed a DOM subtree (cold or free-form fields) via the public dump().
+    JsonWriter &value(const nlohmann::json &v);
+
+    /// Embed an already serialized JSON value verbatim.
+    JsonWriter &raw(std::string_view json);
+
+    /// Embed an already serialized object but leave it open, so per-viewer
+    /// fields can be appended before endObject().
+    JsonWriter &beginRawObject(std::string_view objectJson);
+
+    template <typename T>
+    JsonWriter &field(std::string_view name, const T &v)
+    {
+        key(name);
+        return value(v);
+    }
+
+  private:
+    /// Comma before a value unless it follows a key or opens its container.
+    void separate();
+    void enterLevel(bool hasItems);
+    void push(char open);
+    void pop(char close);
+    void writeString(std::string_view s);
+    JsonWriter &writeSigned(long long v);
+    JsonWriter &writeUnsigned(unsigned long long v);
+
+    std::string &out_;
+    int depth_ = 0;
+    bool hasItems_[MAX_DEPTH] = {};
+    bool afterKey_ = false;
+};
+
+/**
+ * @brief Schema-specific writers for the hot JSON packets.
+ *
+ * Each produces the same envelope as NetworkManager::generateResponseMessage
+ * (header with status / timestamp / version, then body), newline-terminated,
+ * without building a nlohmann::json DOM. Counterpart of BinaryCodec for
+ * clients on the JSON wire.
+ */
+class JsonPackets
+{
+  public:
+    /**
+     * @brief Generic envelope for a ResponseBuilder message.
+     *
+     * Header entries are copied from message["header"] (status, timestamp and
+     * version are replaced); message["body"] is serialized in place.
+     * When timestamps is given, the lag compensation fields are written with
+     * serverSendMs = now.
+     */
+    static std::string encodeResponse(const std::string &status, const nlohmann::json &message,
+        const TimestampStruct *timestamps = nullptr);
+
+    /**
+     * @brief Serialize a tick's mob steps once, as JSON fragments and, when
+     * withBinaryFrame is set, as a BinaryCodec frame.
+     *
+     * Called by the replication step; the result is shared by every client's
+     * MOB_MOVE_UPDATE event. The binary frame is skipped when no client is on
+     * the binary wire.
+     */
+    static std::shared_ptr<const MobMoveFragmentsStruct> encodeMobMoveFragments(
+        const std::vector<MobMoveUpdateStruct> &mobs, bool withBinaryFrame);
+
+    /// mobMoveUpdate for one client: envelope plus the cached fragments at indices.
+    /// serverSendMs is stamped here, at send time.
+    static std::string assembleMobMoveUpdate(int clientId, const MobMoveFragmentsStruct &fragments,
+        const std::vector<uint32_t> &indices);
+
+    /**
+     * @brief Envelope with header {message, hash, clientId, eventType} around a body written by writeBody.
+     *
+     * For packets assembled from cached fragments (WorldSnapshotSection).
+     * writeBody writes the body value; hash == nullptr omits the hash field.
+     */
+    static std::string encodeEnvelope(int clientId, std::string_view eventType, std::string_view message,
+        const char *hash, const std::function<void(JsonWriter &)> &writeBody, size_t reserve = 0);
+
+    /// moveCharacter broadcast; serverSendMs is taken from timestamps.
+    static std::string encodeCharacterMoved(int clientId, const MovementDataStruct &movement, const TimestampStruct &timestamps);
+};
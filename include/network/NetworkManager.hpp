@@ -6,7 +6,9 @@
 #include "utils/Config.hpp"
 #include "utils/JSONParser.hpp"
 #include <array>
+#include <atomic>
 #include <boost/asio.hpp>
+#include <chrono>
 #include <deque>
 #include <memory>
 #include <mutex>
@@ -22,6 +24,19 @@ class ChunkServer;
 class EventDispatcher;
 class MessageHandler;
 
+/// Socket write counters since the previous collectWriteStats().
+struct NetworkWriteStats
+{
+    uint64_t flushes = 0;           ///< gather writes started (one per drain of a socket queue)
+    uint64_t syscalls = 0;          ///< async_write_some completions (one writev each)
+    uint64_t packets = 0;           ///< queued buffers written
+    uint64_t bytes = 0;
+    uint64_t maxPacketsPerFlush = 0;
+    uint64_t supersededBytes = 0; ///< stale bulk updates replaced by a newer one for the same entities
+    uint64_t droppedBytes = 0;    ///< entity updates dropped from a full backlog (all their entities updated later)
+    uint64_t pacedWaits = 0;      ///< times a client's bulk lane waited for its egress budget
+};
+
 class NetworkManager
 {
   public:
@@ -34,6 +49,16 @@ class NetworkManager
     void sendResponse(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, std::shared_ptr<const std::string> data);
     /// Bulk priority send — mob position updates go here so combat packets always reach clients first
     void sendResponseBulk(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, std::shared_ptr<const std::string> data);
+    /// Bulk send of a state update for entityIds (sorted); replaces stale queued updates it fully covers.
+    void sendResponseBulk(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket, std::shared_ptr<const std::string> data,
+        std::vector<int> entityIds);
+    /// Enable/disable BinaryCodec framing for hot packets on this socket (negotiated at joinGameClient).
+    void setBinaryWire(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket, bool enabled);
+    bool isBinaryWire(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket);
+    /// True while at least one socket is on the binary wire.
+    bool hasBinaryWireClients() const;
+    /// Coalescing counters across all sockets; resets them.
+    NetworkWriteStats collectWriteStats();
     std::string generateResponseMessage(const std::string &status, const nlohmann::json &message);
     std::string generateResponseMessage(const std::string &status, const nlohmann::json &message, const TimestampStruct &timestamps);
     void setChunkServer(ChunkServer *ChunkServer);
@@ -50,15 +75,49 @@ class NetworkManager
     // Per-socket priority write queue — serialises all writes to a socket and
     // ensures that CRITICAL packets (combat, stats) are always delivered before
     // BULK packets (mob position updates), even when bulk data is already queued.
+    //
+    // Each write drains up to MAX_GATHER_BUFFERS queued packets (critical first,
+    // then bulk, at most MAX_GATHER_BYTES) into one gather write, so a burst of
+    // small packets costs one writev instead of one syscall and strand hop each.
+    static constexpr size_t MAX_GATHER_BUFFERS = 64; // asio hands at most 64 iovecs to one writev
+    static constexpr size_t MAX_GATHER_BYTES = 256 * 1024;
+
+    // Egress budget (game config, see applyEgressConfig): every byte written to a
+    // socket spends from a token bucket refilled at network.clientBudgetBytesPerSec
+    // (burst of one second, 0 = unlimited). Critical packets always go out; the
+    // bulk lane waits while the bucket is empty, which paces a client on a slow
+    // link down to its budget. While bulk packets wait longer than
+    // network.bulkStaleMs, a new update replaces queued ones for the same
+    // entities, so only the latest position per mob is kept. Past
+    // network.bulkMaxQueuedSec seconds of budget, the oldest updates whose
+    // entities all have a newer queued update are dropped; an update that is the
+    // last one for any of its entities, and bulk packets without entity ids, are
+    // never dropped.
+    struct BulkPacket
+    {
+        std::shared_ptr<const std::string> data;
+        std::chrono::steady_clock::time_point enqueuedAt;
+        std::vector<int> entityIds; ///< sorted; empty = never superseded
+    };
+
     struct SocketWriteQueue
     {
         boost::asio::strand<boost::asio::io_context::executor_type> strand;
         std::deque<std::shared_ptr<const std::string>> criticalQ;
-        std::deque<std::shared_ptr<const std::string>> bulkQ;
+        std::deque<BulkPacket> bulkQ;
+        size_t bulkBytes{0};
+        double budgetTokens{0.0}; ///< bytes that may be written now; negative after a critical burst
+        std::chrono::steady_clock::time_point budgetRefilledAt{}; ///< epoch: the first refill fills the bucket
+        boost::asio::steady_timer paceTimer; ///< wakes the bulk lane when budget is available again
+        bool pacing{false};
+        std::vector<std::shared_ptr<const std::string>> inFlight; ///< packets of the current gather write
+        std::vector<boost::asio::const_buffer> gather;            ///< their unsent bytes
         bool writing{false};
+        std::atomic<bool> binaryWire{false}; ///< hot packets go out as BinaryCodec frames
 
         explicit SocketWriteQueue(boost::asio::io_context &ioc)
-            : strand(boost::asio::make_strand(ioc))
+            : strand(boost::asio::make_strand(ioc)),
+              paceTimer(strand)
         {
         }
     };
@@ -70,10 +129,40 @@ class NetworkManager
     /// Enqueue data for writing; critical=true means CRITICAL queue, false means BULK.
     void enqueueWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
         std::shared_ptr<const std::string> data,
-        bool critical);
-    /// Kick off the next async_write; must be called on the queue's strand.
+        bool critical,
+        std::vector<int> entityIds = {});
+    /// Drop queued bulk packets whose entities are all covered by entityIds (on the strand).
+    void supersedeBulk(SocketWriteQueue &queue, const std::vector<int> &entityIds);
+    /// Backlog over maxQueued: drop oldest packets fully covered by newer ones or incomingIds (on the strand).
+    void dropCoveredBulk(SocketWriteQueue &queue, const std::vector<int> &incomingIds, size_t incomingBytes,
+        size_t maxQueued);
+    /// Add the budget earned since the last refill (on the strand); returns the bytes/sec budget.
+    size_t refillBudget(SocketWriteQueue &queue);
+    /// Retry the bulk lane once the budget has refilled (on the strand).
+    void schedulePacedWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+        std::shared_ptr<SocketWriteQueue> queue);
+    /// Cache the network.* egress keys from game config.
+    void applyEgressConfig(const GameConfigService &config);
+    /// Gather the next batch of queued packets and start writing it; must be called on the queue's strand.
     void doNextWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
         std::shared_ptr<SocketWriteQueue> queue);
+    /// Write queue->gather; continues with the unsent tail after a partial write (on the strand).
+    void writeGather(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+        std::shared_ptr<SocketWriteQueue> queue);
+
+    std::atomic<uint64_t> writeFlushes_{0};
+    std::atomic<uint64_t> writeSyscalls_{0};
+    std::atomic<uint64_t> writePackets_{0};
+    std::atomic<uint64_t> writeBytes_{0};
+    std::atomic<uint64_t> writeMaxPacketsPerFlush_{0};
+    std::atomic<uint64_t> supersededBytes_{0};
+    std::atomic<uint64_t> droppedBytes_{0};
+    std::atomic<uint64_t> pacedWaits_{0};
+    std::atomic<size_t> binaryWireSockets_{0};
+
+    std::atomic<size_t> clientBudgetBytesPerSec_{256 * 1024};
+    std::atomic<int> bulkStaleMs_{250};
+    std::atomic<int> bulkMaxQueuedSec_{2};
 
     std::unordered_map<boost::asio::ip::tcp::socket *, std::shared_ptr<SocketWriteQueue>> writeQueues_;
     std::mutex writeQueuesMutex_;
@@ -0,0 +1,109 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include <boost/asio.hpp>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+class NetworkManager;
+
+/// One pre-serialized piece of world state (an NPC, a spawn zone, a ground item, ...).
+struct WorldSnapshotFragment
+{
+    int id = 0;                    ///< entity id: NPC id, zone id, drop uid, character id
+    float x = 0.0f;                ///< world position used for radius filtering and priority
+    float y = 0.0f;
+    std::string json;              ///< serialized JSON value
+    std::string extra;             ///< optional second value (e.g. a character's equipment state)
+    std::vector<std::string> refs; ///< per-viewer inputs kept out of json (e.g. an NPC's quest slugs)
+    int ownerClientId = 0;         ///< client the entity belongs to (characters)
+};
+
+/**
+ * @brief Versioned, pre-serialized snapshot of one world-state section.
+ *
+ * Built on first use and shared by every join until it is stale:
+ *  - the section's source version changed (membership: spawns, deaths,
+ *    drops, pickups, logins, logouts, equipment changes), or
+ *  - it is older than maxAgeMs (continuous state such as positions and HP,
+ *    which joining clients also receive as live deltas afterwards).
+ *
+ * get() builds under the section lock, so a login wave pays for one build
+ * and every other join waits for it instead of building its own copy.
+ */
+class WorldSnapshotSection
+{
+  public:
+    using Fragments = std::vector<WorldSnapshotFragment>;
+    using Builder = std::function<void(Fragments &)>;
+
+    explicit WorldSnapshotSection(int64_t maxAgeMs)
+        : maxAgeMs_(maxAgeMs)
+    {
+    }
+
+    /// Current fragments; rebuilt with build() if sourceVersion or the age says so.
+    std::shared_ptr<const Fragments> get(uint64_t sourceVersion, const Builder &build);
+
+  private:
+    std::mutex mutex_;
+    std::shared_ptr<const Fragments> fragments_;
+    uint64_t builtSourceVersion_ = 0;
+    int64_t builtAtMs_ = 0;
+    const int64_t maxAgeMs_;
+};
+
+/**
+ * @brief Orders one client's world-state packets nearest first and sends them.
+ *
+ * Packets within nearRadius of the player go out on the critical lane, ahead of
+ * the playerReady ack; farther ones follow on the bulk lane, which is paced by
+ * the client's egress budget (NetworkManager) instead of being pushed in one burst.
+ */
+class WorldSnapshotStream
+{
+  public:
+    explicit WorldSnapshotStream(const PositionStruct &origin)
+        : originX_(origin.positionX),
+          originY_(origin.positionY)
+    {
+    }
+
+    float distanceSq(float x, float y) const
+    {
+        const float dx = x - originX_;
+        const float dy = y - originY_;
+        return dx * dx + dy * dy;
+    }
+
+    /**
+     * @brief Queue a packet whose nearest content is at (x, y).
+     * @param critical Always on the critical lane and ahead of non-critical
+     *                 packets, e.g. a list that later packets refer to.
+     */
+    void add(float x, float y, std::string packet, bool critical = false);
+
+    /// Send critical packets, then the rest nearest first; nearRadius < 0 sends everything on the critical lane.
+    void send(NetworkManager &networkManager, const std::shared_ptr<boost::asio::ip::tcp::socket> &socket, float nearRadius);
+
+    size_t size() const
+    {
+        return packets_.size();
+    }
+
+  private:
+    struct Packet
+    {
+        float distanceSq = 0.0f;
+        bool critical = false;
+        std::shared_ptr<const std::string> data;
+    };
+
+    float originX_;
+    float originY_;
+    std::vector<Packet> packets_;
+};
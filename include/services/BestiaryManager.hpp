@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/DataStructs.hpp"
+#include "services/PersistenceJournal.hpp"
 #include <functional>
 #include <nlohmann/json.hpp>
 #include <shared_mutex>
@@ -22,7 +23,7 @@ class logger;
  * and persisted back to the game-server via saveCallback_ on each kill.
  *
  * Reveal tiers are calculated against thresholds supplied via setThresholds()
- * (called when game config arrives from the game-server).
+ * (pushed by a GameConfigService subscription whenever game config arrives).
  *
  * Thread-safety: all public methods are protected by a shared_mutex.
  */
@@ -114,7 +115,7 @@ class BestiaryManager
     /**
      * @brief Set the callback used to persist a bestiary entry to the game-server.
      */
-    void setSaveCallback(std::function<void(const std::string &)> callback);
+    void setSaveCallback(PersistWriteCallback callback);
 
     /**
      * @brief Set the callback invoked when a new bestiary tier is unlocked.
@@ -142,7 +143,7 @@ class BestiaryManager
 
     std::vector<int> thresholds_;
 
-    std::function<void(const std::string &)> saveCallback_;
+    PersistWriteCallback saveCallback_;
     std::function<void(int, int, int, int, const std::string &)> notifyCallback_;
     std::function<void(int, int, int)> killUpdateCallback_;
 
@@ -1,13 +1,26 @@
 #pragma once
 
 #include "data/DataStructs.hpp"
+#include <atomic>
+#include <chrono>
 #include <iostream>
+#include <queue>
 #include <shared_mutex>
 #include <unordered_map>
 #include <unordered_set>
+#include <functional>
 #include <utils/Logger.hpp>
+#include <utils/SpatialHashGrid.hpp>
 #include <vector>
 
+// Lightweight hit of a character range query (no attribute/effect copies).
+struct CharacterRangeHit
+{
+    int characterId = 0;
+    PositionStruct position;
+    float distanceSq = 0.0f; // squared distance to the query center
+};
+
 class CharacterManager
 {
   public:
@@ -39,6 +52,13 @@ class CharacterManager
     // Get characters list
     std::vector<CharacterDataStruct> getCharactersList();
 
+    // Bumped when a character is added, removed or reloaded (world snapshot invalidation);
+    // position changes do not bump it
+    uint64_t getMembershipVersion() const
+    {
+        return membershipVersion_.load(std::memory_order_relaxed);
+    }
+
     // Get basic character data by character ID
     CharacterDataStruct getCharacterData(int characterID);
 
@@ -102,18 +122,38 @@ class CharacterManager
     // Replace attributes in-place (used for refresh after level-up / equip change)
     void replaceCharacterAttributes(int characterID, std::vector<CharacterAttributeStruct> attributes);
 
-    // Tick all active DoT/HoT effects for every loaded character.
-    // Applies health changes in-place and removes effects that have expired.
+    // Replace the equipped-item bonus layer of the stat sheet (called by EquipmentManager)
+    void setCharacterEquipmentBonuses(int characterID, std::vector<CharacterAttributeStruct> bonuses);
+
+    // Get the compiled stat sheet, recompiling it first if a timed effect has expired
+    CharacterStatSheet getCharacterStatSheet(int characterID);
+
+    // Tick DoT/HoT effects and remove expired effects whose time has come.
+    // Only characters whose next effect deadline has passed are visited.
     // Returns tick events to broadcast, and the set of character IDs whose
     // expired effects were removed (so callers can send stats_update).
     std::pair<std::vector<EffectTickResult>, std::unordered_set<int>> processEffectTicks();
 
+    // Called (outside the lock) with the next effect deadline whenever it moves earlier;
+    // the owner arms a timer that runs processEffectTicks() at that time.
+    void setEffectTimerCallback(std::function<void(std::chrono::steady_clock::time_point)> callback);
+
     // Remove all expired active effects from a character (expiresAt != 0 && <= now).
     void removeExpiredActiveEffects(int characterID);
 
-    // Get characters in a specific zone
+    // Get alive characters within radius (full copies; prefer the two queries below on hot paths)
     std::vector<CharacterDataStruct> getCharactersInZone(float centerX, float centerY, float radius);
 
+    // Get {id, position, distanceSq} of alive characters within radius, served from the cell index.
+    std::vector<CharacterRangeHit> getCharactersInRange(float centerX, float centerY, float radius) const;
+
+    // Visit alive characters within radius in place. The visitor runs under the shared
+    // lock and must not call back into CharacterManager.
+    void forEachCharacterInRange(float centerX,
+        float centerY,
+        float radius,
+        const std::function<void(const CharacterDataStruct &, float)> &visitor) const;
+
     // Get character by ID (returns empty struct if not found)
     CharacterDataStruct getCharacterById(int characterID);
 
@@ -138,6 +178,31 @@ class CharacterManager
     /// Previously std::vector with O(N) linear search — 200K iterations/s at 2K players.
     std::unordered_map<int, CharacterDataStruct> charactersMap_;
 
-    // Mutex for charactersMap_
+    // XY cell index over charactersMap_ positions, kept in sync on every write
+    // (add/load/remove/setCharacterPosition) so range queries only visit nearby cells.
+    SpatialHashGrid positionGrid_;
+
+    // Mutex for charactersMap_, positionGrid_ and the effect deadlines below
     mutable std::shared_mutex mutex_;
+    std::atomic<uint64_t> membershipVersion_{1};
+
+    using EffectClock = std::chrono::steady_clock;
+    using EffectDeadline = std::pair<EffectClock::time_point, int>; // (due, characterId)
+
+    // Next DoT/HoT tick or expiry per character with timed effects (min-heap).
+    // Stale entries (effect removed, character gone) cost one no-op visit.
+    std::priority_queue<EffectDeadline, std::vector<EffectDeadline>, std::greater<EffectDeadline>> effectDeadlines_;
+    EffectClock::time_point effectTimerArmedAt_ = EffectClock::time_point::max();
+    std::function<void(EffectClock::time_point)> effectTimerCallback_;
+
+    // Queue the character's next effect deadline (lock held). Returns the time to
+    // arm the effect timer at, or time_point::max() when an earlier one is armed.
+    EffectClock::time_point queueEffectDeadlineLocked(const CharacterDataStruct &character);
+
+    // Invoke effectTimerCallback_ unless due is time_point::max(); call without the lock.
+    void armEffectTimer(EffectClock::time_point due);
+
+    // Rebuild character.statSheet from its attributes, equipment bonuses and effects (lock held).
+    // Called by every writer of those three inputs; nothing else invalidates the sheet.
+    void compileStatSheetLocked(CharacterDataStruct &character, int64_t nowSec);
 };
\ No newline at end of file
@@ -43,6 +43,10 @@ class ClientManager
     // Pass excludeClientId = -1 to include all sockets.
     std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> getActiveSockets(int excludeClientId = -1) const;
 
+    // Sockets for a specific set of clients (interest-filtered broadcasts).
+    // One shared_lock for the whole list; unknown IDs are skipped.
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> getSocketsForClients(const std::vector<int> &clientIds) const;
+
     // Remove dead sockets — call from Scheduler (e.g. every 30s), NOT from hot broadcast path
     void cleanupDeadSockets();
 
@@ -52,6 +56,9 @@ class ClientManager
     // Get client data by character ID (for accountId lookups)
     ClientDataStruct getClientDataByCharacterId(int characterId);
 
+    // Character bound to a client, 0 if none yet (per-event lane routing; no struct copy)
+    int getCharacterIdByClientId(int clientID) const;
+
     // Get Client Socket by client ID
     std::shared_ptr<boost::asio::ip::tcp::socket> getClientSocket(int clientID);
 
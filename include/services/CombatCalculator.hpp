@@ -64,12 +64,12 @@ class CombatCalculator
     /**
      * @brief Рассчитать базовый урон скила
      * @param skill Скил
-     * @param attackerAttributes Атрибуты атакующего
+     * @param attackerStats Статы атакующего (база + активные эффекты)
      * @return Базовый урон
      */
     int calculateBaseDamage(
         const SkillStruct &skill,
-        const std::vector<CharacterAttributeStruct> &attackerAttributes);
+        const CharacterStatSheet &attackerStats);
 
     /**
      * @brief Рассчитать базовый урон скила моба
@@ -84,7 +84,7 @@ class CombatCalculator
     /**
      * @brief Проверить критический удар персонажа
      */
-    bool rollCriticalHit(const std::vector<CharacterAttributeStruct> &attackerAttributes);
+    bool rollCriticalHit(const CharacterStatSheet &attackerStats);
 
     /**
      * @brief Проверить критический удар моба
@@ -94,15 +94,15 @@ class CombatCalculator
     /**
      * @brief Проверить блокирование
      */
-    bool rollBlock(const std::vector<CharacterAttributeStruct> &targetAttributes);
+    bool rollBlock(const CharacterStatSheet &targetStats);
 
     /**
      * @brief Проверить промах персонажа по персонажу
      * @param hitModifier Дополнительный бонус/штраф к шансу попадания (level diff)
      */
     bool rollMiss(
-        const std::vector<CharacterAttributeStruct> &attackerAttributes,
-        const std::vector<CharacterAttributeStruct> &targetAttributes,
+        const CharacterStatSheet &attackerStats,
+        const CharacterStatSheet &targetStats,
         float hitModifier = 0.0f);
 
     /**
@@ -111,24 +111,24 @@ class CombatCalculator
      */
     bool rollMiss(
         const std::vector<MobAttributeStruct> &attackerAttributes,
-        const std::vector<CharacterAttributeStruct> &targetAttributes,
+        const CharacterStatSheet &targetStats,
         float hitModifier = 0.0f);
 
     /**
      * @brief Получить значение атрибута по slug
      * @param attributes Список атрибутов
-     * @param slug Slug атрибута
+     * @param slugId Интернированный slug атрибута
      * @return Значение атрибута (0 если не найден)
      */
-    int getAttributeValue(const std::vector<CharacterAttributeStruct> &attributes, const std::string &slug);
+    int getAttributeValue(const std::vector<CharacterAttributeStruct> &attributes, SymbolId slugId);
 
     /**
      * @brief Получить значение атрибута моба по slug
      * @param attributes Список атрибутов моба
-     * @param slug Slug атрибута
+     * @param slugId Интернированный slug атрибута
      * @return Значение атрибута (0 если не найден)
      */
-    int getAttributeValue(const std::vector<MobAttributeStruct> &attributes, const std::string &slug);
+    int getAttributeValue(const std::vector<MobAttributeStruct> &attributes, SymbolId slugId);
 
     /**
      * @brief Применить защиту к урону
@@ -145,19 +145,34 @@ class CombatCalculator
      */
     int applyDefense(int damage, int defenseValue, const std::string &damageType, int targetLevel);
 
-    /**
-     * @brief Применить неистёкшие stat-modifier эффекты к базовым атрибутам.
-     *        DoT/HoT пропускаются (они обрабатываются отдельно через tickEffects).
-     *        Используется перед любым расчётом урона/лечения.
-     */
-    std::vector<CharacterAttributeStruct> mergeEffects(const CharacterDataStruct &character) const;
-
   private:
     std::random_device rd_;
     std::mt19937 gen_;
     std::uniform_real_distribution<float> dis_;
     GameConfigService *gameConfig_ = nullptr; ///< nullable, reads gameplay constants
 
+    /// Config keys resolved once in setGameConfigService(); read per hit.
+    struct ConfigKeys
+    {
+        GameConfigKey levelDiffCap;
+        GameConfigKey levelDiffHitPerLevel;
+        GameConfigKey levelDiffDamagePerLevel;
+        GameConfigKey defaultCritMultiplier;
+        GameConfigKey maxResistanceCap;
+        GameConfigKey healVariance;
+        GameConfigKey damageVariance;
+        GameConfigKey critChanceCap;
+        GameConfigKey blockChanceCap;
+        GameConfigKey baseHitChance;
+        GameConfigKey hitChanceMin;
+        GameConfigKey hitChanceMax;
+        GameConfigKey defenseFormulaK;
+        GameConfigKey defenseCap;
+    } keys_;
+
     /// @brief Reads float constant from config if loaded, otherwise returns defaultValue.
-    float cfg(const std::string &key, float defaultValue) const;
+    float cfg(GameConfigKey key, float defaultValue) const;
+
+    /// @brief Unix seconds, used to check stat sheets against effect expiry.
+    static int64_t unixNowSec();
 };
@@ -4,9 +4,14 @@
 #include "data/DataStructs.hpp"
 #include "data/SkillStructs.hpp"
 #include "services/CombatResponseBuilder.hpp"
+#include "services/PersistenceJournal.hpp"
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
 
 // Forward declarations
 namespace spdlog
@@ -44,13 +49,20 @@ class CombatSystem
     void clearOngoingAction(int casterId);
 
     /**
-     * @brief Обновить ongoing actions
+     * @brief Завершить касты, время которых наступило.
+     *        Просматривает только дедлайны из min-heap, а не всех кастеров.
      */
     std::vector<SkillExecutionResult> updateOngoingActions();
 
     /**
-     * @brief Обработать тики всех активных DoT/HoT эффектов.
-     *  Вызывается каждый игровой тик из CombatEventHandler.
+     * @brief Callback с моментом завершения каждого нового каста.
+     *        Владелец таймеров планирует на это время вызов updateOngoingActions().
+     */
+    void setCastTimerCallback(std::function<void(std::chrono::steady_clock::time_point)> callback);
+
+    /**
+     * @brief Обработать тики DoT/HoT эффектов, время которых наступило.
+     *  Вызывается по таймеру эффектов (CharacterManager::setEffectTimerCallback).
      *  Применяет урон/лечение, удаляет истёкшие эффекты,
      *  рассылает broadcast-пакеты "effectTick".
      */
@@ -89,7 +101,7 @@ class CombatSystem
     /**
      * @brief Set callback for persisting durability changes to the game server
      */
-    void setSaveDurabilityCallback(std::function<void(const std::string &)> callback);
+    void setSaveDurabilityCallback(PersistWriteCallback callback);
 
     /**
      * @brief Set callback for triggering character attribute refresh (e.g. on durability threshold crossing)
@@ -100,7 +112,7 @@ class CombatSystem
     /**
      * @brief Set callback for persisting Item Soul kill_count to the game server.
      */
-    void setSaveItemKillCountCallback(std::function<void(const std::string &)> callback);
+    void setSaveItemKillCountCallback(PersistWriteCallback callback);
 
     /**
      * @brief Restore a persisted skill cooldown for a player (called on character join).
@@ -116,19 +128,27 @@ class CombatSystem
 
     // Ongoing actions: casterId -> action data
     std::unordered_map<int, std::shared_ptr<CombatActionStruct>> ongoingActions_;
-    mutable std::mutex actionsMutex_; // protects ongoingActions_
+    mutable std::mutex actionsMutex_; // protects ongoingActions_ and castDeadlines_
+
+    // Min-heap (endTime, casterId) of pending casts. An entry whose action was
+    // interrupted or replaced is skipped when it comes due.
+    using CastDeadline = std::pair<std::chrono::steady_clock::time_point, int>;
+    std::priority_queue<CastDeadline, std::vector<CastDeadline>, std::greater<CastDeadline>> castDeadlines_;
+
+    // Arms a timer for a cast's endTime (set by ChunkServer)
+    std::function<void(std::chrono::steady_clock::time_point)> castTimerCallback_;
 
     // Callback для отправки broadcast пакетов
     std::function<void(const nlohmann::json &)> broadcastCallback_;
 
     // Callback for persisting durability changes to game server
-    std::function<void(const std::string &)> saveDurabilityCallback_;
+    PersistWriteCallback saveDurabilityCallback_;
 
     // Callback for triggering attribute refresh when durability crosses warning threshold
     std::function<void(int)> refreshAttributesCallback_;
 
     // Callback for persisting Item Soul kill_count to game server
-    std::function<void(const std::string &)> saveItemKillCountCallback_;
+    PersistWriteCallback saveItemKillCountCallback_;
 
     /** Fire refreshAttributesCallback_ if durability just crossed the warning threshold. */
     void checkAndTriggerDurabilityWarning(int characterId, int oldDur, int newDur, int maxDur);
@@ -5,6 +5,7 @@
 #include "services/InventoryManager.hpp"
 #include "services/ItemManager.hpp"
 #include "utils/Logger.hpp"
+#include <atomic>
 #include <nlohmann/json.hpp>
 #include <optional>
 #include <shared_mutex>
@@ -97,6 +98,12 @@ class EquipmentManager
      */
     nlohmann::json buildEquipmentStateJson(int characterId) const;
 
+    /** Bumped on every equip / unequip / rebuild / clear (world snapshot invalidation). */
+    uint64_t getVersion() const
+    {
+        return version_.load(std::memory_order_relaxed);
+    }
+
     /** Returns the CharacterEquipmentStruct copy for external use (read-only snapshot). */
     CharacterEquipmentStruct getEquipmentState(int characterId) const;
 
@@ -124,6 +131,7 @@ class EquipmentManager
 
     std::shared_ptr<spdlog::logger> log_;
     mutable std::shared_mutex mutex_;
+    std::atomic<uint64_t> version_{1};
 
     std::unordered_map<int, CharacterEquipmentStruct> equipment_; // characterId → state
 
@@ -137,6 +145,9 @@ class EquipmentManager
 
     float getWarningThreshold() const;
 
+    // apply_on == "equip" item attributes of every occupied slot (equipment lock held).
+    std::vector<CharacterAttributeStruct> collectEquipBonusesLocked(const CharacterEquipmentStruct &equip) const;
+
     // Inline helpers
     static std::string errorToString(EquipError e);
     static std::string errorToString(UnequipError e);
@@ -1,9 +1,68 @@
 #pragma once
 #include "utils/Logger.hpp"
-#include <shared_mutex>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <stdexcept>
 #include <string>
 #include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Ключ конфига, заранее разрешённый в слот снапшота (GameConfigService::key()).
+ *
+ * Чтение через ключ — индекс в массиве, без хеширования строки.
+ */
+struct GameConfigKey
+{
+    uint32_t slot = UINT32_MAX;
+};
+
+/// Значение конфига, разобранное один раз при публикации снапшота.
+struct GameConfigValue
+{
+    std::string key;
+    std::string raw;
+    float floatValue = 0.0f;
+    int intValue = 0;
+    bool boolValue = false;
+    bool hasFloat = false;
+    bool hasInt = false;
+    bool hasBool = false;
+};
+
+/**
+ * @brief Неизменяемый снапшот конфига.
+ *
+ * Строится целиком в setConfig()/key() и публикуется атомарной заменой указателя;
+ * после публикации не меняется, поэтому читается без блокировок.
+ */
+class GameConfigSnapshot
+{
+  public:
+    /// nullptr если ключа нет в конфиге.
+    const GameConfigValue *find(const std::string &key) const;
+    const GameConfigValue *at(GameConfigKey key) const
+    {
+        return key.slot < slots_.size() ? slots_[key.slot] : nullptr;
+    }
+    bool empty() const
+    {
+        return entries_.empty();
+    }
+    size_t size() const
+    {
+        return entries_.size();
+    }
+
+  private:
+    friend class GameConfigService;
+
+    std::unordered_map<std::string, GameConfigValue> entries_;
+    std::vector<const GameConfigValue *> slots_; // index = GameConfigKey::slot; nullptr = ключ не задан
+};
 
 /**
  * @brief Сервис геймплейной конфигурации на стороне chunk-server.
@@ -11,24 +70,46 @@
  * Получает конфиг от game-server при старте (setConfig) и при runtime-reload.
  * Предоставляет типизированные геттеры с дефолтным значением — никогда не бросает.
  *
- * Потокобезопасен: setConfig блокирует на запись,
- * get* блокируют на чтение (shared_mutex).
+ * Значения разбираются (stof/stoi/bool) один раз при setConfig и публикуются
+ * неизменяемым снапшотом (RCU): читатели не берут блокировок. Горячие пути
+ * разрешают ключи в слоты заранее через key() и читают по GameConfigKey.
+ * Старые снапшоты не освобождаются до уничтожения сервиса — reload конфига
+ * редкое событие, а читателям не нужно ничего удерживать.
+ *
+ * Подсистемы, которым нужно пересчитать что-то при смене конфига, регистрируют
+ * subscribe() вместо периодического опроса.
  *
  * Пример использования:
  *   float k   = config.getFloat("combat.defense_formula_k", 7.5f);
- *   int   cap = config.getInt("aggro.base_radius", 500);
+ *   auto  key = config.key("aggro.base_radius");      // один раз, при инициализации
+ *   int   cap = config.getInt(key, 500);              // в горячем пути
  */
 class GameConfigService
 {
   public:
+    using ChangeListener = std::function<void(const GameConfigService &)>;
+
     explicit GameConfigService(Logger &logger);
 
     /**
      * @brief Принять конфиг, пришедший от game-server (setGameConfig event).
      * @param config key→value map (значения — строки, тип закодирован на DB стороне)
+     *
+     * Публикует новый снапшот, затем вызывает подписчиков (вне блокировки).
      */
     void setConfig(const std::unordered_map<std::string, std::string> &config);
 
+    /**
+     * @brief Разрешить ключ в слот. Вызывается при инициализации подсистем;
+     *        повторный вызов с тем же именем возвращает тот же слот.
+     */
+    GameConfigKey key(const std::string &name);
+
+    /**
+     * @brief Подписаться на смену конфига. Вызывается из потока setConfig().
+     */
+    void subscribe(ChangeListener listener);
+
     // ----------------------------------------------------------------
     // Типизированные геттеры. Все возвращают defaultValue при отсутствии ключа
     // или ошибке конвертации — сервер не должен падать из-за конфига.
@@ -39,13 +120,37 @@ class GameConfigService
     bool getBool(const std::string &key, bool defaultValue = false) const;
     std::string getString(const std::string &key, const std::string &defaultValue = "") const;
 
+    float getFloat(GameConfigKey key, float defaultValue = 0.0f) const;
+    int getInt(GameConfigKey key, int defaultValue = 0) const;
+    bool getBool(GameConfigKey key, bool defaultValue = false) const;
+
+    /** @brief Текущий снапшот (валиден до уничтожения сервиса). */
+    const GameConfigSnapshot &snapshot() const
+    {
+        return *current_.load(std::memory_order_acquire);
+    }
+
     /** @brief Проверить, загружен ли конфиг (getAll вернёт непустой map). */
     bool isLoaded() const;
 
   private:
+    /// Build a snapshot from raw_ + keyNames_ and publish it (writeMutex_ held).
+    void publishLocked();
+
+    float readFloat(const GameConfigValue *value, float defaultValue) const;
+    int readInt(const GameConfigValue *value, int defaultValue) const;
+    bool readBool(const GameConfigValue *value, bool defaultValue) const;
+
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;
 
-    mutable std::shared_mutex mutex_;
-    std::unordered_map<std::string, std::string> config_;
+    std::atomic<const GameConfigSnapshot *> current_{nullptr};
+
+    // Writer side: setConfig/key/subscribe serialise on writeMutex_.
+    std::mutex writeMutex_;
+    std::unordered_map<std::string, std::string> raw_;
+    std::vector<std::string> keyNames_; // index = slot
+    std::unordered_map<std::string, uint32_t> keySlots_;
+    std::vector<std::unique_ptr<const GameConfigSnapshot>> snapshots_; // every snapshot ever published
+    std::vector<ChangeListener> listeners_;
 };
@@ -16,6 +16,7 @@
 #include "services/GameConfigService.hpp"
 #include "services/GameZoneManager.hpp"
 #include "services/HarvestManager.hpp"
+#include "services/InterestManager.hpp"
 #include "services/InventoryManager.hpp"
 #include "services/ItemManager.hpp"
 #include "services/LootManager.hpp"
@@ -24,6 +25,8 @@
 #include "services/MobManager.hpp"
 #include "services/MobMovementManager.hpp"
 #include "services/NPCManager.hpp"
+#include "services/NavigationManager.hpp"
+#include "services/PersistenceJournal.hpp"
 #include "services/PityManager.hpp"
 #include "services/QuestManager.hpp"
 #include "services/RegenManager.hpp"
@@ -56,6 +59,7 @@ class GameServices
           mobMovementManager_(logger_),
           spawnZoneManager_(mobManager_, logger_),
           characterManager_(logger_),
+          interestManager_(logger_),
           clientManager_(logger_),
           chunkManager_(logger_),
           lootManager_(itemManager_, logger_),
@@ -70,12 +74,14 @@ class GameServices
           experienceCacheManager_(this),
           statsNotificationService_(this),
           gameConfigService_(logger_),
+          persistenceJournal_(logger_),
           vendorManager_(itemManager_, logger_),
           trainerManager_(itemManager_, logger_),
           tradeSessionManager_(logger_),
           equipmentManager_(inventoryManager_, itemManager_, characterManager_, logger_),
           respawnZoneManager_(logger_),
           gameZoneManager_(logger_),
+          navigationManager_(logger_),
           statusEffectTemplateManager_(logger_),
           regenManager_(this),
           pityManager_(logger_),
@@ -94,6 +100,7 @@ class GameServices
         mobMovementManager_.setMobInstanceManager(&mobInstanceManager_);
         mobMovementManager_.setSpawnZoneManager(&spawnZoneManager_);
         mobMovementManager_.setCharacterManager(&characterManager_);
+        mobMovementManager_.setNavigationManager(&navigationManager_);
 
         // Set up harvest manager dependencies
         harvestManager_.setInventoryManager(&inventoryManager_);
@@ -101,6 +108,18 @@ class GameServices
         // Set up equipment manager dependencies
         equipmentManager_.setGameConfigService(&gameConfigService_);
 
+        // View radius / hysteresis for area-of-interest filtering
+        interestManager_.setGameConfigService(&gameConfigService_);
+
+        // Bestiary tier thresholds follow every SET_GAME_CONFIG
+        gameConfigService_.subscribe([this](const GameConfigService &cfg)
+            { bestiaryManager_.setThresholds({cfg.getInt("bestiary.tier1_kills", 1),
+                  cfg.getInt("bestiary.tier2_kills", 5),
+                  cfg.getInt("bestiary.tier3_kills", 15),
+                  cfg.getInt("bestiary.tier4_kills", 30),
+                  cfg.getInt("bestiary.tier5_kills", 75),
+                  cfg.getInt("bestiary.tier6_kills", 150)}); });
+
         // Wire loot manager dependencies (pity)
         lootManager_.setPityManager(&pityManager_);
         lootManager_.setGameServices(this);
@@ -134,6 +153,10 @@ class GameServices
     {
         return characterManager_;
     }
+    InterestManager &getInterestManager()
+    {
+        return interestManager_;
+    }
     ClientManager &getClientManager()
     {
         return clientManager_;
@@ -190,6 +213,10 @@ class GameServices
     {
         return gameConfigService_;
     }
+    PersistenceJournal &getPersistenceJournal()
+    {
+        return persistenceJournal_;
+    }
     VendorManager &getVendorManager()
     {
         return vendorManager_;
@@ -214,6 +241,10 @@ class GameServices
     {
         return gameZoneManager_;
     }
+    NavigationManager &getNavigationManager()
+    {
+        return navigationManager_;
+    }
     StatusEffectTemplateManager &getStatusEffectTemplateManager()
     {
         return statusEffectTemplateManager_;
@@ -302,12 +333,14 @@ class GameServices
   private:
     Logger &logger_;
     GameConfigService gameConfigService_; // FIRST: initialized before all managers
+    PersistenceJournal persistenceJournal_; // before any manager that stages writes
     MobManager mobManager_;
     ItemManager itemManager_;
     MobInstanceManager mobInstanceManager_;
     MobMovementManager mobMovementManager_;
     SpawnZoneManager spawnZoneManager_;
     CharacterManager characterManager_;
+    InterestManager interestManager_;
     ClientManager clientManager_;
     ChunkManager chunkManager_;
     LootManager lootManager_;
@@ -327,6 +360,7 @@ class GameServices
     EquipmentManager equipmentManager_;
     RespawnZoneManager respawnZoneManager_;
     GameZoneManager gameZoneManager_;
+    NavigationManager navigationManager_;
     StatusEffectTemplateManager statusEffectTemplateManager_;
     RegenManager regenManager_;
     PityManager pityManager_;
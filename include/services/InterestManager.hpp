@@ -0,0 +1,161 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include "services/GameConfigService.hpp"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+#include <utils/Logger.hpp>
+#include <vector>
+
+/// A player that entered or left another player's view.
+struct InterestPeer
+{
+    int characterId = 0;
+    int clientId = 0;
+};
+
+/// Visibility changes produced by one InterestManager::updateCharacter call.
+/// Pairs are symmetric: every peer in `entered` now sees the mover and vice versa.
+struct InterestDelta
+{
+    std::vector<InterestPeer> entered;
+    std::vector<InterestPeer> left;
+    uint64_t sequence = 0; ///< delivery ticket for InterestManager::deliverInOrder (non-empty deltas only)
+
+    bool empty() const
+    {
+        return entered.empty() && left.empty();
+    }
+};
+
+/// Position of a live mob for one mob-visibility pass.
+struct MobViewPoint
+{
+    int uid = 0;
+    float x = 0.0f;
+    float y = 0.0f;
+};
+
+/// Mob visibility of one client after InterestManager::updateMobVisibility.
+struct ClientMobView
+{
+    int clientId = 0;
+    std::vector<int> visibleUids; // sorted
+    std::vector<int> enteredUids;
+    std::vector<int> leftUids;
+};
+
+/**
+ * @brief Area-of-interest tracking for online players.
+ *
+ * Players are bucketed in a uniform XY grid (cell size = leave radius) fed from
+ * the same positions that CharacterManager stores. Each player keeps a symmetric
+ * list of peers in view, so player-scoped broadcasts (movement, emotes,
+ * equipment, titles) only reach clients that can actually see the player.
+ *
+ * Enter/leave use hysteresis: a peer enters at viewRadius and only leaves past
+ * viewRadius + hysteresis, so players walking along the boundary do not
+ * flicker between spawn and despawn.
+ *
+ * Mob visibility is tracked per player with the same radii; the unified mob
+ * tick feeds live mob positions once per pass (updateMobVisibility).
+ *
+ * Deltas are computed under the lock but their packets are sent afterwards,
+ * from whichever event lane moved the player. Every non-empty delta therefore
+ * carries a sequence number, and deliverInOrder() hands the packets to the
+ * network in that order, so an enter and a later leave for the same pair can
+ * never reach a client reversed.
+ *
+ * Turning filtering off at runtime (view_radius <= 0) clears every view list,
+ * so re-enabling it starts from scratch and re-sends enter snapshots.
+ *
+ * Config keys consumed (with defaults):
+ *   interest.view_radius  (default 10000) – enter radius; <= 0 disables filtering
+ *   interest.hysteresis   (default 1500)  – extra distance before a peer leaves view
+ */
+class InterestManager
+{
+  public:
+    explicit InterestManager(Logger &logger);
+
+    void setGameConfigService(GameConfigService *gameConfigService);
+
+    /// False when interest.view_radius <= 0: callers fall back to broadcast-to-all.
+    bool isEnabled() const;
+
+    /**
+     * @brief Insert or move a player and recompute which peers are in view.
+     *
+     * @return Peers that entered/left view of this player (empty when disabled).
+     */
+    InterestDelta updateCharacter(int characterId, int clientId, const PositionStruct &position);
+
+    /**
+     * @brief Run send() for a delta once every earlier delta has been delivered.
+     *
+     * Must be called exactly once for each non-empty delta, even if building its
+     * packets fails (send() may throw; the ticket is released either way).
+     */
+    void deliverInOrder(uint64_t sequence, const std::function<void()> &send);
+
+    /// Drop a player from the grid and from every peer's view list.
+    void removeCharacter(int characterId);
+
+    /**
+     * @brief Client IDs that should receive a packet about this player.
+     *
+     * Returns every peer currently in view plus the player's own client.
+     * An unregistered player (not yet in world) has no recipients.
+     */
+    std::vector<int> getRecipientClientIds(int characterId, int excludeClientId = -1) const;
+
+    /**
+     * @brief Recompute which mobs every registered player can see.
+     *
+     * @param mobs Live mobs this pass; mobs missing from the list leave view.
+     *             Dead mobs are missing too, so callers drop those from
+     *             leftUids (the client learns about them from mobDeath).
+     * @return One view per player whose visible set is non-empty or changed
+     *         (empty when disabled).
+     */
+    std::vector<ClientMobView> updateMobVisibility(const std::vector<MobViewPoint> &mobs);
+
+  private:
+    struct Entry
+    {
+        int clientId = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+        int64_t cellKey = 0;
+        std::vector<int> visible; // character IDs in view (symmetric)
+        std::vector<int> visibleMobs; // mob UIDs in view (sorted)
+    };
+
+    bool readRadii(float &viewRadius, float &leaveRadius) const;
+    void clearViewsLocked();
+    int64_t cellKeyFor(float x, float y) const;
+    void rebuildGridLocked(float cellSize);
+    void unlinkLocked(int characterId, int peerId);
+
+    Logger &logger_;
+    std::shared_ptr<spdlog::logger> log_;
+    GameConfigService *gameConfigService_ = nullptr;
+    GameConfigKey viewRadiusKey_;
+    GameConfigKey hysteresisKey_;
+
+    std::unordered_map<int, Entry> entries_;
+    std::unordered_map<int64_t, std::vector<int>> cells_;
+    float cellSize_ = 0.0f;
+    uint64_t nextSequence_ = 1;
+
+    mutable std::shared_mutex mutex_;
+
+    std::mutex deliveryMutex_;
+    std::condition_variable deliveryCv_;
+    uint64_t nextDelivery_ = 1;
+};
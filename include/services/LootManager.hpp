@@ -2,6 +2,7 @@
 #include "data/DataStructs.hpp"
 #include "services/ItemManager.hpp"
 #include "utils/Logger.hpp"
+#include <atomic>
 #include <map>
 #include <random>
 #include <shared_mutex>
@@ -88,6 +89,12 @@ class LootManager
      */
     std::map<int, DroppedItemStruct> getAllDroppedItems() const;
 
+    /// Bumped when a dropped item appears or disappears (world snapshot invalidation).
+    uint64_t getMembershipVersion() const
+    {
+        return membershipVersion_.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Get dropped items near a position
      * @param position Center position
@@ -145,6 +152,7 @@ class LootManager
 
     // Thread safety
     mutable std::shared_mutex droppedItemsMutex_;
+    std::atomic<uint64_t> membershipVersion_{1};
 
     // Random number generation for loot drops
     std::random_device randomDevice_;
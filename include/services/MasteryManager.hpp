@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/DataStructs.hpp"
+#include "services/PersistenceJournal.hpp"
 #include "utils/Logger.hpp"
 #include <functional>
 #include <nlohmann/json.hpp>
@@ -78,7 +79,7 @@ class MasteryManager
     void onPlayerAttack(int characterId, const std::string &masterySlug, int charLevel, int targetLevel);
 
     // ── Persistence ────────────────────────────────────────────────────────
-    using SaveCallback = std::function<void(const std::string &)>;
+    using SaveCallback = PersistWriteCallback;
     void setSaveCallback(SaveCallback cb)
     {
         saveCallback_ = std::move(cb);
@@ -0,0 +1,121 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief The movement manager's per-tick output for one mob: velocity and combat state.
+ *
+ * Published by MobMovementManager whenever it writes the mob's MobMovementData,
+ * so the world tick can read it from the store without the movement manager's lock.
+ */
+struct MobMotionState
+{
+    float dirX = 0.0f;
+    float dirY = 0.0f;
+    float speed = 0.0f; ///< units per second
+    MobCombatState combatState = MobCombatState::PATROLLING;
+    int64_t stepTimestampMs = 0; ///< server time of the last movement step
+    bool engaged = false;        ///< has a target, or is returning / fleeing / out of PATROLLING
+};
+
+/**
+ * @brief Read-only view of one mob's hot state, assembled from the store's columns.
+ */
+struct MobHotView
+{
+    int uid = 0;
+    int templateId = 0; ///< MobDataStruct::id — key of the cold template data
+    int zoneId = 0;
+    PositionStruct position;
+    int currentHealth = 0;
+    int maxHealth = 0;
+    bool isDead = false;
+    MobMotionState motion;
+};
+
+/**
+ * @brief Structure-of-arrays store of the per-mob fields the world tick reads.
+ *
+ * Every registered mob owns one dense slot; each field is a separate
+ * contiguous column, so zone scans (movement, replication, alive counts) walk
+ * a few small arrays instead of copying whole MobDataStruct records with their
+ * strings and attribute/skill vectors. Removal moves the last slot into the
+ * hole: slots stay dense but are not stable, so callers keep UIDs, not slots.
+ *
+ * Not synchronized — MobInstanceManager guards it with its own mutex.
+ */
+class MobHotStore
+{
+  public:
+    /// Insert the mob, or overwrite every hot field of an existing one.
+    void sync(const MobDataStruct &mob);
+    void remove(int uid);
+
+    void setPosition(int uid, const PositionStruct &position);
+    void setHealth(int uid, int currentHealth, bool isDead);
+    void setMotion(int uid, const MobMotionState &motion);
+
+    size_t size() const
+    {
+        return uid_.size();
+    }
+
+    size_t zoneSize(int zoneId) const;
+
+    /// Calls fn(slot) for every mob registered to the zone.
+    template <typename Fn>
+    void forEachSlotInZone(int zoneId, Fn &&fn) const
+    {
+        auto it = zoneSlots_.find(zoneId);
+        if (it == zoneSlots_.end())
+            return;
+        for (uint32_t slot : it->second)
+            fn(slot);
+    }
+
+    bool isAlive(uint32_t slot) const
+    {
+        return !dead_[slot] && health_[slot] > 0;
+    }
+
+    int uidAt(uint32_t slot) const
+    {
+        return uid_[slot];
+    }
+
+    PositionStruct positionAt(uint32_t slot) const;
+    MobHotView viewAt(uint32_t slot) const;
+
+  private:
+    void linkToZone(uint32_t slot, int zoneId);
+    void unlinkFromZone(uint32_t slot);
+    void moveSlot(uint32_t from, uint32_t to);
+
+    std::unordered_map<int, uint32_t> slotByUid_;
+
+    // Zone membership: slots per zone, and each slot's index inside its zone list
+    // so removal is O(1). Emptied lists are kept to avoid churn on respawn.
+    std::unordered_map<int, std::vector<uint32_t>> zoneSlots_;
+    std::vector<uint32_t> zoneListIndex_;
+
+    // Columns, indexed by slot
+    std::vector<int> uid_;
+    std::vector<int> templateId_;
+    std::vector<int> zoneId_;
+    std::vector<float> posX_;
+    std::vector<float> posY_;
+    std::vector<float> posZ_;
+    std::vector<float> rotZ_;
+    std::vector<int> health_;
+    std::vector<int> maxHealth_;
+    std::vector<uint8_t> dead_;
+    std::vector<float> dirX_;
+    std::vector<float> dirY_;
+    std::vector<float> speed_;
+    std::vector<uint8_t> combatState_;
+    std::vector<int64_t> stepTimestampMs_;
+    std::vector<uint8_t> engaged_;
+};
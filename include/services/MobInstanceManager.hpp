@@ -1,9 +1,12 @@
 #pragma once
 
 #include "data/DataStructs.hpp"
+#include "services/MobHotStore.hpp"
 #include "utils/Logger.hpp"
+#include "utils/SpatialHashGrid.hpp"
+#include <atomic>
 #include <functional>
-#include <map>
+#include <mutex>
 #include <shared_mutex>
 #include <unordered_map>
 
@@ -23,6 +26,17 @@ struct MobHealthUpdateResult
     int currentMana = 0; // Mana at time of update
 };
 
+/**
+ * @brief Lightweight hit of a mob range query (no attribute/skill copies).
+ */
+struct MobRangeHit
+{
+    int uid = 0;
+    int zoneId = 0;
+    PositionStruct position;
+    float distanceSq = 0.0f; // squared distance to the query center
+};
+
 /**
  * @brief Manages living mob instances in the game world
  *
@@ -73,6 +87,41 @@ class MobInstanceManager
      */
     std::vector<std::pair<int, PositionStruct>> getMobPositionsInZone(int zoneId) const;
 
+    /**
+     * @brief Same as getMobPositionsInZone, but fills a caller-owned buffer.
+     *
+     * The buffer is cleared first; reusing it across ticks keeps its capacity,
+     * so the per-tick collision snapshot does not allocate.
+     */
+    void getMobPositionsInZone(int zoneId, std::vector<std::pair<int, PositionStruct>> &out) const;
+
+    /**
+     * @brief Copy the full records of the given living mobs into a caller-owned buffer.
+     *
+     * For the few mobs a zone tick actually simulates, after it has filtered the
+     * zone on the hot store. Unknown or dead UIDs are skipped. Existing elements
+     * are assigned over, so their strings and vectors reuse their capacity from
+     * the previous tick.
+     */
+    void getLivingMobInstances(const std::vector<int> &mobUIDs, std::vector<MobDataStruct> &out) const;
+
+    /**
+     * @brief Visit the hot state of every living mob in a zone under the read lock.
+     *
+     * Reads only the structure-of-arrays columns; nothing is copied or allocated.
+     * The visitor must not call back into MobInstanceManager.
+     */
+    template <typename Fn>
+    void forEachLivingMobInZone(int zoneId, Fn &&visitor) const
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        hotStore_.forEachSlotInZone(zoneId, [&](uint32_t slot)
+            {
+                if (hotStore_.isAlive(slot))
+                    visitor(hotStore_.viewAt(slot));
+            });
+    }
+
     /**
      * @brief Apply attributes to all live instances matching mob_id.
      *        Called after setMobsAttributes arrives from game-server so that
@@ -91,6 +140,13 @@ class MobInstanceManager
      */
     bool updateMobPosition(int mobUID, const PositionStruct &position);
 
+    /**
+     * @brief Publish a mob's velocity and combat state to the hot store
+     *
+     * Called by MobMovementManager whenever it writes the mob's movement data.
+     */
+    void updateMobMotion(int mobUID, const MobMotionState &motion);
+
     /**
      * @brief Update mob health
      *
@@ -138,6 +194,16 @@ class MobInstanceManager
      */
     bool isMobAlive(int mobUID) const;
 
+    /**
+     * @brief Get the zone and position of a mob that is not dead
+     *
+     * @param mobUID Unique identifier of the mob instance
+     * @param zoneId Receives the mob's zone
+     * @param position Receives the position
+     * @return false if the mob is unknown or dead
+     */
+    bool getLivingMobLocation(int mobUID, int &zoneId, PositionStruct &position) const;
+
     /**
      * @brief Mark mob as dead
      *
@@ -153,6 +219,12 @@ class MobInstanceManager
      */
     std::unordered_map<int, MobDataStruct> getAllMobInstances() const;
 
+    /// Bumped when a mob is registered, unregistered or dies (world snapshot invalidation).
+    uint64_t getMembershipVersion() const
+    {
+        return membershipVersion_.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Get a snapshot of all currently living (not dead) mob instances.
      *
@@ -175,14 +247,30 @@ class MobInstanceManager
     bool updateMobInstance(const MobDataStruct &updated);
 
     /**
-     * @brief Get all alive mob instances within a given radius of a position.
+     * @brief Get all alive mobs within a given radius of a position.
+     *
+     * Served from the spatial grid: only cells overlapping the circle are
+     * visited, and the distance test is done on squared distances.
      *
-     * @param centerX  World X coordinate of the AoE center
-     * @param centerY  World Y coordinate of the AoE center
+     * @param centerX  World X coordinate of the query center
+     * @param centerY  World Y coordinate of the query center
      * @param radius   Search radius in world units
-     * @return Vector of mob instances (alive, within radius)
+     * @return Hits (alive, within radius), unordered
      */
-    std::vector<MobDataStruct> getMobsInRange(float centerX, float centerY, float radius) const;
+    std::vector<MobRangeHit> getMobsInRange(float centerX, float centerY, float radius) const;
+
+    /**
+     * @brief Visit all alive mobs within a radius without copying them.
+     *
+     * The visitor runs under the manager's shared lock: it must not call back
+     * into MobInstanceManager (collect UIDs and act after the call instead).
+     *
+     * @param visitor Called as visitor(const MobDataStruct &mob, float distanceSq)
+     */
+    void forEachMobInRange(float centerX,
+        float centerY,
+        float radius,
+        const std::function<void(const MobDataStruct &, float)> &visitor) const;
 
     /**
      * @brief Get count of alive mobs in zone
@@ -209,8 +297,12 @@ class MobInstanceManager
     // Store active mob instances by UID
     std::unordered_map<int, MobDataStruct> mobInstances_;
 
-    // Index by zone for faster zone-based queries
-    std::map<int, std::vector<int>> mobsByZone_;
+    // Hot per-tick state (position, HP, zone) in structure-of-arrays form; also
+    // the zone index. Kept in step with mobInstances_ under mutex_.
+    MobHotStore hotStore_;
+
+    // XY grid of all registered mobs for range queries (AoE, social aggro)
+    SpatialHashGrid mobGrid_;
 
     // Throttle map for position log spam prevention.
     // Protected by mutex_ (already held in updateMobPosition).
@@ -219,12 +311,5 @@ class MobInstanceManager
     // Mutex for thread safety
     mutable std::shared_mutex mutex_;
 
-    /**
-     * @brief Update zone index when mob changes zone
-     *
-     * @param mobUID Mob UID
-     * @param oldZoneId Old zone ID (0 if new mob)
-     * @param newZoneId New zone ID
-     */
-    void updateZoneIndex(int mobUID, int oldZoneId, int newZoneId);
+    std::atomic<uint64_t> membershipVersion_{1};
 };
@@ -2,7 +2,10 @@
 
 #include "data/DataStructs.hpp"
 #include "services/MobAIController.hpp"
+#include "services/MobHotStore.hpp"
 #include "utils/Logger.hpp"
+#include "utils/NeighborGrid.hpp"
+#include <functional>
 #include <map>
 #include <mutex>
 #include <optional>
@@ -19,6 +22,7 @@ class CharacterManager;
 class EventQueue;
 class MobManager;
 class GameServices;
+class ForkJoinPool;
 
 /**
  * @brief Manages mob movement within zones
@@ -45,6 +49,42 @@ class MobMovementManager
      */
     bool moveMobsInZone(int zoneId);
 
+    /**
+     * @brief Tick several zones in parallel and wait for all of them (barrier).
+     *
+     * Each zone is simulated by one worker: a mob belongs to its home zone even
+     * while chasing outside it, so no mob is ticked twice. Every zone draws from
+     * its own RNG stream, and effects on shared players (mob attacks) are queued
+     * per zone and applied after the barrier in zoneIds order, so the outcome
+     * does not depend on which worker finished first. Reads of other zones'
+     * combat state (melee-slot counts) use a snapshot taken before the fork.
+     *
+     * Zones with no player within lodDormantRange and no engaged mob are left
+     * dormant: not simulated this tick (see MobAIConfig AI level of detail).
+     *
+     * @param zoneIds Zones to tick, in the order their deferred effects apply
+     * @return Dormant subset of zoneIds, in the same order
+     */
+    std::vector<int> moveMobsInZones(const std::vector<int> &zoneIds, ForkJoinPool &pool);
+
+    /**
+     * @brief Run an action that touches state outside the current zone.
+     *
+     * Inside a parallel zone tick the action is queued and applied after the
+     * barrier; anywhere else it runs immediately.
+     */
+    void runCrossZoneAction(std::function<void()> action);
+
+    /**
+     * @brief Count mobs holding a melee slot (PREPARING_ATTACK / ATTACKING /
+     * ATTACK_COOLDOWN) on targetPlayerId within range of (x, y), excluding excludeUID.
+     *
+     * Inside a parallel zone tick, mobs of other zones come from a snapshot taken
+     * before the fork and only the ticking zone's own mobs are read live, so the
+     * count never depends on how far the other workers have got.
+     */
+    int countMeleeSlotHolders(int targetPlayerId, int excludeUID, float x, float y, float range) const;
+
     /**
      * @brief Move a specific mob
      *
@@ -67,6 +107,11 @@ class MobMovementManager
      */
     void setCharacterManager(class CharacterManager *characterManager);
 
+    /**
+     * @brief Set navigation manager (walkability grids / flow fields for chase and return)
+     */
+    void setNavigationManager(class NavigationManager *navigationManager);
+
     /**
      * @brief Set reference to EventQueue for combat events
      */
@@ -97,6 +142,14 @@ class MobMovementManager
      */
     MobMovementData getMobMovementData(int mobUID) const;
 
+    /**
+     * @brief Get the per-tick replication fields of a zone's mobs under one read lock
+     *
+     * out[i] belongs to mobs[i]. Velocity and combat state are not included:
+     * they are read from the MobInstanceManager hot store.
+     */
+    void getMobReplicationStates(const std::vector<MobHotView> &mobs, std::vector<MobReplicationState> &out) const;
+
     /**
      * @brief Check if mob movement should be sent to clients
      */
@@ -150,12 +203,60 @@ class MobMovementManager
     MobInstanceManager *mobInstanceManager_;
     SpawnZoneManager *spawnZoneManager_;
     class CharacterManager *characterManager_;
+    class NavigationManager *navigationManager_ = nullptr;
     class EventQueue *eventQueue_;
     class CombatSystem *combatSystem_;
     GameServices *gameServices_ = nullptr;
 
-    // Random number generator
-    std::mt19937 rng_;
+    // Simulation state kept per zone across ticks: its RNG stream and the
+    // next coarse-rate tick time of each mid-range idle mob (AI LOD).
+    struct ZoneSimState
+    {
+        std::mt19937 rng;
+        std::unordered_map<int, float> coarseNextTick; // mob UID -> game time
+    };
+
+    // Per-zone work of one parallel tick: the zone's persistent state, its
+    // cross-zone actions held until the barrier, and whether it stayed dormant.
+    struct ZoneTickBatch
+    {
+        int zoneId = 0;
+        ZoneSimState *sim = nullptr;
+        std::vector<std::function<void()>> deferred;
+        bool dormant = false;
+    };
+
+    enum class LodTier
+    {
+        FULL,
+        COARSE,
+        DORMANT
+    };
+
+    // Batch of the zone the current thread is ticking (nullptr outside moveMobsInZones)
+    static thread_local ZoneTickBatch *activeBatch_;
+
+    // A mob holding a melee slot when the parallel tick started.
+    struct MeleeSlotHolder
+    {
+        int uid = 0;
+        int zoneId = 0;
+        float x = 0.0f;
+        float y = 0.0f;
+    };
+
+    // Target player ID -> melee-slot holders, rebuilt before each parallel tick
+    // and read-only while the workers run.
+    std::unordered_map<int, std::vector<MeleeSlotHolder>> meleeSlotSnapshot_;
+    void snapshotMeleeSlotHolders();
+
+    /// Engine for the current thread: the zone's stream inside a zone tick,
+    /// a thread-local one otherwise.
+    std::mt19937 &rng();
+
+    // Per-zone simulation state; RNG streams are seeded from rngSeed_
+    uint32_t rngSeed_;
+    std::map<int, ZoneSimState> zoneSims_;
     mutable std::shared_mutex mutex_;
 
     // Movement parameters per zone
@@ -188,20 +289,27 @@ class MobMovementManager
     std::optional<MobMovementResult> calculateNewPosition(
         const MobDataStruct &mob,
         const SpawnZoneStruct &zone,
-        const std::vector<std::pair<int, PositionStruct>> &otherMobs,
+        const NeighborGrid &otherMobs,
         const MobMovementParams &params);
 
+    /**
+     * @brief Bucket a zone's position snapshot into the separation broad phase
+     */
+    void buildSeparationGrid(const std::vector<std::pair<int, PositionStruct>> &mobPositions,
+        const MobMovementParams &params,
+        NeighborGrid &grid) const;
+
     /**
      * @brief Check if position is valid (within bounds, no collisions)
      */
     bool isValidPosition(
-        float x, float y, const SpawnZoneStruct &zone, const std::vector<std::pair<int, PositionStruct>> &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params);
+        float x, float y, const SpawnZoneStruct &zone, const NeighborGrid &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params);
 
     /**
      * @brief Check if position is valid for chase movement (no zone boundaries, only collision check)
      */
     bool isValidPositionForChase(
-        float x, float y, const std::vector<std::pair<int, PositionStruct>> &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params);
+        float x, float y, const NeighborGrid &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params);
 
     /**
      * @brief Get default movement parameters for zone
@@ -235,9 +343,27 @@ class MobMovementManager
     bool runMobTick(MobDataStruct &mob,
         const SpawnZoneStruct &zone,
         const MobMovementParams &params,
-        const std::vector<std::pair<int, PositionStruct>> &mobPositions,
+        const NeighborGrid &mobPositions,
         float currentTime);
 
+    /**
+     * @brief True if the mob has a target, is returning or fleeing — never level-of-detail throttled
+     */
+    static bool isMobEngaged(const MobMovementData &data);
+
+    /// Mirror velocity and combat state into the hot store (caller holds mutex_).
+    void publishMotion(int mobUID, const MobMovementData &data);
+
+    /**
+     * @brief Positions of alive players close enough to the zone to matter for AI LOD
+     */
+    void collectPlayersNearZone(const SpawnZoneStruct &zone, std::vector<PositionStruct> &out) const;
+
+    /**
+     * @brief AI LOD tier of an idle mob from its distance to the nearest listed player
+     */
+    LodTier classifyLod(const PositionStruct &mobPos, const std::vector<PositionStruct> &players) const;
+
     /**
      * @brief Get movement data for specific mob (internal use)
      */
@@ -249,7 +375,7 @@ class MobMovementManager
     std::optional<MobMovementResult> calculateChaseMovement(
         const MobDataStruct &mob,
         const SpawnZoneStruct &zone,
-        const std::vector<std::pair<int, PositionStruct>> &otherMobs,
+        const NeighborGrid &otherMobs,
         int targetPlayerId,
         const MobMovementParams &params);
 
@@ -259,7 +385,7 @@ class MobMovementManager
     std::optional<MobMovementResult> calculateReturnToSpawnMovement(
         const MobDataStruct &mob,
         const SpawnZoneStruct &zone,
-        const std::vector<std::pair<int, PositionStruct>> &otherMobs,
+        const NeighborGrid &otherMobs,
         const PositionStruct &spawnPosition,
         const MobMovementParams &params);
 
@@ -1,6 +1,7 @@
 #pragma once
 #include "data/DataStructs.hpp"
 #include "utils/Logger.hpp"
+#include <atomic>
 #include <mutex>
 #include <unordered_map>
 #include <vector>
@@ -83,6 +84,14 @@ class NPCManager
      */
     size_t getNPCCount() const;
 
+    /**
+     * @brief Bumped whenever the NPC list or attributes are replaced (world snapshot invalidation)
+     */
+    uint64_t getVersion() const
+    {
+        return version_.load(std::memory_order_relaxed);
+    }
+
     /**
      * @brief Clear all NPC data
      */
@@ -93,6 +102,7 @@ class NPCManager
     std::unordered_map<int, NPCDataStruct> npcsMap_;                         ///< Map of NPC ID to NPC data
     std::unordered_map<int, std::vector<NPCAttributeStruct>> attributesMap_; ///< Map of NPC ID to attributes
     bool npcsLoaded_;                                                        ///< Flag indicating if NPCs have been loaded
+    std::atomic<uint64_t> version_{1};                                       ///< See getVersion()
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;                                                         ///< Reference to logger for error reporting
 
@@ -0,0 +1,143 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include "utils/Logger.hpp"
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Walkability raster of one game zone, loaded from a local file.
+ *
+ * Cell (cx, cy) covers [originX + cx*cellSize, originX + (cx+1)*cellSize) on X
+ * (same on Y). Positions outside the raster are treated as open ground.
+ */
+struct NavGrid
+{
+    int gameZoneId = 0;
+    float originX = 0.0f;
+    float originY = 0.0f;
+    float cellSize = 100.0f;
+    int width = 0;
+    int height = 0;
+    std::vector<uint8_t> walkable; ///< width*height, row-major (index = cy*width + cx)
+
+    bool contains(float x, float y) const;
+
+    /// Linear cell index, or -1 when (x, y) is outside the raster.
+    int cellIndex(float x, float y) const;
+
+    bool isWalkable(float x, float y) const
+    {
+        const int cell = cellIndex(x, y);
+        return cell < 0 || walkable[cell] != 0;
+    }
+};
+
+/**
+ * @brief Next-step directions toward one target cell, for the window of a NavGrid around it.
+ *
+ * Built with a single Dijkstra pass from the target, so any number of mobs
+ * heading to that cell read their direction in O(1). The search only covers
+ * the square of cells within NavigationManager::MAX_SEARCH_RADIUS_CELLS of
+ * the target; cells outside it have no direction.
+ */
+struct FlowField
+{
+    std::shared_ptr<const NavGrid> grid;
+    int targetCell = -1;
+    int minCx = 0; ///< window origin and size, in grid cells
+    int minCy = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<int32_t> nextCell; ///< per window cell: grid cell one step closer; -1 = unreachable/blocked
+
+    /// Grid cell one step closer to the target, or -1 (blocked, unreachable or outside the window).
+    int next(int gridCell) const
+    {
+        const int cx = gridCell % grid->width - minCx;
+        const int cy = gridCell / grid->width - minCy;
+        if (cx < 0 || cy < 0 || cx >= width || cy >= height)
+            return -1;
+        return nextCell[static_cast<size_t>(cy) * width + cx];
+    }
+
+    size_t bytes() const
+    {
+        return sizeof(FlowField) + nextCell.capacity() * sizeof(int32_t);
+    }
+};
+
+/**
+ * @brief Walkability grids per game zone and a shared cache of flow fields.
+ *
+ * Grids are read from `<NAV_GRID_DIR>/<zone slug>.json` (default directory
+ * `navgrids`) whenever the game-zone list arrives; zones without a file keep
+ * straight-line steering. Flow fields are cached by (zone, target cell): every
+ * mob chasing the same player — or returning to the same spot — shares one
+ * field, and a field is rebuilt only when its target moves to another cell.
+ * Thread-safe; queries from parallel zone ticks only contend on the cache map.
+ *
+ * Fields are built synchronously inside the zone tick, so each one only
+ * searches MAX_SEARCH_RADIUS_CELLS around its target (at most 129x129 cells,
+ * ~66 KiB), and the cache is bounded by MAX_CACHE_BYTES rather than by count.
+ */
+class NavigationManager
+{
+  public:
+    explicit NavigationManager(Logger &logger);
+
+    /// Reload grids for the given game zones (called on SET_GAME_ZONES).
+    void loadGameZoneGrids(const std::vector<GameZoneStruct> &zones);
+
+    /// False only for blocked cells of a loaded grid.
+    bool isWalkable(float x, float y) const;
+
+    /**
+     * @brief Unit direction for the next step from `from` toward `to`.
+     *
+     * @return false when no grid covers both points or `to` is unreachable;
+     *         the caller then steers straight at the target.
+     */
+    bool getStepDirection(const PositionStruct &from, const PositionStruct &to, float &outDx, float &outDy);
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+  public:
+    /// Largest raster accepted from a grid file (1 byte per cell).
+    static constexpr int MAX_GRID_CELLS = 1 << 20;
+    /// Half-size of the square a flow field searches around its target.
+    static constexpr int MAX_SEARCH_RADIUS_CELLS = 64;
+    /// Memory budget of all cached flow fields.
+    static constexpr size_t MAX_CACHE_BYTES = 32u << 20;
+
+  private:
+    static constexpr std::chrono::seconds FIELD_TTL{5};
+
+    struct CachedField
+    {
+        std::shared_ptr<const FlowField> field;
+        Clock::time_point lastUsed;
+    };
+
+    std::shared_ptr<const NavGrid> loadGridFile(const GameZoneStruct &zone, const std::string &path) const;
+    std::shared_ptr<const NavGrid> findGrid(float x, float y) const;
+    std::shared_ptr<const FlowField> getFlowField(const std::shared_ptr<const NavGrid> &grid, int targetCell);
+    static std::shared_ptr<const FlowField> buildFlowField(const std::shared_ptr<const NavGrid> &grid, int targetCell);
+
+    Logger &logger_;
+    std::shared_ptr<spdlog::logger> log_;
+
+    // Loaded grids (replaced wholesale on reload; read via std::atomic_load)
+    std::shared_ptr<const std::vector<std::shared_ptr<const NavGrid>>> grids_;
+
+    std::mutex cacheMutex_;
+    std::map<std::pair<int, int>, CachedField> fieldCache_; // (gameZoneId, targetCell) -> field
+    size_t fieldCacheBytes_ = 0;
+};
@@ -0,0 +1,140 @@
+#pragma once
+
+#include "data/DataStructs.hpp"
+#include "utils/Logger.hpp"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace spdlog
+{
+class logger;
+}
+
+/**
+ * @brief Persistence write handed to PersistenceJournal.
+ *
+ * @param characterId Owner of the write; flushCharacter() sends it on disconnect.
+ * @param key         Coalescing key, e.g. "durability:<inventoryItemId>". A later
+ *                    write with the same key replaces an unsent one.
+ * @param packet      Complete newline-terminated game-server packet.
+ */
+using PersistWriteCallback = std::function<void(int characterId, const std::string &key, const std::string &packet)>;
+
+/**
+ * @brief Write-behind journal for everything the chunk server persists to the game server.
+ *
+ * Producers stage writes instead of sending them:
+ *  - keyed writes (durability, item kill count, pity, bestiary, titles,
+ *    reputation, mastery, quest progress, player flags) carry absolute values,
+ *    so only the latest write per key is kept;
+ *  - position and HP/MP rows are compared with the last flushed row and
+ *    dropped when unchanged, then batched into one savePositions / saveHpMana
+ *    packet;
+ *  - play time is additive, so staged deltas are summed per character.
+ *
+ * flush() (Scheduler) packs the pending packets into newline-framed batches of
+ * at most maxBatchBytes, each handed to the game-server worker as one message.
+ * While the worker's send queue is above highWaterMessages a regular flush is
+ * skipped and writes keep coalescing. flushCharacter() (disconnect / evict)
+ * and flush(true) (shutdown) ignore back-pressure; on shutdown ChunkServer then
+ * waits for the worker to finish writing (GameServerWorker::waitForSendsDrained).
+ *
+ * Thread-safety: all public methods lock mutex_. flush() and flushCharacter()
+ * also hold sendMutex_ from taking the pending writes until they are handed to
+ * the send callback, so two flushes cannot interleave and an older value of a
+ * key never reaches the game server after a newer one. Staging only needs
+ * mutex_ and is not blocked by a send in progress.
+ */
+class PersistenceJournal
+{
+  public:
+    struct Stats
+    {
+        uint64_t staged = 0;           ///< writes accepted by stage*()
+        uint64_t coalesced = 0;        ///< writes replaced before they were sent
+        uint64_t unchanged = 0;        ///< position / HP-MP rows equal to the last flushed row
+        uint64_t packetsSent = 0;      ///< game-server packets flushed
+        uint64_t batchesSent = 0;      ///< sends handed to the worker
+        uint64_t deferredFlushes = 0;  ///< flushes skipped because of back-pressure
+    };
+
+    explicit PersistenceJournal(Logger &logger);
+
+    /// Hands a batch (one or more newline-terminated packets) to the game-server worker.
+    void setSendCallback(std::function<void(const std::string &)> callback);
+
+    /// Returns the number of messages waiting in the game-server worker's send queue.
+    void setQueueDepthProvider(std::function<size_t()> provider);
+
+    void setLimits(size_t highWaterMessages, size_t maxBatchBytes);
+
+    /// Keyed write with an absolute value; replaces an unsent write with the same key.
+    void stage(int characterId, const std::string &key, std::string packet);
+
+    /// Row for the next savePositions batch.
+    void stagePosition(int characterId, const PositionStruct &position);
+
+    /// Row for the next saveHpMana batch.
+    void stageHpMana(int characterId, int currentHp, int currentMana);
+
+    /// Seconds played since the last staged delta; summed until the next flush.
+    void stagePlayTime(int characterId, int64_t sessionPlayTimeSec);
+
+    /**
+     * @brief Send pending writes.
+     * @param force Ignore back-pressure (shutdown).
+     * @return Number of packets sent.
+     */
+    size_t flush(bool force = false);
+
+    /// Send everything pending for one character now and drop its baselines.
+    void flushCharacter(int characterId);
+
+    Stats getStats() const;
+
+  private:
+    struct KeyedWrite
+    {
+        int characterId = 0;
+        std::string key;
+        std::string packet;
+    };
+
+    struct HpMana
+    {
+        int hp = 0;
+        int mana = 0;
+    };
+
+    /// Collects the pending packets (all, or one character's) and clears them (mutex_ held).
+    std::vector<std::string> takePendingLocked(int onlyCharacterId);
+
+    /// Splits packets into batches of at most maxBatchBytes_ and sends them (sendMutex_ held, mutex_ not held).
+    void sendBatches(const std::vector<std::string> &packets);
+
+    Logger &logger_;
+    std::shared_ptr<spdlog::logger> log_;
+
+    std::function<void(const std::string &)> sendCallback_;
+    std::function<size_t()> queueDepthProvider_;
+    size_t highWaterMessages_ = 256;
+    size_t maxBatchBytes_ = 64 * 1024;
+
+    std::mutex sendMutex_; // taken before mutex_; orders take-and-send across flushes
+    mutable std::mutex mutex_;
+    std::vector<KeyedWrite> keyed_; // insertion order, so unrelated writes keep their relative order
+    std::unordered_map<std::string, size_t> keyedIndex_;
+
+    std::unordered_map<int, PositionStruct> pendingPositions_;
+    std::unordered_map<int, PositionStruct> flushedPositions_;
+    std::unordered_map<int, HpMana> pendingHpMana_;
+    std::unordered_map<int, HpMana> flushedHpMana_;
+    std::unordered_map<int, int64_t> pendingPlayTime_;
+
+    Stats stats_;
+};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include "services/PersistenceJournal.hpp"
 #include <functional>
 #include <nlohmann/json.hpp>
 #include <shared_mutex>
@@ -91,7 +92,7 @@ class PityManager
      * @brief Set the callback used to persist a pity counter to the game-server.
      *        The callback receives a newline-terminated JSON string.
      */
-    void setSaveCallback(std::function<void(const std::string &)> callback);
+    void setSaveCallback(PersistWriteCallback callback);
 
   private:
     /// Composite key: avoids heap allocation vs pair
@@ -108,5 +109,5 @@ class PityManager
     mutable std::shared_mutex mutex_;
     std::unordered_map<int64_t, int> counters_; // key → kill_count_without_drop
 
-    std::function<void(const std::string &)> saveCallback_;
+    PersistWriteCallback saveCallback_;
 };
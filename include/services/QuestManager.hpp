@@ -12,7 +12,6 @@
 
 // Forward declare to break circular dependency
 class GameServices;
-class GameServerWorker;
 class NetworkManager;
 
 /**
@@ -22,7 +21,7 @@ class NetworkManager;
  *  - Cache static quest definitions (set once at startup)
  *  - Cache per-character quest progress (populated on join, discarded on leave)
  *  - Expose trigger hooks called by other systems (CombatSystem, InventoryManager, etc.)
- *  - Persist dirty progress to game-server via callback (Scheduler every 5s + on disconnect)
+ *  - Stage dirty progress in the PersistenceJournal (Scheduler every 5s + on disconnect)
  *  - Track pending flag updates for persistence
  */
 class QuestManager
@@ -127,7 +126,7 @@ class QuestManager
     void queueFlagUpdate(const UpdatePlayerFlagStruct &flagUpdate);
 
     /**
-     * @brief Flush dirty quest progress records to game-server.
+     * @brief Stage dirty quest progress records in the PersistenceJournal.
      * Called by Scheduler every 5 seconds.
      */
     void flushDirtyProgress();
@@ -138,7 +137,7 @@ class QuestManager
     void flushAllProgress(int characterId);
 
     /**
-     * @brief Flush all queued flag updates to game-server immediately.
+     * @brief Stage all queued flag updates in the PersistenceJournal.
      */
     void flushPendingFlags();
 
@@ -164,12 +163,6 @@ class QuestManager
      */
     std::string getQuestStateBySlug(int characterId, const std::string &questSlug) const;
 
-    /**
-     * @brief Set the game server worker used for persistence.
-     * Called from ChunkServer after construction.
-     */
-    void setGameServerWorker(GameServerWorker *worker);
-
     /**
      * @brief Set the network manager for sending packets to clients.
      * Called from ChunkServer after construction.
@@ -218,7 +211,6 @@ class QuestManager
     bool loaded_ = false;
 
     GameServices *services_;
-    GameServerWorker *gameServerWorker_ = nullptr;
     NetworkManager *networkManager_ = nullptr;
     Logger &logger_;
     std::shared_ptr<spdlog::logger> log_;
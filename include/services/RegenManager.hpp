@@ -1,5 +1,6 @@
 #pragma once
 
+#include "services/GameConfigService.hpp"
 #include <memory>
 
 namespace spdlog
@@ -51,4 +52,12 @@ class RegenManager
   private:
     GameServices *gameServices_;
     std::shared_ptr<spdlog::logger> log_;
+
+    // regen.* keys, resolved once in the constructor
+    GameConfigKey baseHpRegenKey_;
+    GameConfigKey baseMpRegenKey_;
+    GameConfigKey hpRegenConCoeffKey_;
+    GameConfigKey mpRegenWisCoeffKey_;
+    GameConfigKey disableInCombatMsKey_;
+    GameConfigKey tickIntervalMsKey_;
 };
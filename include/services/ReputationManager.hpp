@@ -1,6 +1,7 @@
 #pragma once
 
 #include "data/DataStructs.hpp"
+#include "services/PersistenceJournal.hpp"
 #include "utils/Logger.hpp"
 #include <functional>
 #include <nlohmann/json.hpp>
@@ -64,7 +65,7 @@ class ReputationManager
 
     // ── Persistence ────────────────────────────────────────────────────────
     /** JSON string ("eventType":"saveReputation") sent to Game Server. */
-    using SaveCallback = std::function<void(const std::string &)>;
+    using SaveCallback = PersistWriteCallback;
     void setSaveCallback(SaveCallback cb)
     {
         saveCallback_ = std::move(cb);
@@ -79,13 +79,16 @@ class SkillSystem
      *        TOCTOU window between isSkillAvailable() and setCooldown().
      *
      * @param gcdMs   If > 0, also checks the per-caster Global Cooldown (stored
-     *                under the internal "__gcd__" key) and sets it atomically
+     *                under the interned "__gcd__" symbol) and sets it atomically
      *                alongside the per-skill cooldown.  Pass 0 to skip GCD.
      * @param outOnGCD  Set to true when the rejection reason is GCD (vs per-skill
      *                  cooldown), so callers can send the right error message.
      */
     bool trySetCooldown(int casterId, const std::string &skillSlug, int cooldownMs, int gcdMs = 0, bool *outOnGCD = nullptr);
 
+    /// Same as above, keyed by the interned skill slug (SkillStruct::skillSlugId).
+    bool trySetCooldown(int casterId, SymbolId skillSlugId, int cooldownMs, int gcdMs = 0, bool *outOnGCD = nullptr);
+
     /**
      * @brief Restore a cooldown from a persisted remaining duration (e.g. on login).
      *        Always sets the entry, regardless of whether one exists already.
@@ -118,8 +121,8 @@ class SkillSystem
     std::shared_ptr<spdlog::logger> log_;
     std::unique_ptr<CombatCalculator> combatCalculator_;
 
-    // Кулдауны: entityId -> (skillSlug -> timepoint)
-    std::unordered_map<int, std::unordered_map<std::string, std::chrono::steady_clock::time_point>> cooldowns_;
+    // Кулдауны: entityId -> (интернированный skillSlug -> timepoint)
+    std::unordered_map<int, std::unordered_map<SymbolId, std::chrono::steady_clock::time_point>> cooldowns_;
     mutable std::shared_mutex cooldownsMutex_; // protects cooldowns_
 
     /**
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Fixed worker set for blocking fork/join loops over independent items.
+ *
+ * parallelFor() publishes a job, the workers and the calling thread claim
+ * indices from one shared counter until the range is exhausted, and the call
+ * returns only after every index has finished — the barrier. Claiming one
+ * index at a time lets idle threads pick up the remaining work of a slow
+ * item's neighbours, so a few crowded items do not stall the whole loop.
+ */
+class ForkJoinPool
+{
+  public:
+    /// workerCount threads besides the caller; 0 runs everything inline.
+    explicit ForkJoinPool(size_t workerCount);
+    ~ForkJoinPool();
+
+    ForkJoinPool(const ForkJoinPool &) = delete;
+    ForkJoinPool &operator=(const ForkJoinPool &) = delete;
+
+    /// Runs fn(i) for every i in [0, count) and waits for all of them.
+    /// fn should not throw; exceptions are swallowed so the barrier always completes.
+    /// Calls from several threads are serialized.
+    void parallelFor(size_t count, const std::function<void(size_t)> &fn);
+
+    size_t workerCount() const
+    {
+        return workers_.size();
+    }
+
+  private:
+    void workerLoop();
+
+    /// Claims and runs indices until none are left; returns how many it ran.
+    size_t runClaimed(const std::function<void(size_t)> &fn, size_t count);
+
+    std::vector<std::thread> workers_;
+    std::mutex callMutex_;
+
+    // Current job; guarded by mutex_ (next_ is the lock-free claim counter)
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::condition_variable done_;
+    const std::function<void(size_t)> *job_ = nullptr;
+    size_t jobCount_ = 0;
+    size_t remaining_ = 0;
+    size_t busyWorkers_ = 0;
+    uint64_t generation_ = 0;
+    bool stop_ = false;
+    std::atomic<size_t> next_{0};
+};
@@ -17,6 +17,14 @@ class JSONParser
     ClientDataStruct parseClientData(const char *data, size_t length);
     MessageStruct parseMessage(const char *data, size_t length);
     std::string parseEventType(const char *data, size_t length);
+
+    // Overloads over an already-decoded document (client packets are parsed once
+    // in ClientSession and every field extractor reads from the same DOM)
+    CharacterDataStruct parseCharacterData(const nlohmann::json &jsonData);
+    PositionStruct parsePositionData(const nlohmann::json &jsonData);
+    ClientDataStruct parseClientData(const nlohmann::json &jsonData);
+    MessageStruct parseMessage(const nlohmann::json &jsonData);
+    std::string parseEventType(const nlohmann::json &jsonData);
     ChunkInfoStruct parseChunkInfo(const char *data, size_t length);
     std::vector<SpawnZoneStruct> parseSpawnZonesList(const char *data, size_t length);
     std::vector<RespawnZoneStruct> parseRespawnZonesList(const char *data, size_t length);
@@ -0,0 +1,97 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * @brief Snapshot of one lane's counters since the previous snapshot.
+ */
+struct LaneStats
+{
+    size_t depth = 0;         // tasks waiting right now
+    size_t maxDepth = 0;      // high-water mark of the queue
+    uint64_t executed = 0;    // tasks finished
+    uint64_t failed = 0;      // tasks that threw
+    uint64_t blocked = 0;     // enqueue() calls that waited for room (lane full)
+    double avgWaitMs = 0.0;   // enqueue -> start
+    double maxWaitMs = 0.0;
+    double avgRunMs = 0.0;    // start -> finish
+    double maxRunMs = 0.0;
+};
+
+/**
+ * @brief Sharded executor: tasks with the same key run serially, in enqueue order.
+ *
+ * Each lane is one worker thread with its own FIFO. A key (character, mob or
+ * client) always hashes to the same lane, so two events for one entity never
+ * run concurrently or out of order; different entities spread across lanes
+ * and run in parallel. A full lane blocks the producer until the worker frees
+ * a slot, so overload turns into back-pressure instead of reordering.
+ */
+class LaneExecutor
+{
+  public:
+    LaneExecutor(size_t laneCount, size_t maxTasksPerLane = 10000);
+    ~LaneExecutor();
+
+    LaneExecutor(const LaneExecutor &) = delete;
+    LaneExecutor &operator=(const LaneExecutor &) = delete;
+
+    /// Blocks while the lane is full; throws std::runtime_error once the executor stopped.
+    /// Must not be called from a lane task (a full lane would wait on itself).
+    void enqueue(uint64_t key, std::function<void()> task);
+
+    size_t laneCount() const
+    {
+        return lanes_.size();
+    }
+
+    size_t laneFor(uint64_t key) const;
+
+    /// Total queued tasks across all lanes.
+    size_t getTaskQueueSize() const;
+
+    /// Per-lane counters; resets the max/avg windows so each call reports a fresh interval.
+    std::vector<LaneStats> collectStats();
+
+  private:
+    using Clock = std::chrono::steady_clock;
+
+    struct Task
+    {
+        std::function<void()> fn;
+        Clock::time_point enqueuedAt;
+    };
+
+    struct Lane
+    {
+        std::mutex mutex;
+        std::condition_variable condition;
+        std::condition_variable notFull;
+        std::deque<Task> tasks;
+        std::thread worker;
+
+        size_t maxDepth = 0;
+        uint64_t executed = 0;
+        uint64_t failed = 0;
+        uint64_t blocked = 0;
+        double waitSumMs = 0.0;
+        double waitMaxMs = 0.0;
+        double runSumMs = 0.0;
+        double runMaxMs = 0.0;
+    };
+
+    void runLane(Lane &lane);
+
+    std::vector<std::unique_ptr<Lane>> lanes_;
+    size_t maxTasksPerLane_;
+    std::atomic<bool> stop_{false};
+};
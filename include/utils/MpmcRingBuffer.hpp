@@ -0,0 +1,142 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+
+/**
+ * @brief Bounded lock-free multi-producer/multi-consumer ring (Vyukov's algorithm).
+ *
+ * Each slot carries a sequence number that tells producers and consumers whose
+ * turn it is, so push/pop are a single CAS on the shared position plus a
+ * release store on the slot — no mutex on either side. Capacity is rounded up
+ * to a power of two. T must be move-constructible.
+ *
+ * Values live in raw storage separate from the sequence array and are only
+ * constructed on push, so a large ring of large elements costs address space
+ * up front but resident memory only up to the deepest fill it has reached.
+ */
+template <typename T>
+class MpmcRingBuffer
+{
+  public:
+    explicit MpmcRingBuffer(size_t minCapacity)
+    {
+        size_t capacity = 2;
+        while (capacity < minCapacity)
+            capacity <<= 1;
+        mask_ = capacity - 1;
+        sequences_ = std::make_unique<std::atomic<size_t>[]>(capacity);
+        for (size_t i = 0; i < capacity; ++i)
+            sequences_[i].store(i, std::memory_order_relaxed);
+        // Default-initialized on purpose: the pages are not touched until a push lands on them
+        storage_.reset(new Storage[capacity]);
+    }
+
+    ~MpmcRingBuffer()
+    {
+        const size_t tail = enqueuePos_.load(std::memory_order_acquire);
+        for (size_t pos = dequeuePos_.load(std::memory_order_acquire); pos != tail; ++pos)
+        {
+            if (sequences_[pos & mask_].load(std::memory_order_acquire) == pos + 1)
+                valueAt(pos)->~T();
+        }
+    }
+
+    MpmcRingBuffer(const MpmcRingBuffer &) = delete;
+    MpmcRingBuffer &operator=(const MpmcRingBuffer &) = delete;
+
+    size_t capacity() const
+    {
+        return mask_ + 1;
+    }
+
+    /// Moves from value only on success; returns false when the ring is full.
+    bool tryPush(T &value)
+    {
+        size_t pos = enqueuePos_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::atomic<size_t> &sequence = sequences_[pos & mask_];
+            const size_t seq = sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0)
+            {
+                if (enqueuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    new (valueAt(pos)) T(std::move(value));
+                    sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // full
+            }
+            else
+            {
+                pos = enqueuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Returns false when the ring is empty.
+    bool tryPop(T &out)
+    {
+        size_t pos = dequeuePos_.load(std::memory_order_relaxed);
+        while (true)
+        {
+            std::atomic<size_t> &sequence = sequences_[pos & mask_];
+            const size_t seq = sequence.load(std::memory_order_acquire);
+            const intptr_t diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0)
+            {
+                if (dequeuePos_.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                {
+                    T *value = valueAt(pos);
+                    out = std::move(*value);
+                    value->~T();
+                    sequence.store(pos + mask_ + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            else if (diff < 0)
+            {
+                return false; // empty
+            }
+            else
+            {
+                pos = dequeuePos_.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// Approximate under concurrency; exact when quiescent.
+    size_t sizeApprox() const
+    {
+        const size_t head = dequeuePos_.load(std::memory_order_acquire);
+        const size_t tail = enqueuePos_.load(std::memory_order_acquire);
+        return tail >= head ? tail - head : 0;
+    }
+
+  private:
+    struct alignas(T) Storage
+    {
+        unsigned char bytes[sizeof(T)];
+    };
+
+    T *valueAt(size_t pos)
+    {
+        return std::launder(reinterpret_cast<T *>(storage_[pos & mask_].bytes));
+    }
+
+    // Producer and consumer cursors on separate cache lines to avoid false sharing.
+    alignas(64) std::atomic<size_t> enqueuePos_{0};
+    alignas(64) std::atomic<size_t> dequeuePos_{0};
+    alignas(64) size_t mask_ = 0;
+    std::unique_ptr<std::atomic<size_t>[]> sequences_;
+    std::unique_ptr<Storage[]> storage_;
+};
@@ -0,0 +1,137 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief Rebuild-per-tick broad phase for short-range neighbour tests.
+ *
+ * Unlike SpatialHashGrid (incremental, one vector per cell) this is built in
+ * one pass from a position snapshot: points are sorted by cell and stored as
+ * flat id/x/y arrays, so each cell is one contiguous run. The runs are indexed
+ * by a flat array sorted by cell key and found by binary search. The narrow
+ * phase runs over them with branch-free loops the compiler vectorizes.
+ *
+ * Not thread-safe; a rebuild and queries must not overlap. Reusing one
+ * instance across ticks keeps its buffers, so rebuilding does not allocate
+ * once it has grown to the zone's size.
+ */
+class NeighborGrid
+{
+  public:
+    explicit NeighborGrid(float cellSize = 1.0f);
+
+    /// Start a rebuild: drops the previous contents, keeps the buffers.
+    void reset(float cellSize);
+
+    void add(int id, float x, float y)
+    {
+        scratch_.push_back({id, x, y});
+    }
+
+    /// Sort the added points into cells; queries are valid after this.
+    void finalize();
+
+    size_t size() const
+    {
+        return ids_.size();
+    }
+
+    /// True if any point other than excludeId lies strictly closer than radius to (x, y).
+    bool anyWithin(float x, float y, float radius, int excludeId) const;
+
+    /**
+     * @brief Visit every point other than excludeId strictly closer than radius.
+     * @param fn Called as fn(int id, float dx, float dy, float distanceSq) with dx = x - pointX
+     */
+    template <typename Fn>
+    void forEachWithin(float x, float y, float radius, int excludeId, Fn &&fn) const
+    {
+        const float radiusSq = radius * radius;
+        forEachRun(x, y, radius, [&](uint32_t begin, uint32_t end)
+            {
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    const float dx = x - xs_[i];
+                    const float dy = y - ys_[i];
+                    const float distSq = dx * dx + dy * dy;
+                    if (distSq < radiusSq && ids_[i] != excludeId)
+                        fn(ids_[i], dx, dy, distSq);
+                }
+                return false;
+            });
+    }
+
+  private:
+    struct Entry
+    {
+        int id;
+        float x;
+        float y;
+        int64_t key = 0;
+    };
+
+    int32_t cellCoord(float v) const
+    {
+        return static_cast<int32_t>(std::floor(v / cellSize_));
+    }
+
+    /// Orders by cx, then cy (sign bit flipped so negative rows sort first), so
+    /// the cells of one column form a contiguous key range.
+    static int64_t packCell(int32_t cx, int32_t cy)
+    {
+        return (static_cast<int64_t>(cx) << 32) | (static_cast<uint32_t>(cy) ^ 0x80000000u);
+    }
+
+    struct CellRun
+    {
+        int64_t key;
+        uint32_t begin;
+        uint32_t end;
+    };
+
+    /// Calls run(begin, end) for each occupied cell overlapping the square
+    /// around (x, y); stops early when run returns true. Returns that result.
+    template <typename Run>
+    bool forEachRun(float x, float y, float radius, Run &&run) const
+    {
+        if (ids_.empty())
+            return false;
+
+        const int32_t minX = cellCoord(x - radius);
+        const int32_t maxX = cellCoord(x + radius);
+        const int32_t minY = cellCoord(y - radius);
+        const int32_t maxY = cellCoord(y + radius);
+
+        // Radius wider than the occupied area: one pass over everything is cheaper.
+        const int64_t spanCells = (static_cast<int64_t>(maxX) - minX + 1) * (static_cast<int64_t>(maxY) - minY + 1);
+        if (spanCells > static_cast<int64_t>(cellRuns_.size()))
+            return run(0u, static_cast<uint32_t>(ids_.size()));
+
+        // One binary search per column, then a forward walk over its occupied cells.
+        for (int32_t cx = minX; cx <= maxX; ++cx)
+        {
+            const int64_t lastKey = packCell(cx, maxY);
+            auto it = std::lower_bound(cellRuns_.begin(), cellRuns_.end(), packCell(cx, minY),
+                [](const CellRun &cell, int64_t key)
+                { return cell.key < key; });
+            for (; it != cellRuns_.end() && it->key <= lastKey; ++it)
+            {
+                if (run(it->begin, it->end))
+                    return true;
+            }
+        }
+        return false;
+    }
+
+    float cellSize_;
+    std::vector<Entry> scratch_;
+
+    // Points sorted by cell, structure-of-arrays
+    std::vector<int> ids_;
+    std::vector<float> xs_;
+    std::vector<float> ys_;
+    std::vector<CellRun> cellRuns_; // occupied cells sorted by key, each [begin, end) into the arrays above
+};
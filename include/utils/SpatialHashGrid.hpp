@@ -0,0 +1,102 @@
+#pragma once
+
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Uniform XY hash grid of integer IDs (mob UIDs, character IDs).
+ *
+ * Not thread-safe: the owning manager guards it with the same lock as the
+ * data it indexes. Positions are stored in the cells, so range queries touch
+ * only the overlapping cells and never look the owner's map up for rejects.
+ */
+class SpatialHashGrid
+{
+  public:
+    explicit SpatialHashGrid(float cellSize);
+
+    /// Insert or move an ID. O(1) when the ID stays in its cell.
+    void update(int id, float x, float y);
+
+    void remove(int id);
+
+    void clear();
+
+    size_t size() const
+    {
+        return slots_.size();
+    }
+
+    /**
+     * @brief Visit every ID within radius of (centerX, centerY).
+     *
+     * Filtering uses squared distance (no sqrt).
+     * @param fn Called as fn(int id, float x, float y, float distanceSq)
+     */
+    template <typename Fn>
+    void forEachInRange(float centerX, float centerY, float radius, Fn &&fn) const
+    {
+        const float radiusSq = radius * radius;
+        const int32_t minX = cellCoord(centerX - radius);
+        const int32_t maxX = cellCoord(centerX + radius);
+        const int32_t minY = cellCoord(centerY - radius);
+        const int32_t maxY = cellCoord(centerY + radius);
+
+        auto visitCell = [&](const std::vector<Item> &items)
+        {
+            for (const auto &item : items)
+            {
+                const float dx = item.x - centerX;
+                const float dy = item.y - centerY;
+                const float distSq = dx * dx + dy * dy;
+                if (distSq <= radiusSq)
+                    fn(item.id, item.x, item.y, distSq);
+            }
+        };
+
+        // Huge radii cover more cells than are occupied: walk the occupied ones instead.
+        const int64_t spanCells = (static_cast<int64_t>(maxX) - minX + 1) * (static_cast<int64_t>(maxY) - minY + 1);
+        if (spanCells > static_cast<int64_t>(cells_.size()))
+        {
+            for (const auto &[key, items] : cells_)
+                visitCell(items);
+            return;
+        }
+
+        for (int32_t cx = minX; cx <= maxX; ++cx)
+        {
+            for (int32_t cy = minY; cy <= maxY; ++cy)
+            {
+                auto it = cells_.find(packCell(cx, cy));
+                if (it != cells_.end())
+                    visitCell(it->second);
+            }
+        }
+    }
+
+  private:
+    struct Item
+    {
+        int id;
+        float x;
+        float y;
+    };
+
+    int32_t cellCoord(float v) const
+    {
+        return static_cast<int32_t>(std::floor(v / cellSize_));
+    }
+
+    static int64_t packCell(int32_t cx, int32_t cy)
+    {
+        return (static_cast<int64_t>(cx) << 32) | static_cast<uint32_t>(cy);
+    }
+
+    void eraseFromCell(int64_t key, int id);
+
+    float cellSize_;
+    std::unordered_map<int, int64_t> slots_; // id -> cell key
+    std::unordered_map<int64_t, std::vector<Item>> cells_;
+};
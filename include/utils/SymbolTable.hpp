@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstdint>
+#include <deque>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+/// Small integer standing in for an interned slug (attribute, skill, effect…).
+using SymbolId = uint32_t;
+
+/// Symbol of the empty slug; also the value of a field that was never resolved.
+constexpr SymbolId NO_SYMBOL = 0;
+
+/**
+ * @brief Process-wide slug interner.
+ *
+ * Slugs are interned once when the game server delivers templates or player
+ * data; runtime structures then compare and index by SymbolId and convert back
+ * to a string only when writing a packet. IDs are dense, stable for the life
+ * of the process and never reused.
+ *
+ * The StatId slugs are interned first, so symbol (StatId + 1) is that stat —
+ * statIdFromSymbol() is arithmetic, not a lookup.
+ *
+ * Thread-safe. intern() takes the write lock only for a slug it has not seen.
+ */
+class SymbolTable
+{
+  public:
+    static SymbolTable &instance();
+
+    /// Returns the slug's ID, assigning a new one on first sight.
+    SymbolId intern(const std::string &slug);
+
+    /// Returns the slug's ID or NO_SYMBOL if it was never interned (never inserts).
+    SymbolId find(const std::string &slug) const;
+
+    /// Slug for an ID; the empty string for NO_SYMBOL or an unknown ID.
+    const std::string &name(SymbolId id) const;
+
+    size_t size() const;
+
+  private:
+    SymbolTable();
+
+    mutable std::shared_mutex mutex_;
+    std::unordered_map<std::string, SymbolId> ids_;
+    std::deque<std::string> names_; // index = SymbolId; deque keeps references stable
+};
+
+inline SymbolId
+internSymbol(const std::string &slug)
+{
+    return SymbolTable::instance().intern(slug);
+}
+
+inline const std::string &
+symbolName(SymbolId id)
+{
+    return SymbolTable::instance().name(id);
+}
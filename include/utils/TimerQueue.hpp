@@ -0,0 +1,102 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Fire-time accuracy of a TimerQueue since the previous snapshot.
+ *
+ * Latency is actual fire time minus scheduled time. Bucket i counts fires in
+ * (LATENCY_BUCKET_US[i-1], LATENCY_BUCKET_US[i]]; the last bucket counts
+ * everything above the largest bound.
+ */
+struct TimerLatencyStats
+{
+    uint64_t fired = 0;
+    uint64_t failed = 0;  // callbacks that threw
+    size_t pending = 0;   // timers waiting right now
+    double avgMs = 0.0;
+    double maxMs = 0.0;
+    double p50Ms = 0.0;   // upper bound of the bucket holding the median
+    double p99Ms = 0.0;
+    std::vector<uint64_t> buckets;
+};
+
+/**
+ * @brief One-shot timers on a dedicated thread, ordered by a min-heap of fire times.
+ *
+ * The thread sleeps until the earliest deadline, so callbacks run within the
+ * OS wake-up jitter of their scheduled time instead of on the next poll, and
+ * an idle queue costs nothing. Scheduling and cancelling are O(log n);
+ * cancelled timers are dropped lazily when they reach the top of the heap.
+ *
+ * Callbacks run one at a time on the timer thread and must be short: a slow
+ * callback delays every timer behind it (visible in the latency histogram).
+ */
+class TimerQueue
+{
+  public:
+    using Clock = std::chrono::steady_clock;
+    using TimerId = uint64_t;
+
+    /// Upper bounds (µs) of the latency histogram buckets; one overflow bucket follows.
+    static constexpr std::array<int64_t, 9> LATENCY_BUCKET_US = {100, 250, 500, 1000, 2000, 5000, 10000, 20000, 50000};
+
+    TimerQueue();
+    ~TimerQueue();
+
+    TimerQueue(const TimerQueue &) = delete;
+    TimerQueue &operator=(const TimerQueue &) = delete;
+
+    /// A deadline in the past fires as soon as the thread gets to it.
+    TimerId scheduleAt(Clock::time_point when, std::function<void()> callback);
+    TimerId scheduleAfter(std::chrono::milliseconds delay, std::function<void()> callback);
+
+    /// False if the timer already fired or was cancelled.
+    bool cancel(TimerId id);
+
+    /// Stop the thread; pending timers are discarded. Idempotent.
+    void stop();
+
+    /// Latency counters; resets them so each call reports a fresh interval.
+    TimerLatencyStats collectStats();
+
+  private:
+    struct Entry
+    {
+        Clock::time_point when;
+        TimerId id;
+
+        bool operator>(const Entry &other) const
+        {
+            return when > other.when;
+        }
+    };
+
+    void run();
+    void recordLatency(Clock::duration latency, bool failed);
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> heap_;
+    std::unordered_map<TimerId, std::function<void()>> callbacks_; // absent = cancelled or fired
+    TimerId nextId_ = 1;
+    bool stop_ = false;
+
+    std::mutex statsMutex_;
+    std::array<uint64_t, LATENCY_BUCKET_US.size() + 1> buckets_{};
+    uint64_t fired_ = 0;
+    uint64_t failed_ = 0;
+    double totalLatencyMs_ = 0.0;
+    double maxLatencyMs_ = 0.0;
+
+    std::thread worker_;
+};
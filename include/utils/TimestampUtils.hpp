@@ -22,6 +22,18 @@ class TimestampUtils
      */
     static std::string getCurrentTimestamp();
 
+    /// Buffer size for formatCurrentTimestamp() ("YYYY-MM-DD HH:MM:SS.mmm" + NUL)
+    static constexpr size_t TIMESTAMP_BUFFER_SIZE = 32;
+
+    /**
+     * @brief Write the getCurrentTimestamp() string into buf without allocating
+     * @param buf Output buffer, at least TIMESTAMP_BUFFER_SIZE bytes
+     * @return Number of characters written (not NUL-terminated)
+     *
+     * The date/time part is cached per thread and only re-formatted when the second changes.
+     */
+    static size_t formatCurrentTimestamp(char *buf, size_t size);
+
     /**
      * @brief Create timestamp struct with serverRecvMs set to current time
      * @param clientSendMsEcho Echo timestamp from client request (0 if not available)
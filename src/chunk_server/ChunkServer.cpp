@@ -1,5 +1,7 @@
 #include "chunk_server/ChunkServer.hpp"
+#include "network/JsonWriter.hpp"
 #include "services/CombatSystem.hpp"
+#include <algorithm>
 #include <chrono>
 #include <fstream>
 #include <nlohmann/json.hpp>
@@ -10,6 +12,61 @@
 #include <spdlog/logger.h>
 #endif
 
+namespace
+{
+// Lane key = (domain << 32) | id, so character 7 and mob 7 do not share a key by accident.
+enum class LaneDomain : uint64_t
+{
+    CLIENT = 1,
+    CHARACTER = 2,
+    MOB = 3,
+    EVENT_TYPE = 4
+};
+
+uint64_t
+makeLaneKey(LaneDomain domain, int id)
+{
+    return (static_cast<uint64_t>(domain) << 32) | static_cast<uint32_t>(id);
+}
+
+/**
+ * @brief Entity an event belongs to, for ordered execution on one lane.
+ *
+ * Everything about one character shares a lane, whether it came from the
+ * player's client (moveCharacter, skillUsage, ...) or from the game server
+ * (character data keyed by characterId): client events are resolved to the
+ * character bound to that client. A client without a
+ * character yet keys on the client, or on the character named in the payload
+ * (joinGameCharacter). Mob events key on the mob; everything else keys on the
+ * event type (same-type bulk loads stay ordered).
+ */
+uint64_t
+laneKeyFor(const Event &event, const ClientManager &clientManager)
+{
+    const auto &data = event.getData();
+    if (event.getClientID() > 0)
+    {
+        const int characterId = clientManager.getCharacterIdByClientId(event.getClientID());
+        if (characterId > 0)
+            return makeLaneKey(LaneDomain::CHARACTER, characterId);
+    }
+
+    if (const auto *movement = std::get_if<MovementDataStruct>(&data))
+        return makeLaneKey(LaneDomain::CHARACTER, movement->characterId);
+    if (const auto *character = std::get_if<CharacterDataStruct>(&data))
+        return makeLaneKey(LaneDomain::CHARACTER, character->characterId);
+    if (event.getClientID() > 0)
+        return makeLaneKey(LaneDomain::CLIENT, event.getClientID());
+
+    if (const auto *mob = std::get_if<MobDataStruct>(&data))
+        return makeLaneKey(LaneDomain::MOB, mob->uid);
+    if (const auto *mobDeath = std::get_if<std::pair<int, int>>(&data))
+        return makeLaneKey(LaneDomain::MOB, mobDeath->first);
+
+    return makeLaneKey(LaneDomain::EVENT_TYPE, static_cast<int>(event.getType()));
+}
+} // namespace
+
 ChunkServer::ChunkServer(GameServices &gameServices,
     EventHandler &eventHandler,
     EventQueue &eventQueueGameServer,
@@ -58,8 +115,13 @@ ChunkServer::ChunkServer(GameServices &gameServices,
     // Set MobManager so MobAIController can look up skill templates (plan §2.1)
     gameServices_.getMobMovementManager().setMobManager(&gameServices_.getMobManager());
 
-    // Wire up QuestManager → GameServerWorker for persistence
-    gameServices_.getQuestManager().setGameServerWorker(&gameServerWorker_);
+    // Persistence journal → GameServerWorker; flushes back off while the worker's send queue is deep
+    gameServices_.getPersistenceJournal().setSendCallback(
+        [this](const std::string &data)
+        { gameServerWorker_.sendDataToGameServer(data); });
+    gameServices_.getPersistenceJournal().setQueueDepthProvider(
+        [this]
+        { return gameServerWorker_.pendingSendCount(); });
 
     // Wire up reconnect callback: restore is_online=true for all loaded characters
     // after the chunk server reconnects to the game server (network blip recovery)
@@ -121,17 +183,17 @@ ChunkServer::ChunkServer(GameServices &gameServices,
         [this](const std::string &data)
         { gameServerWorker_.sendDataToGameServer(data); });
 
-    // Wire up durability persistence: send durability changes to game server DB immediately
+    // Wire up durability persistence: stage durability changes in the persistence journal
     if (auto *cs = eventHandler_.getCombatEventHandler().getCombatSystem())
     {
         cs->setSaveDurabilityCallback(
-            [this](const std::string &data)
-            { gameServerWorker_.sendDataToGameServer(data); });
+            [this](int characterId, const std::string &key, const std::string &data)
+            { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
         // Wire up Item Soul kill_count persistence: send kill count changes to game server DB
         cs->setSaveItemKillCountCallback(
-            [this](const std::string &data)
-            { gameServerWorker_.sendDataToGameServer(data); });
+            [this](int characterId, const std::string &key, const std::string &data)
+            { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
         // Wire up attribute refresh trigger: when durability crosses warning threshold,
         // ask game server to recompute character attributes so the stat penalty applies.
@@ -172,13 +234,13 @@ ChunkServer::ChunkServer(GameServices &gameServices,
 
     // Wire up PityManager persistence callbacks
     gameServices_.getPityManager().setSaveCallback(
-        [this](const std::string &data)
-        { gameServerWorker_.sendDataToGameServer(data); });
+        [this](int characterId, const std::string &key, const std::string &data)
+        { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
     // Wire up BestiaryManager persistence callbacks
     gameServices_.getBestiaryManager().setSaveCallback(
-        [this](const std::string &data)
-        { gameServerWorker_.sendDataToGameServer(data); });
+        [this](int characterId, const std::string &key, const std::string &data)
+        { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
     // Wire up BestiaryManager tier-unlock notification
     gameServices_.getBestiaryManager().setNotifyCallback(
@@ -238,8 +300,8 @@ ChunkServer::ChunkServer(GameServices &gameServices,
 
     // Wire up ReputationManager persistence callbacks
     gameServices_.getReputationManager().setSaveCallback(
-        [this](const std::string &data)
-        { gameServerWorker_.sendDataToGameServer(data); });
+        [this](int characterId, const std::string &key, const std::string &data)
+        { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
     // Wire up ReputationManager → client notification on every rep change
     gameServices_.getReputationManager().setClientNotifyCallback(
@@ -301,8 +363,8 @@ ChunkServer::ChunkServer(GameServices &gameServices,
 
     // Wire up MasteryManager persistence callbacks
     gameServices_.getMasteryManager().setSaveCallback(
-        [this](const std::string &data)
-        { gameServerWorker_.sendDataToGameServer(data); });
+        [this](int characterId, const std::string &key, const std::string &data)
+        { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
     // Wire up MasteryManager → client notification on mastery progress flush
     gameServices_.getMasteryManager().setClientNotifyCallback(
@@ -339,8 +401,8 @@ ChunkServer::ChunkServer(GameServices &gameServices,
 
     // Wire up TitleManager persistence callbacks
     gameServices_.getTitleManager().setSaveCallback(
-        [this](const std::string &data)
-        { gameServerWorker_.sendDataToGameServer(data); });
+        [this](int characterId, const std::string &key, const std::string &data)
+        { gameServices_.getPersistenceJournal().stage(characterId, key, data); });
 
     // Wire up TitleManager → client direct-send callback
     gameServices_.getTitleManager().setNotifyClientCallback(
@@ -552,8 +614,8 @@ ChunkServer::mainEventLoopCH()
     // Unified mob movement + broadcast tick (replaces the old split-brain pair
     // of moveMobInZoneTask@1000ms and aggroMobMovementTask@50ms).
     //
-    // Running at 50ms gives a fine-grained scheduling resolution, but the
-    // actual movement of each mob is gated internally:
+    // Runs every world tick (50ms) as pipeline steps, but the actual movement
+    // of each mob is gated internally:
     //   • PATROLLING mobs  — governed by nextMoveTime    (~200-400ms cadence)
     //   • CHASING mobs     — governed by chaseMovementInterval (100ms)
     //   • RETURNING mobs   — governed by returnMovementInterval (150ms)
@@ -565,51 +627,71 @@ ChunkServer::mainEventLoopCH()
     // forceNextUpdate (triggered by combat state transitions) bypasses the
     // per-mob rate limit so state-change packets are never delayed.
     // -------------------------------------------------------------------------
-    Task unifiedMobTickTask(
-        [&]
-        {
-            auto spawnZones = gameServices_.getSpawnZoneManager().getMobSpawnZones();
-            if (spawnZones.empty())
-                return;
-
-            const int64_t nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
-                std::chrono::system_clock::now().time_since_epoch())
-                                      .count();
-
-            // Collect updates for ALL zones, keyed by clientId, so we can push one
-            // event per client instead of one per zone — reduces async_write frequency
-            // by N_zones and prevents mob-position packets from head-of-line-blocking
-            // combat packets in the per-socket write queue.
-            auto connectedClients = gameServices_.getClientManager().getClientsListReadOnly();
-            std::unordered_map<int, std::vector<MobMoveUpdateStruct>> clientUpdates;
-            clientUpdates.reserve(connectedClients.size());
+    // INPUT: one spawn-zone snapshot per tick, shared by movement and replication.
+    tickPipeline_.addStep(TickPhase::INPUT, "zoneSnapshot", 1, true, [this](TickContext &tick)
+        { tick.spawnZones = gameServices_.getSpawnZoneManager().getMobSpawnZones(); });
 
-            for (const auto &zone : spawnZones)
+    // AI + MOVEMENT: runMobTick (inside moveMobsInZone) handles every state:
+    // patrol, chase, return, flee. Internal timing guards gate actual movement.
+    tickPipeline_.addStep(TickPhase::MOVEMENT, "mobMovement", 1, true, [this](TickContext &tick)
+        {
+            for (const auto &zone : tick.spawnZones)
             {
                 // Use actual alive count from MobInstanceManager instead of spawnedMobsCount
                 // legacy counter, which can underflow and permanently freeze a zone's mobs.
                 int aliveCount = gameServices_.getMobInstanceManager().getAliveMobCountInZone(zone.second.zoneId);
                 if (!zone.second.spawnEnabled || aliveCount == 0)
                     continue;
+                tick.activeZoneIds.push_back(zone.second.zoneId);
+            }
 
-                // Single movement tick for ALL mobs in zone.
-                // runMobTick (called internally) handles every state: patrol,
-                // chase, return, flee. Internal timing guards gate actual movement.
-                gameServices_.getMobMovementManager().moveMobsInZone(zone.second.zoneId);
+            // Zones tick in parallel; returns once all are done, so replication
+            // below always sees a complete movement phase. Zones with no player
+            // nearby come back dormant (AI level of detail) and are not broadcast.
+            tick.dormantZoneIds = gameServices_.getMobMovementManager().moveMobsInZones(tick.activeZoneIds, zoneWorkers_);
+        });
 
-                // Collect mobs that need a broadcast this tick.
-                auto mobsInZone = gameServices_.getMobInstanceManager().getMobInstancesInZone(zone.second.zoneId);
+    // REPLICATION: collect mobs that need a broadcast this tick.
+    tickPipeline_.addStep(TickPhase::REPLICATION, "mobReplication", 1, true, [this, liveMobs = std::vector<MobViewPoint>(), zoneMobs = std::vector<MobHotView>(), replication = std::vector<MobReplicationState>(), movedIndex = std::unordered_map<int, size_t>()](TickContext &tick) mutable
+        {
+            const int64_t nowMs = tick.nowMs;
+
+            // Collect moved mobs for ALL zones first, then fan out one event per client
+            // instead of one per zone — reduces async_write frequency by N_zones and
+            // prevents mob-position packets from head-of-line-blocking combat packets
+            // in the per-socket write queue.
+            std::vector<MobMoveUpdateStruct> movedMobs;
+            liveMobs.clear();
+
+            for (int zoneId : tick.activeZoneIds)
+            {
+                // Dormant zones did not move: their mobs still count for visibility,
+                // but there is nothing to broadcast.
+                const bool dormant = std::binary_search(tick.dormantZoneIds.begin(), tick.dormantZoneIds.end(), zoneId);
+
+                // Hot-store snapshot: position, velocity and combat state, no full
+                // MobDataStruct copies. Copied out first so the manager calls below
+                // run outside its read lock.
+                zoneMobs.clear();
+                gameServices_.getMobInstanceManager().forEachLivingMobInZone(zoneId, [&](const MobHotView &mob)
+                    { zoneMobs.push_back(mob); });
+                for (const auto &mob : zoneMobs)
+                    liveMobs.push_back({mob.uid, mob.position.positionX, mob.position.positionY});
+                if (dormant)
+                    continue;
 
-                for (const auto &mob : mobsInZone)
-                {
-                    if (mob.isDead || mob.currentHealth <= 0)
-                        continue;
+                // Rate-limit state of the whole zone under one movement-manager read lock
+                gameServices_.getMobMovementManager().getMobReplicationStates(zoneMobs, replication);
 
-                    auto mvData = gameServices_.getMobMovementManager().getMobMovementData(mob.uid);
+                for (size_t i = 0; i < zoneMobs.size(); ++i)
+                {
+                    const auto &mob = zoneMobs[i];
+                    const auto &mvData = replication[i];
+                    const MobCombatState combatState = mob.motion.combatState;
 
                     // Per-mob rate limit: patrol gets 200ms budget, combat 100ms.
                     // forceNextUpdate bypasses the limit for instant state-change delivery.
-                    const bool isActiveCombat = (mvData.combatState != MobCombatState::PATROLLING);
+                    const bool isActiveCombat = (combatState != MobCombatState::PATROLLING);
                     const int64_t minIntervalMs = isActiveCombat ? 100 : 200;
 
                     if (!mvData.forceNextUpdate && (nowMs - mvData.lastBroadcastMs) < minIntervalMs)
@@ -622,10 +704,10 @@ ChunkServer::mainEventLoopCH()
                     if (!mvData.forceNextUpdate)
                     {
                         const bool canMobMoveInState =
-                            mvData.combatState == MobCombatState::PATROLLING ||
-                            mvData.combatState == MobCombatState::CHASING ||
-                            mvData.combatState == MobCombatState::RETURNING ||
-                            mvData.combatState == MobCombatState::FLEEING;
+                            combatState == MobCombatState::PATROLLING ||
+                            combatState == MobCombatState::CHASING ||
+                            combatState == MobCombatState::RETURNING ||
+                            combatState == MobCombatState::FLEEING;
                         if (!canMobMoveInState)
                         {
                             // Advance the timer so next poll respects the rate-limit instead
@@ -649,67 +731,128 @@ ChunkServer::mainEventLoopCH()
                     upd.uid = mob.uid;
                     upd.zoneId = mob.zoneId;
                     upd.position = mob.position;
-                    upd.dirX = mvData.movementDirectionX;
-                    upd.dirY = mvData.movementDirectionY;
-                    upd.speed = mvData.currentSpeedUnitsPerSec;
-                    upd.combatState = static_cast<int>(mvData.combatState);
-                    upd.stepTimestampMs = mvData.lastStepTimestampMs;
+                    upd.dirX = mob.motion.dirX;
+                    upd.dirY = mob.motion.dirY;
+                    upd.speed = mob.motion.speed;
+                    upd.combatState = static_cast<int>(combatState);
+                    upd.stepTimestampMs = mob.motion.stepTimestampMs;
 
                     // Patrol waypoint: lets the client dead-reckon toward the mob's
                     // active waypoint at server speed, so 200ms packets look smooth.
                     upd.hasWaypoint = mvData.hasPatrolTarget &&
-                                      (mvData.combatState == MobCombatState::PATROLLING);
+                                      (combatState == MobCombatState::PATROLLING);
                     upd.waypointX = mvData.patrolTargetPoint.positionX;
                     upd.waypointY = mvData.patrolTargetPoint.positionY;
 
                     gameServices_.getMobMovementManager().updateLastBroadcastMs(mob.uid, nowMs);
-
-                    for (const auto &client : connectedClients)
-                    {
-                        if (client.clientId <= 0)
-                            continue;
-                        clientUpdates[client.clientId].push_back(upd);
-                    }
+                    movedMobs.push_back(upd);
                 }
             }
 
-            // Push ONE event per connected client containing ALL zone updates.
-            // This replaces the old per-zone-per-client approach that produced
-            // N_zones × N_clients events per tick.
-            for (auto &[clientId, updates] : clientUpdates)
+            // Serialize every moved mob once for this tick; each client's packet is
+            // assembled from these fragments instead of re-encoding the same mobs.
+            std::shared_ptr<const MobMoveFragmentsStruct> fragments;
+            if (!movedMobs.empty())
+                fragments = JsonPackets::encodeMobMoveFragments(movedMobs, networkManager_.hasBinaryWireClients());
+
+            auto &interest = gameServices_.getInterestManager();
+            if (!interest.isEnabled())
             {
-                Event mobUpdateEvent(Event::MOB_MOVE_UPDATE, clientId, std::move(updates));
-                eventQueueGameServer_.push(std::move(mobUpdateEvent));
+                // Interest filtering disabled: every client gets every moved mob.
+                if (movedMobs.empty())
+                    return;
+                std::vector<uint32_t> allIndices(movedMobs.size());
+                for (size_t i = 0; i < allIndices.size(); ++i)
+                    allIndices[i] = static_cast<uint32_t>(i);
+                for (const auto &client : gameServices_.getClientManager().getClientsListReadOnly())
+                {
+                    if (client.clientId <= 0)
+                        continue;
+                    Event mobUpdateEvent(Event::MOB_MOVE_UPDATE, client.clientId, MobMoveUpdateBatchStruct{fragments, allIndices});
+                    eventQueueGameServer_.push(std::move(mobUpdateEvent));
+                }
+                return;
             }
-        },
-        50, // 50ms scheduling resolution; actual mob movement is gated internally
-        std::chrono::steady_clock::now(),
-        2 // task ID (reuses slot 2, previously moveMobInZoneTask)
-    );
 
-    scheduler_.scheduleTask(unifiedMobTickTask);
+            // Each client only gets moved mobs inside its area of interest, plus
+            // spawn/despawn deltas for mobs crossing the view radius.
+            movedIndex.clear();
+            movedIndex.reserve(movedMobs.size());
+            for (size_t i = 0; i < movedMobs.size(); ++i)
+                movedIndex.emplace(movedMobs[i].uid, i);
 
-    // Task for updating ongoing combat actions
-    Task combatUpdateTask(
-        [&]
-        {
-            // Update all ongoing combat actions - this will automatically complete
-            // or interrupt actions that have exceeded their duration
-            try
+            for (auto &view : interest.updateMobVisibility(liveMobs))
             {
-                eventHandler_.getCombatEventHandler().updateOngoingActions();
-            }
-            catch (const std::exception &ex)
-            {
-                gameServices_.getLogger().logError("Error updating combat actions: " + std::string(ex.what()));
+                if (view.clientId <= 0)
+                    continue;
+
+                // liveMobs only holds living mobs, so a mob that died this pass also
+                // drops out of view. mobLeftView means "alive but out of range" and the
+                // client hides the mob on it; a dead one gets mobDeath instead and its
+                // corpse must stay visible.
+                view.leftUids.erase(std::remove_if(view.leftUids.begin(), view.leftUids.end(), [this](int uid)
+                                        { return !gameServices_.getMobInstanceManager().isMobAlive(uid); }),
+                    view.leftUids.end());
+
+                if (!view.enteredUids.empty() || !view.leftUids.empty())
+                {
+                    MobViewDeltaStruct delta;
+                    delta.enteredUids = std::move(view.enteredUids);
+                    delta.leftUids = std::move(view.leftUids);
+                    Event deltaEvent(Event::MOB_VIEW_DELTA, view.clientId, std::move(delta));
+                    eventQueueGameServer_.push(std::move(deltaEvent));
+                }
+
+                if (movedIndex.empty())
+                    continue;
+
+                MobMoveUpdateBatchStruct batch;
+                batch.fragments = fragments;
+                for (int uid : view.visibleUids)
+                {
+                    auto it = movedIndex.find(uid);
+                    if (it != movedIndex.end())
+                        batch.indices.push_back(static_cast<uint32_t>(it->second));
+                }
+                if (!batch.indices.empty())
+                {
+                    Event mobUpdateEvent(Event::MOB_MOVE_UPDATE, view.clientId, std::move(batch));
+                    eventQueueGameServer_.push(std::move(mobUpdateEvent));
+                }
             }
-        },
-        100, // Every 100 ms — needed for responsive instant-skill execution and cast-time resolution
-        std::chrono::steady_clock::now(),
-        6 // unique task ID
-    );
+        });
 
-    scheduler_.scheduleTask(combatUpdateTask);
+    // COMBAT + EFFECTS: cast completion, DoT/HoT ticks and effect expiry fire on
+    // combatTimers_ at their exact deadlines instead of a 100 ms poll; each timer
+    // only processes what is due at that moment.
+    eventHandler_.getCombatEventHandler().getCombatSystem()->setCastTimerCallback([this](std::chrono::steady_clock::time_point due)
+        {
+            combatTimers_.scheduleAt(due, [this]()
+                {
+                    try
+                    {
+                        eventHandler_.getCombatEventHandler().updateOngoingActions();
+                    }
+                    catch (const std::exception &ex)
+                    {
+                        gameServices_.getLogger().logError("Error updating combat actions: " + std::string(ex.what()));
+                    }
+                });
+        });
+    gameServices_.getCharacterManager().setEffectTimerCallback([this](std::chrono::steady_clock::time_point due)
+        {
+            combatTimers_.scheduleAt(due, [this]()
+                {
+                    try
+                    {
+                        eventHandler_.getCombatEventHandler().tickEffects();
+                    }
+                    catch (const std::exception &ex)
+                    {
+                        gameServices_.getLogger().logError("Error ticking effects: " + std::string(ex.what()));
+                    }
+                });
+        });
 
     // Task for periodic cleanup of inactive sessions and client data
     Task cleanupTask(
@@ -745,9 +888,14 @@ ChunkServer::mainEventLoopCH()
             gameServices_.getLogger().log("Chunk Server Queue size: " + std::to_string(eventQueueChunkServer_.size()), BLUE);
             gameServices_.getLogger().log("Ping Queue size: " + std::to_string(eventQueueGameServerPing_.size()), BLUE);
             gameServices_.getLogger().log("ThreadPool Queue size: " + std::to_string(threadPool_.getTaskQueueSize()), BLUE);
+            gameServices_.getLogger().log("Event lanes Queue size: " + std::to_string(eventLanes_.getTaskQueueSize()), BLUE);
+            logLaneStats();
+            logTickStats();
+            logTimerStats();
+            logWriteStats();
 
             // If any queue is getting too large, log a warning
-            if (eventQueueGameServer_.size() > 500 || eventQueueChunkServer_.size() > 500 || eventQueueGameServerPing_.size() > 500 || threadPool_.getTaskQueueSize() > 500)
+            if (eventQueueGameServer_.size() > 500 || eventQueueChunkServer_.size() > 500 || eventQueueGameServerPing_.size() > 500 || threadPool_.getTaskQueueSize() > 500 || eventLanes_.getTaskQueueSize() > 500)
             {
                 log_->error("Event queues are getting large - potential memory leak!");
             }
@@ -760,8 +908,8 @@ ChunkServer::mainEventLoopCH()
     scheduler_.scheduleTask(cleanupTask);
 
     // Task for updating harvest progress and completing harvests
-    Task harvestUpdateTask(
-        [&]
+    // Harvest progress and corpse expiry — once per second, deferrable under load
+    tickPipeline_.addStep(TickPhase::EFFECTS, "harvest", 1000 / tickPipeline_.getTickMs(), false, [this](TickContext &)
         {
             try
             {
@@ -775,13 +923,7 @@ ChunkServer::mainEventLoopCH()
             {
                 gameServices_.getLogger().logError("Error updating harvest progress: " + std::string(ex.what()));
             }
-        },
-        1000, // Run every 1 second for responsive harvest updates
-        std::chrono::steady_clock::now(),
-        7 // unique task ID
-    );
-
-    scheduler_.scheduleTask(harvestUpdateTask);
+        });
 
     // Task for cleaning up expired ground items (player/mob drops older than 5 minutes)
     Task droppedItemCleanupTask(
@@ -996,45 +1138,19 @@ ChunkServer::mainEventLoopCH()
 
     scheduler_.scheduleTask(aggressiveCleanupTask);
 
-    // Periodic task: save all online player positions to the database every 30 seconds
+    // Periodic task: stage all online player positions every 30 seconds.
+    // Rows equal to the last flushed position are dropped by the journal.
     Task savePositionsTask(
         [this]
         {
             auto charactersList = gameServices_.getCharacterManager().getCharactersList();
-            if (charactersList.empty())
-                return;
-
-            // Build savePositions JSON packet for the game server
-            nlohmann::json charactersArray = nlohmann::json::array();
+            auto &journal = gameServices_.getPersistenceJournal();
             for (const auto &character : charactersList)
             {
                 if (character.characterId <= 0)
                     continue;
-
-                nlohmann::json entry;
-                entry["characterId"] = character.characterId;
-                entry["posX"] = character.characterPosition.positionX;
-                entry["posY"] = character.characterPosition.positionY;
-                entry["posZ"] = character.characterPosition.positionZ;
-                entry["rotZ"] = character.characterPosition.rotationZ;
-                charactersArray.push_back(entry);
+                journal.stagePosition(character.characterId, character.characterPosition);
             }
-
-            if (charactersArray.empty())
-                return;
-
-            nlohmann::json packet;
-            packet["header"]["eventType"] = "savePositions";
-            packet["header"]["clientId"] = 0;
-            packet["header"]["hash"] = "";
-            packet["body"]["characters"] = charactersArray;
-
-            gameServerWorker_.sendDataToGameServer(packet.dump() + "\n");
-
-            gameServices_.getLogger().log(
-                "[SAVE_POSITIONS] Sent " + std::to_string(charactersArray.size()) +
-                    " position(s) to game server",
-                GREEN);
         },
         30000,                                                                   // Every 30 seconds
         std::chrono::steady_clock::now() + std::chrono::milliseconds(30 * 1000), // First run after 30s
@@ -1100,43 +1216,19 @@ ChunkServer::mainEventLoopCH()
     );
     scheduler_.scheduleTask(cleanupDeadSocketsTask);
 
-    // ARCH-4: Periodic task: save all online player HP and Mana to the database every 10 seconds.
+    // ARCH-4: Periodic task: stage all online player HP and Mana every 10 seconds.
     // Prevents loss of current health/mana on unexpected server restart or crash.
     Task saveHpManaTask(
         [this]
         {
             auto charactersList = gameServices_.getCharacterManager().getCharactersList();
-            if (charactersList.empty())
-                return;
-
-            nlohmann::json charactersArray = nlohmann::json::array();
+            auto &journal = gameServices_.getPersistenceJournal();
             for (const auto &character : charactersList)
             {
                 if (character.characterId <= 0)
                     continue;
-
-                nlohmann::json entry;
-                entry["characterId"] = character.characterId;
-                entry["currentHp"] = character.characterCurrentHealth;
-                entry["currentMana"] = character.characterCurrentMana;
-                charactersArray.push_back(entry);
+                journal.stageHpMana(character.characterId, character.characterCurrentHealth, character.characterCurrentMana);
             }
-
-            if (charactersArray.empty())
-                return;
-
-            nlohmann::json packet;
-            packet["header"]["eventType"] = "saveHpMana";
-            packet["header"]["clientId"] = 0;
-            packet["header"]["hash"] = "";
-            packet["body"]["characters"] = charactersArray;
-
-            gameServerWorker_.sendDataToGameServer(packet.dump() + "\n");
-
-            gameServices_.getLogger().log(
-                "[SAVE_HP_MANA] Saved HP/Mana for " + std::to_string(charactersArray.size()) +
-                    " character(s)",
-                GREEN);
         },
         10000,                                                                   // Every 10 seconds
         std::chrono::steady_clock::now() + std::chrono::milliseconds(10 * 1000), // First run after 10s
@@ -1144,7 +1236,7 @@ ChunkServer::mainEventLoopCH()
     );
     scheduler_.scheduleTask(saveHpManaTask);
 
-    // Periodic task: save accumulated play time to game server every 60 seconds
+    // Periodic task: stage accumulated play time every 60 seconds
     Task savePlayTimeTask(
         [this]
         {
@@ -1164,23 +1256,10 @@ ChunkServer::mainEventLoopCH()
                 if (delta <= 0)
                     continue;
 
-                nlohmann::json pkt;
-                pkt["header"]["eventType"] = "savePlayTime";
-                pkt["header"]["clientId"] = 0;
-                pkt["header"]["hash"] = "";
-                pkt["body"]["characterId"] = character.characterId;
-                pkt["body"]["sessionPlayTimeSec"] = delta;
-                pkt["body"]["lastSessionPlayTimeSec"] = 0;
-                pkt["body"]["isDisconnect"] = false;
-
-                gameServerWorker_.sendDataToGameServer(pkt.dump() + "\n");
+                gameServices_.getPersistenceJournal().stagePlayTime(character.characterId, delta);
                 gameServices_.getCharacterManager().updateLastPlayTimeSaveAt(character.characterId, now);
             }
 
-            gameServices_.getLogger().log(
-                "[SAVE_PLAY_TIME] Sent play time for " + std::to_string(charactersList.size()) +
-                    " character(s)",
-                GREEN);
         },
         60000,                                                                   // Every 60 seconds
         std::chrono::steady_clock::now() + std::chrono::milliseconds(60 * 1000), // First run after 60s
@@ -1188,13 +1267,36 @@ ChunkServer::mainEventLoopCH()
     );
     scheduler_.scheduleTask(savePlayTimeTask);
 
-    // HP/MP regeneration task — fires every 4 seconds by default.
+    // Periodic task: flush the persistence journal every 2 seconds.
+    // Skipped (writes keep coalescing) while the game-server send queue is above its high-water mark.
+    Task flushPersistenceJournalTask(
+        [this]
+        {
+            auto &journal = gameServices_.getPersistenceJournal();
+            const size_t sent = journal.flush();
+            if (sent > 0)
+            {
+                const auto stats = journal.getStats();
+                gameServices_.getLogger().log(
+                    "[PERSIST] Flushed " + std::to_string(sent) + " packet(s); totals: staged=" +
+                        std::to_string(stats.staged) + " coalesced=" + std::to_string(stats.coalesced) +
+                        " unchanged=" + std::to_string(stats.unchanged) + " batches=" + std::to_string(stats.batchesSent) +
+                        " deferred=" + std::to_string(stats.deferredFlushes),
+                    GREEN);
+            }
+        },
+        2000,                                                                   // Every 2 seconds
+        std::chrono::steady_clock::now() + std::chrono::milliseconds(2 * 1000), // First run after 2s
+        23                                                                      // unique task ID
+    );
+    scheduler_.scheduleTask(flushPersistenceJournalTask);
+
+    // HP/MP regeneration step — fires every 4 seconds by default.
     // Actual regen amounts are driven by config keys (regen.*) read live each tick.
     // The tick interval itself uses the config value at start-up; if not yet loaded
     // the fallback of 4000 ms applies.
     const int regenIntervalMs = gameServices_.getGameConfigService().getInt("regen.tickIntervalMs", 4000);
-    Task regenTickTask(
-        [this]
+    tickPipeline_.addStep(TickPhase::EFFECTS, "regen", regenIntervalMs / tickPipeline_.getTickMs(), false, [this](TickContext &)
         {
             try
             {
@@ -1205,15 +1307,10 @@ ChunkServer::mainEventLoopCH()
                 gameServices_.getLogger().logError("[Regen] tickRegen error: " + std::string(ex.what()));
             }
         },
-        regenIntervalMs,
-        std::chrono::steady_clock::now() + std::chrono::milliseconds(regenIntervalMs),
-        15 // unique task ID
-    );
-    scheduler_.scheduleTask(regenTickTask);
+        regenIntervalMs / tickPipeline_.getTickMs());
 
     // Timed champion tick — checks spawn windows and sends pre-announcements every 30 s
-    Task timedChampionTickTask(
-        [this]
+    tickPipeline_.addStep(TickPhase::EFFECTS, "timedChampions", 30000 / tickPipeline_.getTickMs(), false, [this](TickContext &)
         {
             try
             {
@@ -1224,15 +1321,10 @@ ChunkServer::mainEventLoopCH()
                 gameServices_.getLogger().logError("[Champion] tickTimedChampions error: " + std::string(ex.what()));
             }
         },
-        30000,
-        std::chrono::steady_clock::now() + std::chrono::seconds(30),
-        16 // unique task ID
-    );
-    scheduler_.scheduleTask(timedChampionTickTask);
+        30000 / tickPipeline_.getTickMs());
 
     // Survival champion evolution tick — checks long-lived mobs every 5 minutes
-    Task survivalEvolutionTickTask(
-        [this]
+    tickPipeline_.addStep(TickPhase::EFFECTS, "survivalEvolution", 300000 / tickPipeline_.getTickMs(), false, [this](TickContext &)
         {
             try
             {
@@ -1243,15 +1335,10 @@ ChunkServer::mainEventLoopCH()
                 gameServices_.getLogger().logError("[Champion] tickSurvivalEvolution error: " + std::string(ex.what()));
             }
         },
-        300000,
-        std::chrono::steady_clock::now() + std::chrono::seconds(300),
-        18 // unique task ID
-    );
-    scheduler_.scheduleTask(survivalEvolutionTickTask);
+        300000 / tickPipeline_.getTickMs());
 
     // Zone event scheduler tick — checks timed/random event triggers every 30 s
-    Task zoneEventTickTask(
-        [this]
+    tickPipeline_.addStep(TickPhase::EFFECTS, "zoneEvents", 30000 / tickPipeline_.getTickMs(), false, [this](TickContext &)
         {
             try
             {
@@ -1262,11 +1349,7 @@ ChunkServer::mainEventLoopCH()
                 gameServices_.getLogger().logError("[ZoneEvent] tickEventScheduler error: " + std::string(ex.what()));
             }
         },
-        30000,
-        std::chrono::steady_clock::now() + std::chrono::seconds(30),
-        19 // unique task ID
-    );
-    scheduler_.scheduleTask(zoneEventTickTask);
+        30000 / tickPipeline_.getTickMs());
 
     // Ping timeout task: disconnect clients that haven't sent a ping for >30 seconds.
     // Catches crashed clients that never sent a clean TCP RST/EOF.
@@ -1361,6 +1444,7 @@ ChunkServer::mainEventLoopCH()
                         log_->warn("[GHOST_CLEANUP] Character " + std::to_string(character.characterId) +
                                    " is orphaned (age=" + std::to_string(age) + "s, no client), removing");
                         gameServices_.getCharacterManager().removeCharacter(character.characterId);
+                        gameServices_.getInterestManager().removeCharacter(character.characterId);
                     }
                 }
             }
@@ -1375,6 +1459,9 @@ ChunkServer::mainEventLoopCH()
     );
     scheduler_.scheduleTask(ghostCharacterCleanupTask);
 
+    // All world simulation steps are registered above; start the fixed-step loop.
+    tickPipeline_.start();
+
     try
     {
         log_->info("Starting Game Server Event Loop...");
@@ -1490,15 +1577,14 @@ ChunkServer::processPingBatch(const std::vector<Event> &pingEvents)
 void
 ChunkServer::processBatch(const std::vector<Event> &eventsBatch)
 {
-    // Process events directly from the batch without copying to avoid memory retention
-    // Process all events as normal events for now to simplify memory management
     for (const auto &event : eventsBatch)
     {
         try
         {
-            // Create a copy only when passing to the thread pool
-            // Use move construction in the lambda capture to minimize copies
-            threadPool_.enqueueTask([this, eventCopy = Event(event)]() mutable
+            // Same entity -> same lane -> handled serially in queue order. A full lane
+            // blocks this batch thread (back-pressure onto the event queue) rather than
+            // running the event here, ahead of that entity's queued work.
+            eventLanes_.enqueue(laneKeyFor(event, gameServices_.getClientManager()), [this, eventCopy = Event(event)]() mutable
                 {
                 try
                 {
@@ -1511,22 +1597,88 @@ ChunkServer::processBatch(const std::vector<Event> &eventsBatch)
         }
         catch (const std::exception &e)
         {
-            gameServices_.getLogger().logError("Failed to enqueue task to ThreadPool: " + std::string(e.what()), RED);
-            // Handle the event synchronously if ThreadPool is full
-            try
-            {
-                eventHandler_.dispatchEvent(event);
-            }
-            catch (const std::exception &sync_e)
-            {
-                gameServices_.getLogger().logError("Error in synchronous event handling: " + std::string(sync_e.what()), RED);
-            }
+            // Only thrown once the lanes are stopped (shutdown)
+            gameServices_.getLogger().logError("Dropping event, event lanes unavailable: " + std::string(e.what()), RED);
         }
     }
 
     eventCondition.notify_all();
 }
 
+void
+ChunkServer::logTickStats()
+{
+    const auto stats = tickPipeline_.collectStats();
+    log_->info("[TICK] ticks={} overruns={} dropped={} avg={:.2f}ms max={:.2f}ms (step {}ms)",
+        stats.ticks, stats.overruns, stats.droppedTicks, stats.avgTickMs, stats.maxTickMs, tickPipeline_.getTickMs());
+    for (const auto &phase : stats.phases)
+    {
+        if (phase.runs == 0 && phase.deferred == 0)
+            continue;
+        log_->debug("[TICK] step={} runs={} deferred={} failed={} avg={:.2f}ms max={:.2f}ms",
+            phase.name, phase.runs, phase.deferred, phase.failed, phase.avgMs, phase.maxMs);
+        if (phase.failed > 0)
+            log_->warn("[TICK] step={} failed {} of {} runs", phase.name, phase.failed, phase.runs);
+    }
+    if (stats.overruns > 0)
+        log_->warn("[TICK] {} of {} ticks overran {}ms; non-critical steps were deferred", stats.overruns, stats.ticks, tickPipeline_.getTickMs());
+}
+
+void
+ChunkServer::logTimerStats()
+{
+    const auto stats = combatTimers_.collectStats();
+    log_->info("[TIMERS] fired={} failed={} pending={} latency avg={:.2f}ms p50<={:.2f}ms p99<={:.2f}ms max={:.2f}ms",
+        stats.fired, stats.failed, stats.pending, stats.avgMs, stats.p50Ms, stats.p99Ms, stats.maxMs);
+    if (stats.fired == 0)
+        return;
+
+    std::string histogram;
+    for (size_t i = 0; i < stats.buckets.size(); ++i)
+    {
+        if (!histogram.empty())
+            histogram += ' ';
+        const auto &bounds = TimerQueue::LATENCY_BUCKET_US;
+        histogram += i < bounds.size() ? "<=" + std::to_string(bounds[i]) : ">" + std::to_string(bounds.back());
+        histogram += "us:" + std::to_string(stats.buckets[i]);
+    }
+    log_->debug("[TIMERS] latency histogram {}", histogram);
+}
+
+void
+ChunkServer::logWriteStats()
+{
+    const auto stats = networkManager_.collectWriteStats();
+    const double packetsPerFlush = stats.flushes ? static_cast<double>(stats.packets) / stats.flushes : 0.0;
+    const double bytesPerSyscall = stats.syscalls ? static_cast<double>(stats.bytes) / stats.syscalls : 0.0;
+    log_->info("[NET] flushes={} syscalls={} packets={} bytes={} packets/flush={:.2f} bytes/syscall={:.0f} maxBatch={}",
+        stats.flushes, stats.syscalls, stats.packets, stats.bytes, packetsPerFlush, bytesPerSyscall, stats.maxPacketsPerFlush);
+    if (stats.supersededBytes > 0 || stats.droppedBytes > 0 || stats.pacedWaits > 0)
+        log_->warn("[NET] bulk egress over budget: superseded={}B dropped={}B pacedWaits={}",
+            stats.supersededBytes, stats.droppedBytes, stats.pacedWaits);
+}
+
+void
+ChunkServer::logLaneStats()
+{
+    const auto stats = eventLanes_.collectStats();
+    uint64_t executed = 0;
+    uint64_t blocked = 0;
+    double worstWaitMs = 0.0;
+    for (size_t i = 0; i < stats.size(); ++i)
+    {
+        const auto &lane = stats[i];
+        executed += lane.executed;
+        blocked += lane.blocked;
+        worstWaitMs = std::max(worstWaitMs, lane.maxWaitMs);
+        if (lane.executed == 0 && lane.depth == 0)
+            continue;
+        log_->debug("[LANES] lane={} depth={} maxDepth={} executed={} failed={} blocked={} waitAvg={:.2f}ms waitMax={:.2f}ms runAvg={:.2f}ms runMax={:.2f}ms",
+            i, lane.depth, lane.maxDepth, lane.executed, lane.failed, lane.blocked, lane.avgWaitMs, lane.maxWaitMs, lane.avgRunMs, lane.maxRunMs);
+    }
+    log_->info("[LANES] lanes={} executed={} blocked={} worstWaitMs={:.2f}", stats.size(), executed, blocked, worstWaitMs);
+}
+
 void
 ChunkServer::startMainEventLoop()
 {
@@ -1550,7 +1702,25 @@ ChunkServer::stop()
     eventQueueGameServer_.stop();
     eventQueueChunkServer_.stop();
     eventQueueGameServerPing_.stop();
+    tickPipeline_.stop();
+    combatTimers_.stop();
     scheduler_.stop();
+
+    // Push whatever the journal still holds, plus the latest position and HP/Mana rows
+    auto &journal = gameServices_.getPersistenceJournal();
+    for (const auto &character : gameServices_.getCharacterManager().getCharactersList())
+    {
+        if (character.characterId <= 0)
+            continue;
+        journal.stagePosition(character.characterId, character.characterPosition);
+        journal.stageHpMana(character.characterId, character.characterCurrentHealth, character.characterCurrentMana);
+    }
+    journal.flush(true);
+
+    // flush() only posts to the worker's strand; wait until the writes are on the wire
+    if (!gameServerWorker_.waitForSendsDrained(std::chrono::seconds(5)))
+        log_->error("Shutdown: game-server send queue did not drain within 5s, pending persistence writes may be lost");
+
     eventCondition.notify_all();
 }
 
@@ -0,0 +1,189 @@
+#include "chunk_server/WorldTickPipeline.hpp"
+#include <algorithm>
+#include <exception>
+#include <spdlog/spdlog.h>
+
+namespace
+{
+double
+elapsedMs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+} // namespace
+
+WorldTickPipeline::WorldTickPipeline(int tickMs)
+    : tickMs_(std::max(1, tickMs))
+{
+}
+
+WorldTickPipeline::~WorldTickPipeline()
+{
+    stop();
+}
+
+void
+WorldTickPipeline::addStep(TickPhase phase, const std::string &name, int periodTicks, bool critical, StepFn fn, int initialDelayTicks)
+{
+    Step step;
+    step.phase = phase;
+    step.name = name;
+    step.periodTicks = static_cast<uint64_t>(std::max(1, periodTicks));
+    step.critical = critical;
+    step.fn = std::move(fn);
+    step.nextDueTick = static_cast<uint64_t>(std::max(0, initialDelayTicks));
+
+    // Stable insert keeps registration order within a phase.
+    auto pos = std::upper_bound(steps_.begin(), steps_.end(), phase, [](TickPhase p, const Step &s)
+        { return static_cast<int>(p) < static_cast<int>(s.phase); });
+    steps_.insert(pos, std::move(step));
+}
+
+void
+WorldTickPipeline::start()
+{
+    if (running_.exchange(true))
+        return;
+    thread_ = std::thread(&WorldTickPipeline::run, this);
+}
+
+void
+WorldTickPipeline::stop()
+{
+    running_ = false;
+    if (thread_.joinable())
+        thread_.join();
+}
+
+void
+WorldTickPipeline::run()
+{
+    using Clock = std::chrono::steady_clock;
+    const auto step = std::chrono::milliseconds(tickMs_);
+
+    uint64_t tickIndex = 0;
+    bool degraded = false;
+    auto nextTick = Clock::now();
+
+    while (running_)
+    {
+        const auto tickStart = Clock::now();
+        runTick(tickIndex, degraded);
+        const double tickMs = elapsedMs(tickStart, Clock::now());
+
+        const bool overran = tickMs > static_cast<double>(tickMs_);
+        degraded = overran;
+        ++tickIndex;
+        nextTick += step;
+
+        uint64_t dropped = 0;
+        const auto now = Clock::now();
+        if (now > nextTick + step * MAX_CATCH_UP_TICKS)
+        {
+            // Too far behind: abandon the backlog rather than running ticks back-to-back.
+            dropped = static_cast<uint64_t>((now - nextTick) / step);
+            nextTick = now;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            ++ticks_;
+            if (overran)
+                ++overruns_;
+            droppedTicks_ += dropped;
+            tickSumMs_ += tickMs;
+            tickMaxMs_ = std::max(tickMaxMs_, tickMs);
+        }
+
+        std::this_thread::sleep_until(nextTick);
+    }
+}
+
+void
+WorldTickPipeline::runTick(uint64_t tickIndex, bool degraded)
+{
+    TickContext context;
+    context.tickIndex = tickIndex;
+    context.deltaSec = static_cast<float>(tickMs_) / 1000.0f;
+    context.nowMs = std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                        .count();
+
+    for (auto &step : steps_)
+    {
+        if (tickIndex < step.nextDueTick)
+            continue;
+
+        if (degraded && !step.critical && step.deferredInRow < MAX_DEFER_TICKS)
+        {
+            ++step.deferredInRow;
+            std::lock_guard<std::mutex> lock(statsMutex_);
+            ++step.deferred;
+            continue; // stays due; runs on the first tick with headroom
+        }
+
+        // One failing system must not stop the world: log it and go on with the tick.
+        const auto started = std::chrono::steady_clock::now();
+        bool ok = true;
+        try
+        {
+            step.fn(context);
+        }
+        catch (const std::exception &e)
+        {
+            ok = false;
+            if (++step.failedInRow == 1 || step.failedInRow % FAILURE_LOG_EVERY == 0)
+                spdlog::error("[WorldTickPipeline] step '{}' threw (tick {}, {} in a row): {}", step.name, tickIndex, step.failedInRow, e.what());
+        }
+        catch (...)
+        {
+            ok = false;
+            if (++step.failedInRow == 1 || step.failedInRow % FAILURE_LOG_EVERY == 0)
+                spdlog::error("[WorldTickPipeline] step '{}' threw a non-standard exception (tick {}, {} in a row)", step.name, tickIndex, step.failedInRow);
+        }
+        if (ok)
+            step.failedInRow = 0;
+        const double ms = elapsedMs(started, std::chrono::steady_clock::now());
+
+        step.deferredInRow = 0;
+        step.nextDueTick = tickIndex + step.periodTicks;
+
+        std::lock_guard<std::mutex> lock(statsMutex_);
+        ++step.runs;
+        if (!ok)
+            ++step.failed;
+        step.sumMs += ms;
+        step.maxMs = std::max(step.maxMs, ms);
+    }
+}
+
+TickPipelineStats
+WorldTickPipeline::collectStats()
+{
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    TickPipelineStats stats;
+    stats.ticks = ticks_;
+    stats.overruns = overruns_;
+    stats.droppedTicks = droppedTicks_;
+    stats.avgTickMs = ticks_ > 0 ? tickSumMs_ / static_cast<double>(ticks_) : 0.0;
+    stats.maxTickMs = tickMaxMs_;
+    ticks_ = overruns_ = droppedTicks_ = 0;
+    tickSumMs_ = tickMaxMs_ = 0.0;
+
+    stats.phases.reserve(steps_.size());
+    for (auto &step : steps_)
+    {
+        TickPhaseStats phase;
+        phase.name = step.name;
+        phase.runs = step.runs;
+        phase.deferred = step.deferred;
+        phase.failed = step.failed;
+        phase.avgMs = step.runs > 0 ? step.sumMs / static_cast<double>(step.runs) : 0.0;
+        phase.maxMs = step.maxMs;
+        stats.phases.push_back(std::move(phase));
+
+        step.runs = step.deferred = step.failed = 0;
+        step.sumMs = step.maxMs = 0.0;
+    }
+    return stats;
+}
@@ -1,4 +1,5 @@
 #include "data/AttackSystem.hpp"
+#include "data/StatSheet.hpp"
 #include "utils/Logger.hpp"
 #include <algorithm>
 #include <cmath>
@@ -481,12 +482,12 @@ AttackSystem::calculateDamage(
     float attackerModifier = 1.0f;
     for (const auto &attr : attacker.attributes)
     {
-        if (attr.slug == "physical_attack" && action.damageType == "physical")
+        if (attr.slugId == statSymbol(StatId::PHYSICAL_ATTACK) && action.damageType == "physical")
         {
             attackerModifier += attr.value * 0.01f; // 1% per attack point
             break;
         }
-        else if (attr.slug == "magical_attack" && action.damageType == "magical")
+        else if (attr.slugId == statSymbol(StatId::MAGICAL_ATTACK) && action.damageType == "magical")
         {
             attackerModifier += attr.value * 0.01f;
             break;
@@ -498,12 +499,12 @@ AttackSystem::calculateDamage(
     float defense = 0.0f;
     for (const auto &attr : target.attributes)
     {
-        if (attr.slug == "physical_defense" && action.damageType == "physical")
+        if (attr.slugId == statSymbol(StatId::PHYSICAL_DEFENSE) && action.damageType == "physical")
         {
             defense = static_cast<float>(attr.value);
             break;
         }
-        else if (attr.slug == "magical_defense" && action.damageType == "magical")
+        else if (attr.slugId == statSymbol(StatId::MAGICAL_DEFENSE) && action.damageType == "magical")
         {
             defense = static_cast<float>(attr.value);
             break;
@@ -541,7 +542,7 @@ AttackSystem::calculateHitChance(
 
     for (const auto &attr : attacker.attributes)
     {
-        if (attr.slug == "accuracy")
+        if (attr.slugId == statSymbol(StatId::ACCURACY))
         {
             accuracy = static_cast<float>(attr.value);
             break;
@@ -550,7 +551,7 @@ AttackSystem::calculateHitChance(
 
     for (const auto &attr : target.attributes)
     {
-        if (attr.slug == "evasion")
+        if (attr.slugId == statSymbol(StatId::EVASION))
         {
             evasion = static_cast<float>(attr.value);
             break;
@@ -602,11 +603,11 @@ AttackSystem::calculateThreatLevel(const CharacterDataStruct &character)
     // Threat from attributes using new attribute system
     for (const auto &attr : character.attributes)
     {
-        if (attr.slug == "physical_attack")
+        if (attr.slugId == statSymbol(StatId::PHYSICAL_ATTACK))
         {
             threat += attr.value * 2.0f;
         }
-        else if (attr.slug == "magical_attack")
+        else if (attr.slugId == statSymbol(StatId::MAGICAL_ATTACK))
         {
             threat += attr.value * 1.5f;
         }
@@ -644,19 +645,19 @@ AttackSystem::determineCombatRole(const CharacterDataStruct &character)
 
     for (const auto &attr : character.attributes)
     {
-        if (attr.slug == "magical_attack")
+        if (attr.slugId == statSymbol(StatId::MAGICAL_ATTACK))
         {
             magical_attack = attr.value;
         }
-        else if (attr.slug == "physical_attack")
+        else if (attr.slugId == statSymbol(StatId::PHYSICAL_ATTACK))
         {
             physical_attack = attr.value;
         }
-        else if (attr.slug == "physical_defense")
+        else if (attr.slugId == statSymbol(StatId::PHYSICAL_DEFENSE))
         {
             physical_defense = attr.value;
         }
-        else if (attr.slug == "magical_defense")
+        else if (attr.slugId == statSymbol(StatId::MAGICAL_DEFENSE))
         {
             magical_defense = attr.value;
         }
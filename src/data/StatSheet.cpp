@@ -0,0 +1,212 @@
+#include "data/StatSheet.hpp"
+#include "data/DataStructs.hpp"
+#include <algorithm>
+
+namespace
+{
+// Unresolved (NO_SYMBOL) entries, e.g. structs built by hand from other
+// structs, are interned on the spot.
+SymbolId
+symbolOf(SymbolId symbol, const std::string &slug)
+{
+    return symbol != NO_SYMBOL ? symbol : internSymbol(slug);
+}
+
+const std::array<std::string, STAT_COUNT> &
+statSlugs()
+{
+    // Order must match StatId
+    static const std::array<std::string, STAT_COUNT> slugs = {
+        "move_speed",
+        "max_health",
+        "max_mana",
+        "hp_regen_per_s",
+        "mp_regen_per_s",
+        "strength",
+        "intelligence",
+        "constitution",
+        "wisdom",
+        "luck",
+        "physical_attack",
+        "magical_attack",
+        "healing_power",
+        "physical_defense",
+        "magical_defense",
+        "accuracy",
+        "evasion",
+        "crit_chance",
+        "crit_multiplier",
+        "block_chance",
+        "block_value",
+        "attack_speed",
+        "cast_speed",
+        "physical_resistance",
+        "magical_resistance",
+        "fire_resistance",
+        "ice_resistance",
+        "nature_resistance",
+        "arcane_resistance",
+        "holy_resistance",
+        "shadow_resistance",
+    };
+    return slugs;
+}
+
+} // namespace
+
+StatId
+statIdFromSlug(const std::string &slug)
+{
+    return statIdFromSymbol(SymbolTable::instance().find(slug));
+}
+
+const std::string &
+statSlug(StatId id)
+{
+    static const std::string empty;
+    if (id == StatId::COUNT)
+        return empty;
+    return statSlugs()[static_cast<std::size_t>(id)];
+}
+
+void
+resolveEffectSymbols(ActiveEffectStruct &effect)
+{
+    effect.attributeSlugId = internSymbol(effect.attributeSlug);
+    if (effect.effectTypeSlug == "dot")
+        effect.tickKind = EffectTickKind::DOT;
+    else if (effect.effectTypeSlug == "hot")
+        effect.tickKind = EffectTickKind::HOT;
+    else
+        effect.tickKind = EffectTickKind::NONE;
+}
+
+bool
+isStatModifierEffect(const ActiveEffectStruct &effect)
+{
+    if (effect.attributeSlug.empty())
+        return false;
+    return effect.tickKind == EffectTickKind::NONE;
+}
+
+bool
+isNonPeriodicStatEffect(const ActiveEffectStruct &effect)
+{
+    return !effect.attributeSlug.empty() && effect.tickMs <= 0;
+}
+
+int
+CharacterStatSheet::withEffects(SymbolId symbol) const
+{
+    const StatId id = statIdFromSymbol(symbol);
+    if (id != StatId::COUNT)
+        return withEffects(id);
+    auto it = extra.find(symbol);
+    if (it == extra.end())
+        return 0;
+    return it->second.base + it->second.roundedEffect;
+}
+
+int
+CharacterStatSheet::effective(SymbolId symbol) const
+{
+    const StatId id = statIdFromSymbol(symbol);
+    if (id != StatId::COUNT)
+        return effective(id);
+    auto it = extra.find(symbol);
+    if (it == extra.end())
+        return 0;
+    return it->second.base + it->second.equip + it->second.roundedEffect;
+}
+
+CharacterStatSheet
+compileStatSheet(const std::vector<CharacterAttributeStruct> &attributes,
+    const std::vector<CharacterAttributeStruct> &equipmentAttributes,
+    const std::vector<ActiveEffectStruct> &activeEffects,
+    int64_t nowSec)
+{
+    CharacterStatSheet sheet;
+
+    for (const auto &attr : attributes)
+    {
+        const SymbolId symbol = symbolOf(attr.slugId, attr.slug);
+        const StatId id = statIdFromSymbol(symbol);
+        if (id == StatId::COUNT)
+        {
+            auto &x = sheet.extra[symbol];
+            x.base = attr.value;
+            x.inBase = true;
+            continue;
+        }
+        const auto i = static_cast<std::size_t>(id);
+        sheet.base[i] = attr.value;
+        sheet.inBase.set(i);
+        sheet.present.set(i);
+    }
+
+    for (const auto &attr : equipmentAttributes)
+    {
+        const SymbolId symbol = symbolOf(attr.slugId, attr.slug);
+        const StatId id = statIdFromSymbol(symbol);
+        if (id == StatId::COUNT)
+        {
+            sheet.extra[symbol].equip += attr.value;
+            continue;
+        }
+        const auto i = static_cast<std::size_t>(id);
+        sheet.equip[i] += attr.value;
+        sheet.present.set(i);
+    }
+
+    for (const auto &eff : activeEffects)
+    {
+        const bool modifier = isStatModifierEffect(eff);
+        const bool nonPeriodic = isNonPeriodicStatEffect(eff);
+        if (!modifier && !nonPeriodic)
+            continue;
+        if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
+            continue;
+        if (eff.expiresAt != 0)
+            sheet.validUntilSec = sheet.validUntilSec == 0 ? eff.expiresAt
+                                                           : std::min(sheet.validUntilSec, eff.expiresAt);
+
+        // Each effect is rounded on its own, as the per-consumer merges did
+        const int rounded = static_cast<int>(std::round(eff.value));
+        const SymbolId symbol = symbolOf(eff.attributeSlugId, eff.attributeSlug);
+        const StatId id = statIdFromSymbol(symbol);
+        if (id == StatId::COUNT)
+        {
+            if (modifier)
+            {
+                auto &x = sheet.extra[symbol];
+                x.effect += eff.value;
+                x.roundedEffect += rounded;
+            }
+            continue;
+        }
+        const auto i = static_cast<std::size_t>(id);
+        if (modifier)
+        {
+            sheet.effect[i] += eff.value;
+            sheet.roundedEffect[i] += rounded;
+            sheet.present.set(i);
+        }
+        if (nonPeriodic)
+        {
+            sheet.staticEffect[i] += eff.value;
+            sheet.roundedStaticEffect[i] += rounded;
+        }
+    }
+
+    sheet.compiled = true;
+    return sheet;
+}
+
+const CharacterStatSheet &
+statSheetFor(const CharacterDataStruct &character, CharacterStatSheet &scratch, int64_t nowSec)
+{
+    if (character.statSheet.isFresh(nowSec))
+        return character.statSheet;
+    scratch = compileStatSheet(character.attributes, character.equipmentAttributes, character.activeEffects, nowSec);
+    return scratch;
+}
@@ -2,6 +2,7 @@
 #include "utils/JSONParser.hpp"
 #include <boost/asio.hpp>
 #include <spdlog/logger.h>
+#include <unordered_map>
 
 EventDispatcher::EventDispatcher(
     EventQueue &eventQueue,
@@ -16,226 +17,101 @@ EventDispatcher::EventDispatcher(
     log_ = gameServices_.getLogger().getSystem("events");
 }
 
+namespace
+{
+using DispatchHandler = void (EventDispatcher::*)(const EventContext &, std::shared_ptr<boost::asio::ip::tcp::socket>);
+} // namespace
+
+// Per-IO-thread batch: dispatch() fills and flushes it within one call, so IO threads
+// never share it and need no lock.
+thread_local std::vector<Event> EventDispatcher::eventsBatch_;
+
 void
 EventDispatcher::dispatch(const EventContext &context, std::shared_ptr<boost::asio::ip::tcp::socket> socket)
 {
-    // CRITICAL-3 fix: eventsBatch_ is a shared member; serialise all dispatch() invocations
-    // so concurrent io_context threads cannot race on it.
-    std::lock_guard<std::mutex> dispatchLock(dispatchMutex_);
-
-    if (context.eventType == "joinGameClient")
-    {
-        handleJoinGameClient(context, socket);
-    }
-    else if (context.eventType == "joinGameCharacter")
-    {
-        handleJoinGameCharacter(context, socket);
-    }
-    else if (context.eventType == "moveCharacter")
-    {
-        handleMoveCharacter(context, socket);
-    }
-    else if (context.eventType == "disconnectClient")
-    {
-        handleDisconnect(context, socket);
-    }
-    else if (context.eventType == "pingClient")
-    {
-        handlePing(context, socket);
-    }
-    else if (context.eventType == "getConnectedCharacters")
-    {
-        handleGetConnectedClients(context, socket);
-    }
-    else if (context.eventType == "playerAttack")
-    {
-        handlePlayerAttack(context, socket);
-    }
-    else if (context.eventType == "skillUsage")
-    {
-        handleSkillUsage(context, socket);
-    }
-    else if (context.eventType == "itemPickup")
-    {
-        handlePickupDroppedItem(context, socket);
-    }
-    else if (context.eventType == "getPlayerInventory")
-    {
-        handleGetPlayerInventory(context, socket);
-    }
-    else if (context.eventType == "harvestStart")
-    {
-        handleHarvestStart(context, socket);
-    }
-    else if (context.eventType == "harvestCancel")
-    {
-        handleHarvestCancel(context, socket);
-    }
-    else if (context.eventType == "getNearbyCorpses")
-    {
-        handleGetNearbyCorpses(context, socket);
-    }
-    else if (context.eventType == "corpseLootPickup")
-    {
-        handleCorpseLootPickup(context, socket);
-    }
-    else if (context.eventType == "corpseLootInspect")
-    {
-        handleCorpseLootInspect(context, socket);
-    }
-    else if (context.eventType == "getCharacterExperience")
-    {
-        handleGetCharacterExperience(context, socket);
-    }
-    else if (context.eventType == "npcInteract")
-    {
-        handleNPCInteract(context, socket);
-    }
-    else if (context.eventType == "dialogueChoice")
-    {
-        handleDialogueChoice(context, socket);
-    }
-    else if (context.eventType == "dialogueClose")
-    {
-        handleDialogueClose(context, socket);
-    }
-    else if (context.eventType == "openVendorShop")
-    {
-        handleOpenVendorShop(context, socket);
-    }
-    else if (context.eventType == "openSkillShop")
-    {
-        handleOpenSkillShop(context, socket);
-    }
-    else if (context.eventType == "requestLearnSkill")
-    {
-        handleRequestLearnSkill(context, socket);
-    }
-    else if (context.eventType == "buyItem")
-    {
-        handleBuyItem(context, socket);
-    }
-    else if (context.eventType == "sellItem")
-    {
-        handleSellItem(context, socket);
-    }
-    else if (context.eventType == "buyItemBatch")
-    {
-        handleBuyItemBatch(context, socket);
-    }
-    else if (context.eventType == "sellItemBatch")
-    {
-        handleSellItemBatch(context, socket);
-    }
-    else if (context.eventType == "openRepairShop")
-    {
-        handleOpenRepairShop(context, socket);
-    }
-    else if (context.eventType == "repairItem")
-    {
-        handleRepairItem(context, socket);
-    }
-    else if (context.eventType == "repairAll")
-    {
-        handleRepairAll(context, socket);
-    }
-    else if (context.eventType == "tradeRequest")
-    {
-        handleTradeRequest(context, socket);
-    }
-    else if (context.eventType == "tradeAccept")
-    {
-        handleTradeAccept(context, socket);
-    }
-    else if (context.eventType == "tradeDecline")
-    {
-        handleTradeDecline(context, socket);
-    }
-    else if (context.eventType == "tradeOfferUpdate")
-    {
-        handleTradeOfferUpdate(context, socket);
-    }
-    else if (context.eventType == "tradeConfirm")
-    {
-        handleTradeConfirm(context, socket);
-    }
-    else if (context.eventType == "tradeCancel")
-    {
-        handleTradeCancel(context, socket);
-    }
-    else if (context.eventType == "equipItem")
-    {
-        handleEquipItem(context, socket);
-    }
-    else if (context.eventType == "unequipItem")
-    {
-        handleUnequipItem(context, socket);
-    }
-    else if (context.eventType == "getEquipment")
-    {
-        handleGetEquipment(context, socket);
-    }
-    else if (context.eventType == "respawnRequest")
-    {
-        handleRespawnRequest(context, socket);
-    }
-    else if (context.eventType == "dropItem")
-    {
-        handleDropItemByPlayer(context, socket);
-    }
-    else if (context.eventType == "useItem")
-    {
-        handleUseItem(context, socket);
-    }
-    else if (context.eventType == "getBestiaryEntry")
-    {
-        handleGetBestiaryEntry(context, socket);
-    }
-    else if (context.eventType == "getBestiaryOverview")
-    {
-        handleGetBestiaryOverview(context, socket);
-    }
-    else if (context.eventType == "chatMessage")
-    {
-        handleChatMessage(context, socket);
-    }
-    else if (context.eventType == "playerReady")
-    {
-        handlePlayerReady(context, socket);
-    }
-    else if (context.eventType == "getTitles")
-    {
-        handleGetPlayerTitles(context, socket);
-    }
-    else if (context.eventType == "equipTitle")
-    {
-        handleEquipTitle(context, socket);
-    }
-    else if (context.eventType == "setSkillBarSlot")
-    {
-        handleSetSkillBarSlot(context, socket);
-    }
-    else if (context.eventType == "useEmote")
-    {
-        handleUseEmote(context, socket);
-    }
-    else if (context.eventType == "worldObjectInteract")
-    {
-        handleWorldObjectInteract(context, socket);
-    }
-    else if (context.eventType == "worldObjectChannelCancel")
-    {
-        handleWorldObjectChannelCancel(context, socket);
+    // eventType -> handler, built once; replaces the linear string compare chain.
+    static const std::unordered_map<std::string, DispatchHandler> handlers = {
+        {"joinGameClient", &EventDispatcher::handleJoinGameClient},
+        {"joinGameCharacter", &EventDispatcher::handleJoinGameCharacter},
+        {"moveCharacter", &EventDispatcher::handleMoveCharacter},
+        {"disconnectClient", &EventDispatcher::handleDisconnect},
+        {"pingClient", &EventDispatcher::handlePing},
+        {"getConnectedCharacters", &EventDispatcher::handleGetConnectedClients},
+        {"playerAttack", &EventDispatcher::handlePlayerAttack},
+        {"skillUsage", &EventDispatcher::handleSkillUsage},
+        {"itemPickup", &EventDispatcher::handlePickupDroppedItem},
+        {"getPlayerInventory", &EventDispatcher::handleGetPlayerInventory},
+        {"harvestStart", &EventDispatcher::handleHarvestStart},
+        {"harvestCancel", &EventDispatcher::handleHarvestCancel},
+        {"getNearbyCorpses", &EventDispatcher::handleGetNearbyCorpses},
+        {"corpseLootPickup", &EventDispatcher::handleCorpseLootPickup},
+        {"corpseLootInspect", &EventDispatcher::handleCorpseLootInspect},
+        {"getCharacterExperience", &EventDispatcher::handleGetCharacterExperience},
+        {"npcInteract", &EventDispatcher::handleNPCInteract},
+        {"dialogueChoice", &EventDispatcher::handleDialogueChoice},
+        {"dialogueClose", &EventDispatcher::handleDialogueClose},
+        {"openVendorShop", &EventDispatcher::handleOpenVendorShop},
+        {"openSkillShop", &EventDispatcher::handleOpenSkillShop},
+        {"requestLearnSkill", &EventDispatcher::handleRequestLearnSkill},
+        {"buyItem", &EventDispatcher::handleBuyItem},
+        {"sellItem", &EventDispatcher::handleSellItem},
+        {"buyItemBatch", &EventDispatcher::handleBuyItemBatch},
+        {"sellItemBatch", &EventDispatcher::handleSellItemBatch},
+        {"openRepairShop", &EventDispatcher::handleOpenRepairShop},
+        {"repairItem", &EventDispatcher::handleRepairItem},
+        {"repairAll", &EventDispatcher::handleRepairAll},
+        {"tradeRequest", &EventDispatcher::handleTradeRequest},
+        {"tradeAccept", &EventDispatcher::handleTradeAccept},
+        {"tradeDecline", &EventDispatcher::handleTradeDecline},
+        {"tradeOfferUpdate", &EventDispatcher::handleTradeOfferUpdate},
+        {"tradeConfirm", &EventDispatcher::handleTradeConfirm},
+        {"tradeCancel", &EventDispatcher::handleTradeCancel},
+        {"equipItem", &EventDispatcher::handleEquipItem},
+        {"unequipItem", &EventDispatcher::handleUnequipItem},
+        {"getEquipment", &EventDispatcher::handleGetEquipment},
+        {"respawnRequest", &EventDispatcher::handleRespawnRequest},
+        {"dropItem", &EventDispatcher::handleDropItemByPlayer},
+        {"useItem", &EventDispatcher::handleUseItem},
+        {"getBestiaryEntry", &EventDispatcher::handleGetBestiaryEntry},
+        {"getBestiaryOverview", &EventDispatcher::handleGetBestiaryOverview},
+        {"chatMessage", &EventDispatcher::handleChatMessage},
+        {"playerReady", &EventDispatcher::handlePlayerReady},
+        {"getTitles", &EventDispatcher::handleGetPlayerTitles},
+        {"equipTitle", &EventDispatcher::handleEquipTitle},
+        {"setSkillBarSlot", &EventDispatcher::handleSetSkillBarSlot},
+        {"useEmote", &EventDispatcher::handleUseEmote},
+        {"worldObjectInteract", &EventDispatcher::handleWorldObjectInteract},
+        {"worldObjectChannelCancel", &EventDispatcher::handleWorldObjectChannelCancel},
+    };
+
+    auto it = handlers.find(context.eventType);
+    if (it != handlers.end())
+    {
+        (this->*(it->second))(context, socket);
     }
     else
     {
         log_->error("Unknown event type: " + context.eventType);
     }
 
+    flushBatch();
+}
+
+void
+EventDispatcher::dispatchMovement(MovementDataStruct movementData, std::shared_ptr<boost::asio::ip::tcp::socket> socket)
+{
+    // Binary-wire moveCharacter frames arrive already decoded; same batch path as dispatch()
+    queueMoveCharacter(std::move(movementData), socket);
+    flushBatch();
+}
+
+void
+EventDispatcher::flushBatch()
+{
     // Push the batch of events to the queue
     if (!eventsBatch_.empty())
     {
-        eventQueue_.pushBatch(eventsBatch_);
+        eventQueue_.pushBatch(std::move(eventsBatch_));
         eventsBatch_.clear();
 
         // Avoid calling shrink_to_fit immediately after clear to prevent undefined behavior
@@ -270,6 +146,7 @@ EventDispatcher::handleJoinGameClient(const EventContext &context, std::shared_p
     clientData.accountId = context.clientData.clientId; // clientId == accountId (DB owner_id) in this system
     clientData.hash = context.clientData.hash;
     clientData.characterId = context.clientData.characterId;
+    clientData.binaryWire = context.clientData.binaryWire;
     // Socket field removed from ClientDataStruct to prevent socket references in EventData
 
     // Validate the socket parameter before creating the event
@@ -396,7 +273,7 @@ EventDispatcher::handleMoveCharacter(const EventContext &context, std::shared_pt
 
     try
     {
-        auto jsonData = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &jsonData = context.json();
         if (jsonData.contains("body") && jsonData["body"].is_object() && jsonData["body"].contains("isFalling"))
         {
             movementData.isFalling = jsonData["body"]["isFalling"].get<bool>();
@@ -404,6 +281,12 @@ EventDispatcher::handleMoveCharacter(const EventContext &context, std::shared_pt
     }
     catch (...) {}
 
+    queueMoveCharacter(std::move(movementData), socket);
+}
+
+void
+EventDispatcher::queueMoveCharacter(MovementDataStruct movementData, std::shared_ptr<boost::asio::ip::tcp::socket> socket)
+{
     // Log character data for debugging
     log_->info("Creating MOVE_CHARACTER event with movement data:");
     log_->info("Client ID: " + std::to_string(movementData.clientId));
@@ -441,7 +324,9 @@ EventDispatcher::handleMoveCharacter(const EventContext &context, std::shared_pt
         try
         {
             // Create event safely using emplace construction with lightweight movement data
-            Event moveEvent(Event::MOVE_CHARACTER, context.clientData.clientId, EventData{std::in_place_type<MovementDataStruct>, std::move(movementData)}, context.timestamps);
+            const int clientId = movementData.clientId;
+            const TimestampStruct timestamps = movementData.timestamps;
+            Event moveEvent(Event::MOVE_CHARACTER, clientId, EventData{std::in_place_type<MovementDataStruct>, std::move(movementData)}, timestamps);
 
             // Reserve space in batch to avoid reallocations
             if (eventsBatch_.capacity() < BATCH_SIZE)
@@ -465,7 +350,7 @@ EventDispatcher::handleMoveCharacter(const EventContext &context, std::shared_pt
     else
     {
         // Log that we're skipping the event for a disconnected client
-        log_->info("Skipping move character event for disconnected client ID: " + std::to_string(context.clientData.clientId));
+        log_->info("Skipping move character event for disconnected client ID: " + std::to_string(movementData.clientId));
     }
 }
 
@@ -647,10 +532,8 @@ EventDispatcher::handlePlayerAttack(const EventContext &context, std::shared_ptr
             std::string fullMessage = context.fullMessage;
             log_->info("EventDispatcher handlePlayerAttack - Full message: " + fullMessage);
 
-            // Parse the complete JSON message instead of just the body
-            JSONParser jsonParser;
-            nlohmann::json fullData = nlohmann::json::parse(fullMessage);
-            log_->info("EventDispatcher handlePlayerAttack - Parsed full data: " + fullData.dump());
+            // Reuse the document decoded once in ClientSession instead of re-parsing
+            nlohmann::json &fullData = context.json();
 
             Event playerAttackEvent(Event::PLAYER_ATTACK, context.clientData.clientId, EventData{std::in_place_type<nlohmann::json>, fullData}, context.timestamps);
             eventsBatch_.push_back(playerAttackEvent);
@@ -683,8 +566,7 @@ EventDispatcher::handleSkillUsage(const EventContext &context, std::shared_ptr<b
     }
     try
     {
-        JSONParser jsonParser;
-        nlohmann::json fullData = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &fullData = context.json();
         Event skillUsageEvent(Event::PLAYER_ATTACK, context.clientData.clientId, EventData{std::in_place_type<nlohmann::json>, fullData}, context.timestamps);
         eventsBatch_.push_back(skillUsageEvent);
         if (eventsBatch_.size() >= BATCH_SIZE)
@@ -712,7 +594,7 @@ EventDispatcher::handlePickupDroppedItem(const EventContext &context, std::share
             log_->info("EventDispatcher handlePickupDroppedItem - Full message: " + fullMessage);
 
             // Parse JSON to extract pickup data
-            nlohmann::json j = nlohmann::json::parse(fullMessage);
+            nlohmann::json &j = context.json();
             nlohmann::json pickupData = j["body"];
 
             log_->info("EventDispatcher handlePickupDroppedItem - Parsed pickup data: " + pickupData.dump());
@@ -812,7 +694,7 @@ EventDispatcher::handleHarvestStart(const EventContext &context, std::shared_ptr
         try
         {
             // Parse harvest request from message
-            auto messageJson = nlohmann::json::parse(context.fullMessage);
+            nlohmann::json &messageJson = context.json();
 
             if (!messageJson.contains("body") || !messageJson["body"].contains("corpseUID"))
             {
@@ -901,7 +783,7 @@ EventDispatcher::handleCorpseLootPickup(const EventContext &context, std::shared
             log_->info("EventDispatcher handleCorpseLootPickup - Full message: " + fullMessage);
 
             // Parse JSON to extract pickup data
-            nlohmann::json j = nlohmann::json::parse(fullMessage);
+            nlohmann::json &j = context.json();
             nlohmann::json bodyData = j["body"];
 
             log_->info("EventDispatcher handleCorpseLootPickup - Parsed body data: " + bodyData.dump());
@@ -1005,7 +887,7 @@ EventDispatcher::handleCorpseLootInspect(const EventContext &context, std::share
             log_->info("EventDispatcher handleCorpseLootInspect - Full message: " + fullMessage);
 
             // Parse JSON to extract inspect data
-            nlohmann::json j = nlohmann::json::parse(fullMessage);
+            nlohmann::json &j = context.json();
             nlohmann::json bodyData = j["body"];
 
             log_->info("EventDispatcher handleCorpseLootInspect - Parsed body data: " + bodyData.dump());
@@ -1154,7 +1036,7 @@ EventDispatcher::handleNPCInteract(const EventContext &context, std::shared_ptr<
 
     try
     {
-        auto messageJson = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &messageJson = context.json();
 
         int npcId = messageJson["body"].value("npcId", 0);
         if (npcId <= 0)
@@ -1190,7 +1072,7 @@ EventDispatcher::handleDialogueChoice(const EventContext &context, std::shared_p
 
     try
     {
-        auto messageJson = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &messageJson = context.json();
 
         DialogueChoiceRequestStruct request;
         request.characterId = context.characterData.characterId;
@@ -1220,7 +1102,7 @@ EventDispatcher::handleDialogueClose(const EventContext &context, std::shared_pt
 
     try
     {
-        auto messageJson = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &messageJson = context.json();
 
         DialogueCloseRequestStruct request;
         request.characterId = context.characterData.characterId;
@@ -1249,7 +1131,7 @@ EventDispatcher::handleOpenVendorShop(const EventContext &context, std::shared_p
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         OpenVendorShopRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1271,7 +1153,7 @@ EventDispatcher::handleOpenSkillShop(const EventContext &context, std::shared_pt
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         OpenSkillShopRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1293,7 +1175,7 @@ EventDispatcher::handleRequestLearnSkill(const EventContext &context, std::share
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         RequestLearnSkillRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1321,7 +1203,7 @@ EventDispatcher::handleBuyItem(const EventContext &context, std::shared_ptr<boos
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         BuyItemRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1345,7 +1227,7 @@ EventDispatcher::handleSellItem(const EventContext &context, std::shared_ptr<boo
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         SellItemRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1369,7 +1251,7 @@ EventDispatcher::handleBuyItemBatch(const EventContext &context, std::shared_ptr
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         BuyBatchRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1402,7 +1284,7 @@ EventDispatcher::handleSellItemBatch(const EventContext &context, std::shared_pt
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         SellBatchRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1435,7 +1317,7 @@ EventDispatcher::handleOpenRepairShop(const EventContext &context, std::shared_p
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         OpenRepairShopRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1457,7 +1339,7 @@ EventDispatcher::handleRepairItem(const EventContext &context, std::shared_ptr<b
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         RepairItemRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1480,7 +1362,7 @@ EventDispatcher::handleRepairAll(const EventContext &context, std::shared_ptr<bo
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         RepairAllRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1502,7 +1384,7 @@ EventDispatcher::handleTradeRequest(const EventContext &context, std::shared_ptr
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1524,7 +1406,7 @@ EventDispatcher::handleTradeAccept(const EventContext &context, std::shared_ptr<
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeRespondStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1547,7 +1429,7 @@ EventDispatcher::handleTradeDecline(const EventContext &context, std::shared_ptr
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeRespondStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1569,7 +1451,7 @@ EventDispatcher::handleTradeOfferUpdate(const EventContext &context, std::shared
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeOfferUpdateStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1603,7 +1485,7 @@ EventDispatcher::handleTradeConfirm(const EventContext &context, std::shared_ptr
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeConfirmCancelStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1624,7 +1506,7 @@ EventDispatcher::handleTradeCancel(const EventContext &context, std::shared_ptr<
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         TradeConfirmCancelStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1645,7 +1527,7 @@ EventDispatcher::handleEquipItem(const EventContext &context, std::shared_ptr<bo
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         EquipItemRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1666,7 +1548,7 @@ EventDispatcher::handleUnequipItem(const EventContext &context, std::shared_ptr<
         return;
     try
     {
-        auto j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         UnequipItemRequestStruct req;
         req.characterId = context.characterData.characterId;
         req.clientId = context.clientData.clientId;
@@ -1730,7 +1612,7 @@ EventDispatcher::handleDropItemByPlayer(const EventContext &context,
 
     try
     {
-        nlohmann::json j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         nlohmann::json body = j["body"];
 
         int itemId = body.value("itemId", 0);
@@ -1775,7 +1657,7 @@ EventDispatcher::handleUseItem(const EventContext &context,
 
     try
     {
-        nlohmann::json j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         nlohmann::json body = j["body"];
 
         int itemId = body.value("itemId", 0);
@@ -1835,7 +1717,7 @@ EventDispatcher::handleGetBestiaryEntry(const EventContext &context,
 
     try
     {
-        nlohmann::json j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
         std::string mobSlug = j["body"].value("mobSlug", std::string{});
 
         if (mobSlug.empty())
@@ -1871,7 +1753,7 @@ EventDispatcher::handleChatMessage(const EventContext &context,
 
     try
     {
-        nlohmann::json j = nlohmann::json::parse(context.fullMessage);
+        nlohmann::json &j = context.json();
 
         std::string channelStr = j["body"].value("channel", std::string{"zone"});
         std::string text = j["body"].value("text", std::string{});
@@ -1976,7 +1858,7 @@ EventDispatcher::handleEquipTitle(const EventContext &context,
     std::string titleSlug;
     try
     {
-        const auto &jsonData = nlohmann::json::parse(context.fullMessage);
+        const auto &jsonData = context.json();
         titleSlug = jsonData.value("body", nlohmann::json::object()).value("titleSlug", "");
     }
     catch (...)
@@ -2012,7 +1894,7 @@ EventDispatcher::handleSetSkillBarSlot(const EventContext &context,
     std::string skillSlug;
     try
     {
-        const auto &jsonData = nlohmann::json::parse(context.fullMessage);
+        const auto &jsonData = context.json();
         const auto &body = jsonData.value("body", nlohmann::json::object());
         slotIndex = body.value("slotIndex", -1);
         skillSlug = body.value("skillSlug", std::string{});
@@ -2056,7 +1938,7 @@ EventDispatcher::handleUseEmote(const EventContext &context,
     std::string emoteSlug;
     try
     {
-        const auto &jsonData = nlohmann::json::parse(context.fullMessage);
+        const auto &jsonData = context.json();
         emoteSlug = jsonData.value("body", nlohmann::json::object()).value("emoteSlug", "");
     }
     catch (...)
@@ -2095,7 +1977,7 @@ EventDispatcher::handleWorldObjectInteract(const EventContext &context, std::sha
 
     try
     {
-        const auto &json = nlohmann::json::parse(context.fullMessage);
+        const auto &json = context.json();
         const int objectId = json.value("body", nlohmann::json::object()).value("objectId", 0);
         if (objectId <= 0)
         {
@@ -2132,7 +2014,7 @@ EventDispatcher::handleWorldObjectChannelCancel(const EventContext &context, std
 
     try
     {
-        const auto &json = nlohmann::json::parse(context.fullMessage);
+        const auto &json = context.json();
         const int objectId = json.value("body", nlohmann::json::object()).value("objectId", 0);
 
         WorldObjectChannelCancelStruct req;
@@ -43,13 +43,15 @@ EventHandler::EventHandler(
     characterEventHandler_->setMobEventHandler(mobEventHandler_.get());
 
     // Set equipment event handler so Phase 4 can broadcast the new player's own
-    // equipment to all existing clients (covers the race where inventory arrives
-    // before playerReady and the EventHandler guard skips the broadcast).
+    // equipment to all existing clients while interest filtering is disabled.
     characterEventHandler_->setEquipmentEventHandler(equipmentEventHandler_.get());
     characterEventHandler_->setWorldObjectEventHandler(worldObjectEventHandler_.get());
 
     // Wire character event handler reference for pending join request cleanup on disconnect
     clientEventHandler_->setCharacterEventHandler(characterEventHandler_.get());
+
+    // Skill teleports re-evaluate the caster's area of interest
+    combatEventHandler_->setCharacterEventHandler(characterEventHandler_.get());
 }
 
 void
@@ -123,6 +125,9 @@ EventHandler::dispatchEvent(const Event &event)
         case Event::MOB_MOVE_UPDATE:
             mobEventHandler_->handleMobMoveUpdateEvent(event);
             break;
+        case Event::MOB_VIEW_DELTA:
+            mobEventHandler_->handleMobViewDeltaEvent(event);
+            break;
         case Event::MOB_DEATH:
             mobEventHandler_->handleMobDeathEvent(event);
             break;
@@ -635,17 +640,9 @@ EventHandler::handleSetGameConfigEvent(const Event &event)
             }
         }
 
+        // Publishes a new config snapshot and notifies subscribers (e.g. bestiary thresholds)
         gameServices_.getGameConfigService().setConfig(configMap);
 
-        // Push bestiary tier thresholds to BestiaryManager
-        const auto &cfg = gameServices_.getGameConfigService();
-        gameServices_.getBestiaryManager().setThresholds({cfg.getInt("bestiary.tier1_kills", 1),
-            cfg.getInt("bestiary.tier2_kills", 5),
-            cfg.getInt("bestiary.tier3_kills", 15),
-            cfg.getInt("bestiary.tier4_kills", 30),
-            cfg.getInt("bestiary.tier5_kills", 75),
-            cfg.getInt("bestiary.tier6_kills", 150)});
-
         gameServices_.getLogger().log("Game config loaded: " +
                                           std::to_string(configMap.size()) + " entries.",
             GREEN);
@@ -1562,6 +1559,7 @@ EventHandler::handleSetLearnedSkillEvent(const Event &event)
         skill.swingMs = sd.value("swingMs", 300);
         skill.animationName = sd.value("animationName", "");
         skill.isPassive = sd.value("isPassive", false);
+        resolveSkillSymbols(skill);
 
         // Parse effect definitions so passive bonuses can be applied immediately
         if (sd.contains("effects") && sd["effects"].is_array())
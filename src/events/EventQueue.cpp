@@ -1,13 +1,24 @@
 #include "events/EventQueue.hpp"
+#include <algorithm>
 #include <spdlog/spdlog.h>
 
-EventQueue::EventQueue(size_t maxSize) : maxSize_(maxSize)
+EventQueue::EventQueue(size_t maxSize, EventQueueBackend backend, EventQueueOverflowPolicy overflowPolicy)
+    : backend_(backend), overflowPolicy_(overflowPolicy), maxSize_(maxSize)
 {
+    if (backend_ == EventQueueBackend::RING)
+        ring_ = std::make_unique<MpmcRingBuffer<Event>>(maxSize_);
 }
 
 void
 EventQueue::push(const Event &event)
 {
+    if (ring_)
+    {
+        ringPush(Event(event));
+        wakeConsumers();
+        return;
+    }
+
     std::unique_lock<std::mutex> lock(mtx);
     try
     {
@@ -25,6 +36,13 @@ EventQueue::push(const Event &event)
 void
 EventQueue::push(Event &&event)
 {
+    if (ring_)
+    {
+        ringPush(std::move(event));
+        wakeConsumers();
+        return;
+    }
+
     std::unique_lock<std::mutex> lock(mtx);
     try
     {
@@ -42,6 +60,15 @@ EventQueue::push(Event &&event)
 bool
 EventQueue::pop(Event &event)
 {
+    if (ring_)
+    {
+        std::vector<Event> one;
+        if (!ringWait(one, 1))
+            return false;
+        event = std::move(one.front());
+        return true;
+    }
+
     std::unique_lock<std::mutex> lock(mtx);
     // HIGH-4: also wake when stopped so consumer threads exit cleanly
     cv.wait(lock, [this]
@@ -56,6 +83,14 @@ EventQueue::pop(Event &event)
 void
 EventQueue::pushBatch(const std::vector<Event> &events)
 {
+    if (ring_)
+    {
+        for (const auto &event : events)
+            ringPush(Event(event));
+        wakeConsumers();
+        return;
+    }
+
     std::unique_lock<std::mutex> lock(mtx);
 
     // Reserve space in the queue to avoid frequent reallocations
@@ -108,6 +143,147 @@ EventQueue::pushBatch(const std::vector<Event> &events)
     cv.notify_all();
 }
 
+void
+EventQueue::pushBatch(std::vector<Event> &&events)
+{
+    if (ring_)
+    {
+        for (auto &event : events)
+            ringPush(std::move(event));
+        wakeConsumers();
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    for (auto &event : events)
+    {
+        if (event.getData().valueless_by_exception())
+        {
+            droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+            continue;
+        }
+        queue.emplace(std::move(event));
+    }
+    enforceLimit();
+    cv.notify_all();
+}
+
+void
+EventQueue::ringPush(Event &&event)
+{
+    if (event.getData().valueless_by_exception())
+    {
+        droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    while (!ring_->tryPush(event))
+    {
+        if (stopped_.load(std::memory_order_relaxed))
+        {
+            droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        switch (overflowPolicy_)
+        {
+        case EventQueueOverflowPolicy::DROP_OLDEST:
+        {
+            Event oldest;
+            if (ring_->tryPop(oldest))
+            {
+                droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+                spdlog::warn("[EventQueue::ringPush] Queue overflow: dropped oldest event (limit={})", ring_->capacity());
+            }
+            break;
+        }
+        case EventQueueOverflowPolicy::REJECT:
+            droppedEvents_.fetch_add(1, std::memory_order_relaxed);
+            spdlog::warn("[EventQueue::ringPush] Queue full: rejected new event (limit={})", ring_->capacity());
+            return;
+        case EventQueueOverflowPolicy::BLOCK:
+            waitNotFull();
+            break;
+        }
+    }
+}
+
+size_t
+EventQueue::ringDrain(std::vector<Event> &events, size_t maxCount)
+{
+    size_t taken = 0;
+    Event event;
+    while (taken < maxCount && ring_->tryPop(event))
+    {
+        events.emplace_back(std::move(event));
+        ++taken;
+    }
+    if (taken > 0)
+        wakeProducers();
+    return taken;
+}
+
+bool
+EventQueue::ringWait(std::vector<Event> &events, size_t maxCount)
+{
+    while (true)
+    {
+        if (ringDrain(events, maxCount) > 0)
+            return true;
+        if (stopped_.load(std::memory_order_acquire))
+            return false;
+
+        // Park only when empty. The counter + fence pair with wakeConsumers(): either the
+        // producer sees a sleeper and notifies under mtx, or we see its event here.
+        std::unique_lock<std::mutex> lock(mtx);
+        sleepingConsumers_.fetch_add(1);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        cv.wait(lock, [this]
+            { return ring_->sizeApprox() > 0 || stopped_.load(std::memory_order_relaxed); });
+        sleepingConsumers_.fetch_sub(1);
+    }
+}
+
+void
+EventQueue::wakeConsumers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepingConsumers_.load(std::memory_order_relaxed) == 0)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(mtx);
+    }
+    cv.notify_all();
+}
+
+void
+EventQueue::waitNotFull()
+{
+    // Events pushed earlier in a batch have not woken anyone yet; a consumer
+    // parked on an empty ring must see them, or nothing would ever drain.
+    wakeConsumers();
+
+    // Same handshake as ringWait()/wakeConsumers(), with the roles swapped.
+    std::unique_lock<std::mutex> lock(notFullMtx_);
+    sleepingProducers_.fetch_add(1);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    notFullCv_.wait(lock, [this]
+        { return ring_->sizeApprox() < ring_->capacity() || stopped_.load(std::memory_order_relaxed); });
+    sleepingProducers_.fetch_sub(1);
+}
+
+void
+EventQueue::wakeProducers()
+{
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (sleepingProducers_.load(std::memory_order_relaxed) == 0)
+        return;
+    {
+        std::lock_guard<std::mutex> lock(notFullMtx_);
+    }
+    notFullCv_.notify_all();
+}
+
 // Helper method to enforce size limit and prevent memory bloat
 void
 EventQueue::enforceLimit()
@@ -128,6 +304,9 @@ EventQueue::enforceLimit()
 bool
 EventQueue::popBatch(std::vector<Event> &events, int batchSize)
 {
+    if (ring_)
+        return ringWait(events, static_cast<size_t>(std::max(batchSize, 1)));
+
     std::unique_lock<std::mutex> lock(mtx);
     // HIGH-4: also wake when stopped
     cv.wait(lock, [this]
@@ -153,6 +332,9 @@ EventQueue::popBatch(std::vector<Event> &events, int batchSize)
 size_t
 EventQueue::size()
 {
+    if (ring_)
+        return ring_->sizeApprox();
+
     std::unique_lock<std::mutex> lock(mtx);
     return queue.size();
 }
@@ -160,6 +342,9 @@ EventQueue::size()
 bool
 EventQueue::empty()
 {
+    if (ring_)
+        return ring_->sizeApprox() == 0;
+
     std::unique_lock<std::mutex> lock(mtx);
     return queue.empty();
 }
@@ -167,6 +352,9 @@ EventQueue::empty()
 void
 EventQueue::forceCleanup()
 {
+    if (ring_)
+        return; // fixed storage, nothing to shrink
+
     std::unique_lock<std::mutex> lock(mtx);
     if (queue.empty())
     {
@@ -181,5 +369,13 @@ void
 EventQueue::stop()
 {
     stopped_.store(true, std::memory_order_release);
+    {
+        // Taking mtx closes the window between a consumer's predicate check and its wait()
+        std::lock_guard<std::mutex> lock(mtx);
+    }
     cv.notify_all(); // wake all blocked pop/popBatch callers
+    {
+        std::lock_guard<std::mutex> lock(notFullMtx_);
+    }
+    notFullCv_.notify_all(); // BLOCK producers drop their event and return
 }
\ No newline at end of file
@@ -163,6 +163,85 @@ BaseEventHandler::broadcastToAllClients(const std::string &responseData, int exc
     }
 }
 
+void
+BaseEventHandler::broadcastHotPacket(
+    const std::function<std::string()> &encodeJson,
+    std::shared_ptr<const std::string> binaryFrame,
+    int excludeClientId)
+{
+    sendHotPacket(gameServices_.getClientManager().getActiveSockets(excludeClientId), encodeJson, binaryFrame);
+}
+
+void
+BaseEventHandler::broadcastHotPacketToObservers(
+    int characterId,
+    const std::function<std::string()> &encodeJson,
+    std::shared_ptr<const std::string> binaryFrame,
+    int excludeClientId)
+{
+    sendHotPacket(getInterestSockets(characterId, excludeClientId), encodeJson, binaryFrame);
+}
+
+void
+BaseEventHandler::sendHotPacket(
+    const std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> &sockets,
+    const std::function<std::string()> &encodeJson,
+    const std::shared_ptr<const std::string> &binaryFrame)
+{
+    std::shared_ptr<const std::string> jsonData;
+    for (auto &sock : sockets)
+    {
+        if (!sock || !sock->is_open())
+            continue;
+        try
+        {
+            if (binaryFrame && networkManager_.isBinaryWire(sock))
+            {
+                networkManager_.sendResponse(sock, binaryFrame);
+                continue;
+            }
+            if (!jsonData)
+                jsonData = std::make_shared<const std::string>(encodeJson());
+            networkManager_.sendResponse(sock, jsonData);
+        }
+        catch (const std::exception &ex)
+        {
+            gameServices_.getLogger().logError("Error in broadcastHotPacket: " + std::string(ex.what()));
+        }
+    }
+}
+
+std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>>
+BaseEventHandler::getInterestSockets(int characterId, int excludeClientId)
+{
+    auto &interest = gameServices_.getInterestManager();
+    if (!interest.isEnabled())
+        return gameServices_.getClientManager().getActiveSockets(excludeClientId);
+
+    return gameServices_.getClientManager().getSocketsForClients(
+        interest.getRecipientClientIds(characterId, excludeClientId));
+}
+
+void
+BaseEventHandler::broadcastToObservers(int characterId, const std::string &responseData, int excludeClientId)
+{
+    auto sharedData = std::make_shared<const std::string>(responseData);
+    for (auto &sock : getInterestSockets(characterId, excludeClientId))
+    {
+        if (sock && sock->is_open())
+        {
+            try
+            {
+                networkManager_.sendResponse(sock, sharedData);
+            }
+            catch (const std::exception &ex)
+            {
+                gameServices_.getLogger().logError("Error in broadcastToObservers: " + std::string(ex.what()));
+            }
+        }
+    }
+}
+
 void
 BaseEventHandler::sendErrorResponseWithTimestamps(
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
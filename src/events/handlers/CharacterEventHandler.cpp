@@ -5,6 +5,8 @@
 #include "events/handlers/MobEventHandler.hpp"
 #include "events/handlers/NPCEventHandler.hpp"
 #include "events/handlers/WorldObjectEventHandler.hpp"
+#include "network/BinaryCodec.hpp"
+#include "network/JsonWriter.hpp"
 #include "utils/TimestampUtils.hpp"
 #include "utils/TimeUtils.hpp"
 #include <algorithm>
@@ -20,10 +22,11 @@ CharacterEventHandler::CharacterEventHandler(
       skillEventHandler_(nullptr),
       npcEventHandler_(nullptr),
       itemEventHandler_(nullptr),
-      mobEventHandler_(nullptr),
-      equipmentEventHandler_(nullptr)
+      mobEventHandler_(nullptr)
 {
     log_ = gameServices_.getLogger().getSystem("character");
+    speedBufferKey_ = gameServices_.getGameConfigService().key("movement.speed_buffer_multiplier");
+    snapshotNearRadiusKey_ = gameServices_.getGameConfigService().key("worldSnapshot.nearRadius");
 
     // Wire analytics: any packet built here is forwarded to game server which persists it.
     gameServices_.setAnalyticsSender([this](const std::string &data)
@@ -155,50 +158,10 @@ CharacterEventHandler::evictStaleSession(int characterId, int newClientId)
         return;
     }
 
-    // ── 1. Persist position ───────────────────────────────────────────────────
-    try
-    {
-        PositionStruct lastPos = staleChar.characterPosition;
-        nlohmann::json savePacket;
-        savePacket["header"]["eventType"] = "savePositions";
-        savePacket["header"]["clientId"] = 0;
-        savePacket["header"]["hash"] = "";
-        savePacket["body"]["characters"] = nlohmann::json::array();
-        nlohmann::json entry;
-        entry["characterId"] = characterId;
-        entry["posX"] = lastPos.positionX;
-        entry["posY"] = lastPos.positionY;
-        entry["posZ"] = lastPos.positionZ;
-        entry["rotZ"] = lastPos.rotationZ;
-        savePacket["body"]["characters"].push_back(entry);
-        gameServerWorker_.sendDataToGameServer(savePacket.dump() + "\n");
-        log_->info("[EVICT] Saved position for characterId: " + std::to_string(characterId));
-    }
-    catch (const std::exception &ex)
-    {
-        log_->error("[EVICT] Failed to save position for characterId: " + std::to_string(characterId) + " - " + ex.what());
-    }
-
-    // ── 2. Persist HP/Mana ───────────────────────────────────────────────────
-    try
-    {
-        nlohmann::json hpManaPacket;
-        hpManaPacket["header"]["eventType"] = "saveHpMana";
-        hpManaPacket["header"]["clientId"] = 0;
-        hpManaPacket["header"]["hash"] = "";
-        hpManaPacket["body"]["characters"] = nlohmann::json::array();
-        nlohmann::json hpEntry;
-        hpEntry["characterId"] = characterId;
-        hpEntry["currentHp"] = staleChar.characterCurrentHealth;
-        hpEntry["currentMana"] = staleChar.characterCurrentMana;
-        hpManaPacket["body"]["characters"].push_back(hpEntry);
-        gameServerWorker_.sendDataToGameServer(hpManaPacket.dump() + "\n");
-        log_->info("[EVICT] Saved HP/Mana for characterId: " + std::to_string(characterId));
-    }
-    catch (const std::exception &ex)
-    {
-        log_->error("[EVICT] Failed to save HP/Mana for characterId: " + std::to_string(characterId) + " - " + ex.what());
-    }
+    // ── 1-2. Stage position and HP/Mana; sent by flushCharacter() below ──────
+    auto &journal = gameServices_.getPersistenceJournal();
+    journal.stagePosition(characterId, staleChar.characterPosition);
+    journal.stageHpMana(characterId, staleChar.characterCurrentHealth, staleChar.characterCurrentMana);
 
     // ── 3. Flush quests / flags / reputation / mastery ────────────────────────
     try
@@ -237,8 +200,8 @@ CharacterEventHandler::evictStaleSession(int characterId, int newClientId)
             pkt["body"]["characterId"] = characterId;
             pkt["body"]["inventoryItemId"] = weapon->id;
             pkt["body"]["killCount"] = weapon->killCount;
-            gameServerWorker_.sendDataToGameServer(pkt.dump() + "\n");
-            log_->info("[EVICT] Flushed ItemSoul killCount=" + std::to_string(weapon->killCount) +
+            journal.stage(characterId, "itemKillCount:" + std::to_string(weapon->id), pkt.dump() + "\n");
+            log_->info("[EVICT] Staged ItemSoul killCount=" + std::to_string(weapon->killCount) +
                        " for invId=" + std::to_string(weapon->id) +
                        " charId=" + std::to_string(characterId));
         }
@@ -264,15 +227,19 @@ CharacterEventHandler::evictStaleSession(int characterId, int newClientId)
             ptPkt["body"]["sessionPlayTimeSec"] = remainingDelta;
             ptPkt["body"]["lastSessionPlayTimeSec"] = fullSessionSec;
             ptPkt["body"]["isDisconnect"] = true;
-            gameServerWorker_.sendDataToGameServer(ptPkt.dump() + "\n");
-            log_->info("[EVICT] Sent savePlayTime(disconnect) for characterId: " + std::to_string(characterId));
+            journal.stage(characterId, "playTimeFinal:" + std::to_string(characterId), ptPkt.dump() + "\n");
         }
     }
     catch (const std::exception &ex)
     {
-        log_->error("[EVICT] Failed to send savePlayTime for characterId: " + std::to_string(characterId) + " - " + ex.what());
+        log_->error("[EVICT] Failed to stage savePlayTime for characterId: " + std::to_string(characterId) + " - " + ex.what());
     }
 
+    // Staged play-time deltas go out before the final savePlayTime, quest/flag
+    // and kill-count writes after the position and HP/Mana rows.
+    journal.flushCharacter(characterId);
+    log_->info("[EVICT] Flushed persistence journal for characterId: " + std::to_string(characterId));
+
     // ── 5. Close any active trade session and notify the other party ──────────
     {
         auto *session = gameServices_.getTradeSessionManager().getSessionByCharacter(characterId);
@@ -299,6 +266,7 @@ CharacterEventHandler::evictStaleSession(int characterId, int newClientId)
 
     // ── 6. Remove from managers ──────────────────────────────────────────────
     gameServices_.getCharacterManager().removeCharacter(characterId);
+    gameServices_.getInterestManager().removeCharacter(characterId);
     if (staleClientId > 0)
     {
         gameServices_.getClientManager().removeClientData(staleClientId);
@@ -627,32 +595,15 @@ CharacterEventHandler::handleMoveCharacterEvent(const Event &event)
                     static constexpr float MIN_DELTA_MS = 16.0f;
                     const float effectiveDelta = (deltaMs < MIN_DELTA_MS) ? MIN_DELTA_MS : deltaMs;
 
-                    float moveSpeed = 7.0f;
-                    bool moveSpeedFound = false;
-                    for (const auto &attr : charData.attributes)
-                    {
-                        if (attr.slug == "move_speed")
-                        {
-                            moveSpeed = static_cast<float>(attr.value);
-                            moveSpeedFound = true;
-                            break;
-                        }
-                    }
-
-                    // Apply active effects that additively modify move_speed (non-tick stat modifiers).
-                    // Without this, speed buffs/debuffs from skills/items/quests are not accounted for,
-                    // causing false-positive positionCorrection rejections on the buffed client.
-                    {
-                        const int64_t nowSec = srvNowMs / 1000;
-                        for (const auto &eff : charData.activeEffects)
-                        {
-                            if (eff.attributeSlug == "move_speed" && eff.tickMs == 0 &&
-                                (eff.expiresAt == 0 || eff.expiresAt > nowSec))
-                            {
-                                moveSpeed += eff.value;
-                            }
-                        }
-                    }
+                    // Base move_speed plus additive buffs/debuffs from active effects.
+                    // Without the effect layer, speed buffs from skills/items/quests would
+                    // cause false-positive positionCorrection rejections on the buffed client.
+                    CharacterStatSheet statScratch;
+                    const CharacterStatSheet &stats = statSheetFor(charData, statScratch, srvNowMs / 1000);
+                    constexpr auto MOVE_SPEED_IDX = static_cast<std::size_t>(StatId::MOVE_SPEED);
+                    const bool moveSpeedFound = stats.inBase.test(MOVE_SPEED_IDX);
+                    const float moveSpeed = (moveSpeedFound ? static_cast<float>(stats.base[MOVE_SPEED_IDX]) : 7.0f) +
+                                            stats.staticEffect[MOVE_SPEED_IDX];
 
                     // move_speed is an abstract stat (DB stores e.g. 5), not world-space units/s.
                     // The client applies the same scale to set MaxWalkSpeed.
@@ -669,7 +620,7 @@ CharacterEventHandler::handleMoveCharacterEvent(const Event &event)
                         charData.activeEffects.size(),
                         moveSpeedUnits);
 
-                    const float speedBuffer = gameServices_.getGameConfigService().getFloat("movement.speed_buffer_multiplier", 1.3f);
+                    const float speedBuffer = gameServices_.getGameConfigService().getFloat(speedBufferKey_, 1.3f);
                     const float maxDist = moveSpeedUnits * (effectiveDelta / 1000.0f) * speedBuffer;
                     const float dx = movementData.position.positionX - charData.lastValidatedPosition.positionX;
                     const float dy = movementData.position.positionY - charData.lastValidatedPosition.positionY;
@@ -827,12 +778,6 @@ CharacterEventHandler::handleMoveCharacterEvent(const Event &event)
                 gameServices_.getLogger().logError("[Exploration] " + std::string(ex.what()));
             }
 
-            // Create minimal character data for response (only essential movement data)
-            nlohmann::json characterJson = {
-                {"id", movementData.characterId},
-                {"position", {{"x", movementData.position.positionX}, {"y", movementData.position.positionY}, {"z", movementData.position.positionZ}, {"rotationZ", movementData.position.rotationZ}}},
-                {"isFalling", movementData.isFalling}};
-
             // Validate authentication
             if (clientID == 0)
             {
@@ -840,20 +785,24 @@ CharacterEventHandler::handleMoveCharacterEvent(const Event &event)
                 return;
             }
 
-            // Prepare and broadcast movement response
-            nlohmann::json successResponse = ResponseBuilder()
-                                                 .setHeader("message", "Movement success for character!")
-                                                 .setHeader("hash", "")
-                                                 .setHeader("clientId", clientID)
-                                                 .setHeader("eventType", "moveCharacter")
-                                                 .setTimestamps(timestamps)
-                                                 .setBody("character", characterJson)
-                                                 .build();
-
             gameServices_.getLogger().log("Client data map size: " + std::to_string(gameServices_.getClientManager().getClientsList().size()));
 
-            // Broadcast to all clients with timestamps
-            broadcastToAllClientsWithTimestamps("success", successResponse, timestamps);
+            // Spawn/despawn snapshots for peers crossing the view radius, then send the
+            // movement only to clients that can see this player (plus the mover itself).
+            refreshInterest(movementData.characterId, clientID, movementData.position);
+
+            // Binary-wire clients get the compact frame; the JSON response is only built
+            // if at least one JSON client remains.
+            TimestampStruct sendTimestamps = timestamps;
+            TimestampUtils::setServerSendTimestamp(sendTimestamps);
+            auto binaryFrame = std::make_shared<const std::string>(
+                BinaryCodec::encodeCharacterMoved(clientID, movementData, sendTimestamps));
+
+            broadcastHotPacketToObservers(movementData.characterId, [&]()
+                {
+                    // Only essential movement data, streamed without a DOM
+                    return JsonPackets::encodeCharacterMoved(clientID, movementData, sendTimestamps); },
+                std::move(binaryFrame));
         }
         else
         {
@@ -893,7 +842,116 @@ CharacterEventHandler::broadcastTitleChanged(int characterId, int excludeClientI
                                   .build();
 
     std::string responseData = networkManager_.generateResponseMessage("success", response);
-    broadcastToAllClients(responseData, excludeClientId);
+    broadcastToObservers(characterId, responseData, excludeClientId);
+}
+
+nlohmann::json
+CharacterEventHandler::buildViewSnapshotEntry(int characterId, int clientId)
+{
+    CharacterDataStruct characterData = gameServices_.getCharacterManager().getCharacterData(characterId);
+    return nlohmann::json{
+        {"clientId", clientId},
+        {"character", characterToJson(characterData)},
+        {"slots", gameServices_.getEquipmentManager().buildEquipmentStateJson(characterId)}};
+}
+
+void
+CharacterEventHandler::refreshInterest(int characterId, int clientId, const PositionStruct &position)
+{
+    auto &interest = gameServices_.getInterestManager();
+    InterestDelta delta = interest.updateCharacter(characterId, clientId, position);
+    if (delta.empty())
+        return;
+
+    // Deltas are computed under the interest lock but sent from this lane; deliver
+    // them in computation order so another lane's later leave for the same pair
+    // cannot overtake this enter (or vice versa).
+    interest.deliverInOrder(delta.sequence, [&]()
+        { sendInterestDelta(characterId, clientId, delta); });
+}
+
+void
+CharacterEventHandler::sendInterestDelta(int characterId, int clientId, const InterestDelta &delta)
+{
+    auto &clientManager = gameServices_.getClientManager();
+    auto selfSocket = clientManager.getClientSocket(clientId);
+
+    if (!delta.entered.empty())
+    {
+        // Every peer gets the same snapshot of the mover; the mover gets one batched packet.
+        nlohmann::json selfSnapshot = ResponseBuilder()
+                                          .setHeader("message", "success")
+                                          .setHeader("eventType", "playerEnteredView")
+                                          .setHeader("clientId", clientId)
+                                          .setBody("players", nlohmann::json::array({buildViewSnapshotEntry(characterId, clientId)}))
+                                          .build();
+        auto selfSnapshotData = std::make_shared<const std::string>(
+            networkManager_.generateResponseMessage("success", selfSnapshot));
+
+        std::vector<int> peerClientIds;
+        nlohmann::json peersJson = nlohmann::json::array();
+        for (const auto &peer : delta.entered)
+        {
+            peerClientIds.push_back(peer.clientId);
+            peersJson.push_back(buildViewSnapshotEntry(peer.characterId, peer.clientId));
+        }
+
+        for (auto &sock : clientManager.getSocketsForClients(peerClientIds))
+        {
+            if (sock && sock->is_open())
+                networkManager_.sendResponse(sock, selfSnapshotData);
+        }
+
+        if (selfSocket && selfSocket->is_open())
+        {
+            nlohmann::json peersSnapshot = ResponseBuilder()
+                                               .setHeader("message", "success")
+                                               .setHeader("eventType", "playerEnteredView")
+                                               .setHeader("clientId", clientId)
+                                               .setBody("players", peersJson)
+                                               .build();
+            networkManager_.sendResponse(selfSocket,
+                networkManager_.generateResponseMessage("success", peersSnapshot));
+        }
+    }
+
+    if (!delta.left.empty())
+    {
+        nlohmann::json selfDespawn = ResponseBuilder()
+                                         .setHeader("message", "success")
+                                         .setHeader("eventType", "playerLeftView")
+                                         .setHeader("clientId", clientId)
+                                         .setBody("characterIds", nlohmann::json::array({characterId}))
+                                         .build();
+        auto selfDespawnData = std::make_shared<const std::string>(
+            networkManager_.generateResponseMessage("success", selfDespawn));
+
+        std::vector<int> peerClientIds;
+        nlohmann::json peerIds = nlohmann::json::array();
+        for (const auto &peer : delta.left)
+        {
+            peerClientIds.push_back(peer.clientId);
+            peerIds.push_back(peer.characterId);
+        }
+
+        for (auto &sock : clientManager.getSocketsForClients(peerClientIds))
+        {
+            if (sock && sock->is_open())
+                networkManager_.sendResponse(sock, selfDespawnData);
+        }
+
+        if (selfSocket && selfSocket->is_open())
+        {
+            nlohmann::json peersDespawn = ResponseBuilder()
+                                              .setHeader("message", "success")
+                                              .setHeader("eventType", "playerLeftView")
+                                              .setHeader("clientId", clientId)
+                                              .setBody("characterIds", peerIds)
+                                              .build();
+            networkManager_.sendResponse(selfSocket,
+                networkManager_.generateResponseMessage("success", peersDespawn));
+        }
+    }
 }
 
 void
@@ -918,49 +976,71 @@ CharacterEventHandler::pushConnectedCharactersToClient(
     std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
     int excludeCharacterId)
 {
-    auto allChars = gameServices_.getCharacterManager().getCharactersList();
+    WorldSnapshotStream stream(PositionStruct{});
+    appendConnectedCharactersSnapshot(clientID, excludeCharacterId, stream);
+    stream.send(networkManager_, clientSocket, -1.0f);
+}
 
-    nlohmann::json charactersListJson = nlohmann::json::array();
-    for (const auto &character : allChars)
-    {
-        if (character.characterId == 0)
-            continue;
-        if (excludeCharacterId > 0 && character.characterId == excludeCharacterId)
-            continue;
+void
+CharacterEventHandler::appendConnectedCharactersSnapshot(int clientID, int excludeCharacterId, WorldSnapshotStream &stream)
+{
+    // Both counters only grow, so their sum changes whenever either does
+    const uint64_t version = gameServices_.getCharacterManager().getMembershipVersion() +
+                             gameServices_.getEquipmentManager().getVersion();
+    auto fragments = connectedCharactersSnapshot_.get(version, [this](WorldSnapshotSection::Fragments &out)
+        {
+            for (const auto &character : gameServices_.getCharacterManager().getCharactersList())
+            {
+                if (character.characterId == 0)
+                    continue;
+
+                WorldSnapshotFragment fragment;
+                fragment.id = character.characterId;
+                fragment.ownerClientId = character.clientId;
+                fragment.x = character.characterPosition.positionX;
+                fragment.y = character.characterPosition.positionY;
+                fragment.json = nlohmann::json{
+                    {"clientId", character.clientId},
+                    {"character", characterToJson(character)}}
+                                    .dump();
+                fragment.extra = gameServices_.getEquipmentManager().buildEquipmentStateJson(character.characterId).dump();
+                out.push_back(std::move(fragment));
+            }
+        });
 
-        nlohmann::json fullEntry = {
-            {"clientId", character.clientId},
-            {"character", characterToJson(character)}};
-        charactersListJson.push_back(fullEntry);
-    }
+    auto included = [excludeCharacterId](const WorldSnapshotFragment &character)
+    { return excludeCharacterId <= 0 || character.id != excludeCharacterId; };
 
-    nlohmann::json response = ResponseBuilder()
-                                  .setHeader("message", "success")
-                                  .setHeader("eventType", "getConnectedCharacters")
-                                  .setHeader("clientId", clientID)
-                                  .setBody("characters", charactersListJson)
-                                  .build();
-    networkManager_.sendResponse(clientSocket,
-        networkManager_.generateResponseMessage("success", response));
+    // The full list first: the client spawns players from it
+    std::string list = JsonPackets::encodeEnvelope(clientID, "getConnectedCharacters", "success", nullptr,
+        [&](JsonWriter &w)
+        {
+            w.beginObject().key("characters").beginArray();
+            for (const auto &character : *fragments)
+            {
+                if (included(character))
+                    w.raw(character.json);
+            }
+            w.endArray().endObject();
+        });
+    stream.add(0.0f, 0.0f, std::move(list), true /* critical */);
 
     // Equipment for each character in the list
-    for (const auto &character : allChars)
+    for (const auto &character : *fragments)
     {
-        if (character.characterId == 0)
-            continue;
-        if (excludeCharacterId > 0 && character.characterId == excludeCharacterId)
+        if (!included(character))
             continue;
-
-        nlohmann::json eq = gameServices_.getEquipmentManager().buildEquipmentStateJson(character.characterId);
-        nlohmann::json eqResp = ResponseBuilder()
-                                    .setHeader("message", "success")
-                                    .setHeader("eventType", "PLAYER_EQUIPMENT_UPDATE")
-                                    .setHeader("clientId", character.clientId)
-                                    .setBody("characterId", character.characterId)
-                                    .setBody("slots", eq)
-                                    .build();
-        networkManager_.sendResponse(clientSocket,
-            networkManager_.generateResponseMessage("success", eqResp));
+        stream.add(character.x, character.y,
+            JsonPackets::encodeEnvelope(character.ownerClientId, "PLAYER_EQUIPMENT_UPDATE", "success", nullptr,
+                [&character](JsonWriter &w)
+                {
+                    w.beginObject()
+                        .field("characterId", character.id)
+                        .key("slots")
+                        .raw(character.extra)
+                        .endObject();
+                },
+                character.extra.size()));
     }
 }
 
@@ -1032,12 +1112,16 @@ CharacterEventHandler::handlePlayerReadyEvent(const Event &event)
         return;
     }
 
+    // 1-4. World state from cached, pre-serialized snapshots (NPCs, spawn zones,
+    //      ground items, online players + equipment), nearest first. Packets within
+    //      worldSnapshot.nearRadius go out now, ahead of the ack; the rest follow on
+    //      the bulk lane at the client's egress budget.
+    WorldSnapshotStream stream(characterData.characterPosition);
+
     // 1. NPCs in range
     if (npcEventHandler_)
     {
-        npcEventHandler_->sendNPCSpawnDataToClient(clientID, characterData.characterPosition, 50000.0f);
-        // 1b. NPC ambient speech pools (filtered per player context)
-        npcEventHandler_->sendAmbientPoolsToClient(clientID, characterId, characterData.characterPosition, 50000.0f);
+        npcEventHandler_->appendNPCSpawnSnapshot(clientID, characterId, 50000.0f, stream);
     }
     else
     {
@@ -1047,7 +1131,7 @@ CharacterEventHandler::handlePlayerReadyEvent(const Event &event)
     // 2. Mob spawn zones with live mob instances
     if (mobEventHandler_)
     {
-        mobEventHandler_->sendSpawnZonesToClient(clientID, clientSocket);
+        mobEventHandler_->appendSpawnZoneSnapshot(clientID, stream);
     }
     else
     {
@@ -1057,32 +1141,38 @@ CharacterEventHandler::handlePlayerReadyEvent(const Event &event)
     // 3. Ground items snapshot
     if (itemEventHandler_)
     {
-        itemEventHandler_->sendGroundItemsToClient(clientID, clientSocket);
+        const std::string hash = gameServices_.getClientManager().getClientData(clientID).hash;
+        itemEventHandler_->appendGroundItemsSnapshot(clientID, hash, characterData.characterPosition, 5000.0f, stream);
     }
 
     // 4. Full snapshot of every other online player: character data + equipment.
     //    The client needs full data (name, level, position, class) to spawn other
     //    players in the world — equipment-only is insufficient.
-    pushConnectedCharactersToClient(clientID, clientSocket, characterId);
-
-    // 5. Broadcast this player's own equipment to all other already-online clients.
-    //    Covers the race where SET_PLAYER_INVENTORY arrived before playerReady:
-    //    the isClientWorldReady guard in EventHandler::handleSetPlayerInventoryEvent
-    //    would have skipped the broadcast then, so we do it here as a catch-up.
-    //    If inventory hasn't arrived yet the broadcast is a no-op (all-null slots)
-    //    and the real update fires once SET_PLAYER_INVENTORY is processed.
-    if (equipmentEventHandler_)
+    appendConnectedCharactersSnapshot(clientID, characterId, stream);
+
+    const float nearRadius = gameServices_.getGameConfigService().getFloat(snapshotNearRadiusKey_, 5000.0f);
+    log_->info("[PLAYER_READY] streaming {} world-state packets to clientId={} (near radius {:.0f})",
+        stream.size(), clientID, nearRadius);
+    stream.send(networkManager_, clientSocket, nearRadius);
+
+    // 1b. NPC ambient speech pools (filtered per player context), after the NPCs they refer to
+    if (npcEventHandler_)
+        npcEventHandler_->sendAmbientPoolsToClient(clientID, characterId, characterData.characterPosition, 50000.0f);
+
+    // 5/6. This player's equipment and equipped title reach other online players via
+    //      the playerEnteredView snapshot sent when they enter the interest grid below.
+    //      With interest filtering disabled refreshInterest sends no snapshots, so
+    //      broadcast both to everyone as a catch-up. This also covers the race where
+    //      SET_PLAYER_INVENTORY / SET_PLAYER_TITLES arrived before playerReady and the
+    //      isClientWorldReady guard skipped their broadcasts; if they have not arrived
+    //      yet these are no-ops and the real broadcasts fire once they are processed.
+    if (!gameServices_.getInterestManager().isEnabled())
     {
-        equipmentEventHandler_->broadcastEquipmentUpdate(characterId, clientID);
+        if (equipmentEventHandler_)
+            equipmentEventHandler_->broadcastEquipmentUpdate(characterId, clientID);
+        broadcastTitleChanged(characterId, clientID);
     }
 
-    // 6. Broadcast this player's equipped title to all other already-online clients.
-    //    Mirrors the equipment catch-up above: if SET_PLAYER_TITLES arrived before
-    //    playerReady the zone broadcast was deferred to here; if titles haven't
-    //    loaded yet the slug will be "" (no title) and the real broadcast fires once
-    //    handleSetPlayerTitlesEvent processes the async response from Game Server.
-    broadcastTitleChanged(characterId, clientID);
-
     // Also push the current title state directly to this player.
     // sendTitleUpdateToClient() is called from loadPlayerTitles() when SET_PLAYER_TITLES
     // arrives, but that packet may arrive before playerReady (i.e. before the loading
@@ -1122,6 +1212,10 @@ CharacterEventHandler::handlePlayerReadyEvent(const Event &event)
                                        .build();
     broadcastToAllClientsWithTimestamps("success", joinBroadcast, timestamps, clientID);
 
+    // 8. Enter the interest grid: nearby players get a playerEnteredView snapshot of
+    //    this player (character, equipment, title) and this player gets one of them.
+    refreshInterest(characterId, clientID, characterData.characterPosition);
+
     log_->info("[PLAYER_READY] Phase 4 complete for char=" + std::to_string(characterId));
 }
 
@@ -1600,31 +1694,8 @@ CharacterEventHandler::handlePlayerRespawnEvent(const Event &event)
         }
 
         // ── Save HP/Mana and position to DB via game server ───────────────────
-        nlohmann::json hpManaPacket;
-        hpManaPacket["header"]["eventType"] = "saveHpMana";
-        hpManaPacket["header"]["clientId"] = 0;
-        hpManaPacket["header"]["hash"] = "";
-        hpManaPacket["body"]["characters"] = nlohmann::json::array();
-        nlohmann::json hpEntry;
-        hpEntry["characterId"] = characterId;
-        hpEntry["currentHp"] = newHp;
-        hpEntry["currentMana"] = newMana;
-        hpManaPacket["body"]["characters"].push_back(hpEntry);
-        gameServerWorker_.sendDataToGameServer(hpManaPacket.dump() + "\n");
-
-        nlohmann::json savePacket;
-        savePacket["header"]["eventType"] = "savePositions";
-        savePacket["header"]["clientId"] = 0;
-        savePacket["header"]["hash"] = "";
-        savePacket["body"]["characters"] = nlohmann::json::array();
-        nlohmann::json posEntry;
-        posEntry["characterId"] = characterId;
-        posEntry["posX"] = respawnPos.positionX;
-        posEntry["posY"] = respawnPos.positionY;
-        posEntry["posZ"] = respawnPos.positionZ;
-        posEntry["rotZ"] = respawnPos.rotationZ;
-        savePacket["body"]["characters"].push_back(posEntry);
-        gameServerWorker_.sendDataToGameServer(savePacket.dump() + "\n");
+        gameServices_.getPersistenceJournal().stageHpMana(characterId, newHp, newMana);
+        gameServices_.getPersistenceJournal().stagePosition(characterId, respawnPos);
 
         // ── Send stats update (HP/Mana/effects) ───────────────────────────────
         gameServices_.getStatsNotificationService().sendStatsUpdate(characterId);
@@ -1645,7 +1716,10 @@ CharacterEventHandler::handlePlayerRespawnEvent(const Event &event)
             networkManager_.sendResponse(clientSocket, msg);
         }
 
-        // Broadcast the character's new position to all players
+        // Re-evaluate view at the respawn point, then send the new position to
+        // everyone who can still (or now) see the character.
+        refreshInterest(characterId, clientId, respawnPos);
+
         nlohmann::json broadcastJson = ResponseBuilder()
                                            .setHeader("message", "Character respawned")
                                            .setHeader("hash", "")
@@ -1654,7 +1728,8 @@ CharacterEventHandler::handlePlayerRespawnEvent(const Event &event)
                                            .setTimestamps(req.timestamps)
                                             .setBody("character", nlohmann::json{{"id", characterId}, {"position", {{"x", respawnPos.positionX}, {"y", respawnPos.positionY}, {"z", respawnPos.positionZ}, {"rotationZ", respawnPos.rotationZ}}}, {"isFalling", false}})
                                            .build();
-        broadcastToAllClientsWithTimestamps("success", broadcastJson, req.timestamps);
+        broadcastToObservers(characterId,
+            networkManager_.generateResponseMessage("success", broadcastJson, req.timestamps));
 
         log_->info("[RESPAWN] character {} respawned at ({},{},{})", characterId, respawnPos.positionX, respawnPos.positionY, respawnPos.positionZ);
     }
@@ -88,12 +88,17 @@ ClientEventHandler::handleJoinClientEvent(const Event &event)
             // Record initial ping time for idle timeout detection
             gameServices_.getClientManager().recordPingTime(clientID);
 
+            // Switch hot packets to BinaryCodec frames if the client asked for it.
+            // The join response itself is still JSON and echoes the accepted protocol.
+            networkManager_.setBinaryWire(clientSocket, passedClientData.binaryWire);
+
             // Prepare success response and broadcast to all clients (including sender) with timestamps
             nlohmann::json broadcastResponse = ResponseBuilder()
                                                    .setHeader("message", "Authentication success for user!")
                                                    .setHeader("hash", passedClientData.hash)
                                                    .setHeader("clientId", passedClientData.clientId)
                                                    .setHeader("eventType", "joinGameClient")
+                                                   .setHeader("wireProtocol", passedClientData.binaryWire ? "binary" : "json")
                                                    .setTimestamps(timestamps)
                                                    .build();
 
@@ -233,7 +238,7 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                 }
                 else
                 {
-                    // Save play time to game server before other save operations
+                    // Final play time; flushCharacter() sends staged deltas ahead of it
                     try
                     {
                         auto now = std::chrono::steady_clock::now();
@@ -249,8 +254,8 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                             ptPkt["body"]["sessionPlayTimeSec"] = remainingDelta;
                             ptPkt["body"]["lastSessionPlayTimeSec"] = fullSessionSec;
                             ptPkt["body"]["isDisconnect"] = true;
-                            gameServerWorker_.sendDataToGameServer(ptPkt.dump() + "\n");
-                            log_->info("[DISCONNECT] Saved play time for characterId: " + std::to_string(passedClientData.characterId));
+                            gameServices_.getPersistenceJournal().stage(passedClientData.characterId,
+                                "playTimeFinal:" + std::to_string(passedClientData.characterId), ptPkt.dump() + "\n");
                         }
                     }
                     catch (const std::exception &ex)
@@ -260,54 +265,10 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                             std::to_string(passedClientData.characterId) + " - " + ex.what());
                     }
 
-                    // Save last known position to game server
-                    try
-                    {
-                        PositionStruct lastPos = charData.characterPosition;
-                        nlohmann::json savePacket;
-                        savePacket["header"]["eventType"] = "savePositions";
-                        savePacket["header"]["clientId"] = 0;
-                        savePacket["header"]["hash"] = "";
-                        savePacket["body"]["characters"] = nlohmann::json::array();
-                        nlohmann::json entry;
-                        entry["characterId"] = passedClientData.characterId;
-                        entry["posX"] = lastPos.positionX;
-                        entry["posY"] = lastPos.positionY;
-                        entry["posZ"] = lastPos.positionZ;
-                        entry["rotZ"] = lastPos.rotationZ;
-                        savePacket["body"]["characters"].push_back(entry);
-                        gameServerWorker_.sendDataToGameServer(savePacket.dump() + "\n");
-                        log_->info("[DISCONNECT] Saved position for characterId: " + std::to_string(passedClientData.characterId));
-                    }
-                    catch (const std::exception &ex)
-                    {
-                        gameServices_.getLogger().logError(
-                            "[DISCONNECT] Failed to save position for characterId: " +
-                            std::to_string(passedClientData.characterId) + " - " + ex.what());
-                    }
-
-                    // Save HP/Mana to game server
-                    try
-                    {
-                        nlohmann::json hpManaPacket;
-                        hpManaPacket["header"]["eventType"] = "saveHpMana";
-                        hpManaPacket["header"]["clientId"] = 0;
-                        hpManaPacket["header"]["hash"] = "";
-                        hpManaPacket["body"]["characters"] = nlohmann::json::array();
-                        nlohmann::json hpEntry;
-                        hpEntry["characterId"] = passedClientData.characterId;
-                        hpEntry["currentHp"] = charData.characterCurrentHealth;
-                        hpEntry["currentMana"] = charData.characterCurrentMana;
-                        hpManaPacket["body"]["characters"].push_back(hpEntry);
-                        gameServerWorker_.sendDataToGameServer(hpManaPacket.dump() + "\n");
-                        log_->info("[DISCONNECT] Saved HP/Mana for characterId: " + std::to_string(passedClientData.characterId));
-                    }
-                    catch (const std::exception &ex)
-                    {
-                        gameServices_.getLogger().logError(
-                            "[DISCONNECT] Failed to save HP/Mana for characterId: " +
-                            std::to_string(passedClientData.characterId) + " - " + ex.what());
-                    }
+                    // Last known position and HP/Mana; sent by flushCharacter() below
+                    gameServices_.getPersistenceJournal().stagePosition(passedClientData.characterId, charData.characterPosition);
+                    gameServices_.getPersistenceJournal().stageHpMana(
+                        passedClientData.characterId, charData.characterCurrentHealth, charData.characterCurrentMana);
                 }
             }
 
@@ -342,6 +303,7 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                     }
 
                     gameServices_.getCharacterManager().removeCharacter(passedClientData.characterId);
+                    gameServices_.getInterestManager().removeCharacter(passedClientData.characterId);
 
                     // Close any active trade session and notify the other party.
                     auto *session = gameServices_.getTradeSessionManager().getSessionByCharacter(passedClientData.characterId);
@@ -408,8 +370,9 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                         pkt["body"]["characterId"] = passedClientData.characterId;
                         pkt["body"]["inventoryItemId"] = weapon->id;
                         pkt["body"]["killCount"] = weapon->killCount;
-                        gameServerWorker_.sendDataToGameServer(pkt.dump() + "\n");
-                        log_->info("[DISCONNECT] Flushed ItemSoul killCount=" +
+                        gameServices_.getPersistenceJournal().stage(passedClientData.characterId,
+                            "itemKillCount:" + std::to_string(weapon->id), pkt.dump() + "\n");
+                        log_->info("[DISCONNECT] Staged ItemSoul killCount=" +
                                    std::to_string(weapon->killCount) +
                                    " for invId=" + std::to_string(weapon->id) +
                                    " charId=" + std::to_string(passedClientData.characterId));
@@ -421,6 +384,10 @@ ClientEventHandler::handleDisconnectClientEvent(const Event &event)
                         "[DISCONNECT] ItemSoul flush error for characterId: " +
                         std::to_string(passedClientData.characterId) + " - " + ex.what());
                 }
+
+                // Everything staged for this character (play time, position, HP/Mana,
+                // quests, flags, kill count) goes out now, in one batch.
+                gameServices_.getPersistenceJournal().flushCharacter(passedClientData.characterId);
             }
 
             // Prepare disconnect notification
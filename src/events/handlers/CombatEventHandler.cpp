@@ -1,4 +1,6 @@
 #include "events/handlers/CombatEventHandler.hpp"
+#include "events/handlers/CharacterEventHandler.hpp"
+#include "network/BinaryCodec.hpp"
 #include "network/NetworkManager.hpp"
 #include "services/ClientManager.hpp"
 #include "services/CombatResponseBuilder.hpp"
@@ -41,8 +43,10 @@ CombatEventHandler::sendBroadcast(const nlohmann::json &packet)
     try
     {
         std::string messageType = "success"; // По умолчанию success для AI атак
-        std::string responseData = networkManager_.generateResponseMessage(messageType, packet);
-        broadcastToAllClients(responseData);
+        // combatResult / effectTick / regen stats_update have a compact binary layout
+        broadcastHotPacket([&]()
+            { return networkManager_.generateResponseMessage(messageType, packet); },
+            BinaryCodec::encodeFromJson(packet));
     }
     catch (const std::exception &ex)
     {
@@ -238,7 +242,6 @@ CombatEventHandler::updateOngoingActions()
     try
     {
         auto results = combatSystem_->updateOngoingActions();
-        combatSystem_->tickEffects();
 
         // Handle deferred skill results that require server-side follow-up
         // (e.g. teleport_respawn cast-time skills whose hasTeleport flag is set).
@@ -269,24 +272,13 @@ CombatEventHandler::updateOngoingActions()
                 }
 
                 // 2. Persist position
-                {
-                    nlohmann::json savePos;
-                    savePos["header"]["eventType"] = "savePositions";
-                    savePos["header"]["clientId"] = 0;
-                    savePos["header"]["hash"] = "";
-                    savePos["body"]["characters"] = nlohmann::json::array();
-                    nlohmann::json posEntry;
-                    posEntry["characterId"] = characterId;
-                    posEntry["posX"] = dest.positionX;
-                    posEntry["posY"] = dest.positionY;
-                    posEntry["posZ"] = dest.positionZ;
-                    posEntry["rotZ"] = dest.rotationZ;
-                    savePos["body"]["characters"].push_back(posEntry);
-                    gameServerWorker_.sendDataToGameServer(savePos.dump() + "\n");
-                }
+                gameServices_.getPersistenceJournal().stagePosition(characterId, dest);
 
-                // 3. Broadcast position update to other players
+                // 3. Broadcast position update to players that can see the caster
                 {
+                    if (characterEventHandler_)
+                        characterEventHandler_->refreshInterest(characterId, casterClientId, dest);
+
                     nlohmann::json posBroadcast;
                     posBroadcast["header"]["eventType"] = "characterMoved";
                     posBroadcast["body"]["characterId"] = characterId;
@@ -294,7 +286,7 @@ CombatEventHandler::updateOngoingActions()
                     posBroadcast["body"]["posY"] = dest.positionY;
                     posBroadcast["body"]["posZ"] = dest.positionZ;
                     posBroadcast["body"]["rotZ"] = dest.rotationZ;
-                    broadcastToAllClients(posBroadcast.dump() + "\n", casterClientId);
+                    broadcastToObservers(characterId, posBroadcast.dump() + "\n", casterClientId);
                 }
 
                 // Reset server-side movement validation state so the next
@@ -332,6 +324,12 @@ CombatEventHandler::updateOngoingActions()
     }
 }
 
+void
+CombatEventHandler::tickEffects()
+{
+    combatSystem_->tickEffects();
+}
+
 bool
 CombatEventHandler::parsePlayerAttackRequest(const nlohmann::json &requestData,
     std::string &skillSlug,
@@ -572,24 +570,13 @@ CombatEventHandler::dispatchSkillAction(int characterId,
         }
 
         // 2. Persist the new position to the game server
-        {
-            nlohmann::json savePos;
-            savePos["header"]["eventType"] = "savePositions";
-            savePos["header"]["clientId"] = 0;
-            savePos["header"]["hash"] = "";
-            savePos["body"]["characters"] = nlohmann::json::array();
-            nlohmann::json posEntry;
-            posEntry["characterId"] = characterId;
-            posEntry["posX"] = dest.positionX;
-            posEntry["posY"] = dest.positionY;
-            posEntry["posZ"] = dest.positionZ;
-            posEntry["rotZ"] = dest.rotationZ;
-            savePos["body"]["characters"].push_back(posEntry);
-            gameServerWorker_.sendDataToGameServer(savePos.dump() + "\n");
-        }
+        gameServices_.getPersistenceJournal().stagePosition(characterId, dest);
 
-        // 3. Broadcast position update to all other players in the chunk
+        // 3. Broadcast position update to players that can see the caster
         {
+            if (characterEventHandler_)
+                characterEventHandler_->refreshInterest(characterId, casterClientId, dest);
+
             nlohmann::json posBroadcast;
             posBroadcast["header"]["eventType"] = "characterMoved";
             posBroadcast["body"]["characterId"] = characterId;
@@ -597,7 +584,7 @@ CombatEventHandler::dispatchSkillAction(int characterId,
             posBroadcast["body"]["posY"] = dest.positionY;
             posBroadcast["body"]["posZ"] = dest.positionZ;
             posBroadcast["body"]["rotZ"] = dest.rotationZ;
-            broadcastToAllClients(posBroadcast.dump() + "\n", casterClientId);
+            broadcastToObservers(characterId, posBroadcast.dump() + "\n", casterClientId);
         }
 
         // Reset server-side movement validation state so the next
@@ -163,8 +163,8 @@ EmoteEventHandler::handleUseEmoteEvent(const Event &event)
             return;
         }
 
-        // Broadcast emote action to ALL clients in the zone (including the sender — client
-        // can optimistically play locally, but authoritative broadcast confirms it)
+        // Broadcast emote action to every client that can see the player (including the
+        // sender — client can optimistically play locally, but authoritative broadcast confirms it)
         nlohmann::json broadcast;
         broadcast["header"]["eventType"] = "emoteAction";
         broadcast["header"]["status"] = "success";
@@ -173,7 +173,7 @@ EmoteEventHandler::handleUseEmoteEvent(const Event &event)
         broadcast["body"]["animationName"] = def.animationName;
         broadcast["body"]["serverTimestamp"] = req.timestamps.serverRecvMs;
 
-        broadcastToAllClients(
+        broadcastToObservers(req.characterId,
             networkManager_.generateResponseMessage("success", broadcast));
 
         log_->info("[Emote] char={} plays emote '{}'", req.characterId, req.emoteSlug);
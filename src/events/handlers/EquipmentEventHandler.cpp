@@ -74,7 +74,7 @@ EquipmentEventHandler::broadcastEquipmentUpdate(int characterId, int excludeClie
                                   .build();
 
     std::string responseData = networkManager_.generateResponseMessage("success", response);
-    broadcastToAllClients(responseData, excludeClientId);
+    broadcastToObservers(characterId, responseData, excludeClientId);
 }
 
 void
@@ -1,6 +1,8 @@
 #include "events/handlers/ItemEventHandler.hpp"
 #include "events/Event.hpp"
+#include "network/JsonWriter.hpp"
 #include "utils/ResponseBuilder.hpp"
+#include <algorithm>
 #include <cmath>
 #include <spdlog/logger.h>
 
@@ -695,24 +697,63 @@ ItemEventHandler::sendGroundItemsToClient(int clientId,
     ClientDataStruct clientData = gameServices_.getClientManager().getClientData(clientId);
     PositionStruct playerPos = gameServices_.getCharacterManager().getCharacterPosition(clientData.characterId);
 
-    auto nearbyItems = gameServices_.getLootManager().getDroppedItemsNearPosition(playerPos, lootRadius);
+    WorldSnapshotStream stream(playerPos);
+    appendGroundItemsSnapshot(clientId, clientData.hash, playerPos, lootRadius, stream);
+    stream.send(networkManager_, clientSocket, -1.0f);
+}
 
-    nlohmann::json itemsArray = nlohmann::json::array();
-    for (const auto &drop : nearbyItems)
-        itemsArray.push_back(droppedItemToJson(drop));
+void
+ItemEventHandler::appendGroundItemsSnapshot(int clientId, const std::string &hash, const PositionStruct &playerPos,
+    float lootRadius, WorldSnapshotStream &stream)
+{
+    auto &lootManager = gameServices_.getLootManager();
+    auto fragments = groundItemsSnapshot_.get(lootManager.getMembershipVersion(), [this, &lootManager](WorldSnapshotSection::Fragments &out)
+        {
+            for (const auto &[uid, drop] : lootManager.getAllDroppedItems())
+            {
+                if (!drop.canBePickedUp)
+                    continue;
+                WorldSnapshotFragment fragment;
+                fragment.id = uid;
+                fragment.x = drop.position.positionX;
+                fragment.y = drop.position.positionY;
+                fragment.json = droppedItemToJson(drop).dump();
+                out.push_back(std::move(fragment));
+            }
+        });
 
-    nlohmann::json response = ResponseBuilder()
-                                  .setHeader("message", "success")
-                                  .setHeader("eventType", "itemDrop")
-                                  .setHeader("hash", clientData.hash)
-                                  .setHeader("clientId", clientId)
-                                  .setBody("items", itemsArray)
-                                  .build();
+    const float radiusSq = lootRadius * lootRadius;
+    std::vector<std::pair<float, const WorldSnapshotFragment *>> nearby;
+    for (const auto &fragment : *fragments)
+    {
+        const float distanceSq = stream.distanceSq(fragment.x, fragment.y);
+        if (distanceSq <= radiusSq)
+            nearby.emplace_back(distanceSq, &fragment);
+    }
+    std::sort(nearby.begin(), nearby.end(), [](const auto &a, const auto &b)
+        { return a.first < b.first; });
 
-    networkManager_.sendResponse(clientSocket,
-        networkManager_.generateResponseMessage("success", response));
+    // An empty snapshot is still sent, as before
+    size_t begin = 0;
+    do
+    {
+        const size_t end = std::min(nearby.size(), begin + GROUND_ITEMS_CHUNK);
+        std::string packet = JsonPackets::encodeEnvelope(clientId, "itemDrop", "success", hash.c_str(),
+            [&](JsonWriter &w)
+            {
+                w.beginObject().key("items").beginArray();
+                for (size_t i = begin; i < end; ++i)
+                    w.raw(nearby[i].second->json);
+                w.endArray().endObject();
+            });
+        if (begin < end)
+            stream.add(nearby[begin].second->x, nearby[begin].second->y, std::move(packet));
+        else
+            stream.add(playerPos.positionX, playerPos.positionY, std::move(packet));
+        begin = end;
+    } while (begin < nearby.size());
 
-    log_->info("[LOOT] Sent " + std::to_string(itemsArray.size()) +
+    log_->info("[LOOT] Sent " + std::to_string(nearby.size()) +
                " ground items snapshot to client " + std::to_string(clientId));
 }
 
@@ -1,6 +1,9 @@
 #include "events/handlers/MobEventHandler.hpp"
 #include "events/EventData.hpp"
+#include "network/BinaryCodec.hpp"
+#include "network/JsonWriter.hpp"
 #include "utils/TimestampUtils.hpp"
+#include <algorithm>
 #include <spdlog/logger.h>
 
 MobEventHandler::MobEventHandler(
@@ -109,33 +112,58 @@ MobEventHandler::sendSpawnZonesToClient(int clientID, std::shared_ptr<boost::asi
     if (!clientSocket || !clientSocket->is_open())
         return;
 
-    auto allSpawnZones = gameServices_.getSpawnZoneManager().getMobSpawnZones();
-    log_->info("[MobEventHandler] Server-push: sending {} spawn zones to client {}", allSpawnZones.size(), clientID);
-
-    for (const auto &[zoneId, spawnZone] : allSpawnZones)
-    {
-        std::vector<MobDataStruct> mobsList = gameServices_.getMobInstanceManager().getMobInstancesInZone(spawnZone.zoneId);
-        if (mobsList.empty())
-            continue;
+    WorldSnapshotStream stream(PositionStruct{});
+    appendSpawnZoneSnapshot(clientID, stream);
+    stream.send(networkManager_, clientSocket, -1.0f);
+}
 
-        nlohmann::json mobsArray = nlohmann::json::array();
-        for (const auto &mob : mobsList)
+void
+MobEventHandler::appendSpawnZoneSnapshot(int clientID, WorldSnapshotStream &stream)
+{
+    auto fragments = spawnZoneSnapshot_.get(gameServices_.getMobInstanceManager().getMembershipVersion(),
+        [this](WorldSnapshotSection::Fragments &out)
         {
-            nlohmann::json mobJson = mobToJson(mob);
-            mobJson["combatState"] = static_cast<int>(gameServices_.getMobMovementManager().getMobMovementData(mob.uid).combatState);
-            mobsArray.push_back(mobJson);
-        }
+            for (const auto &[zoneId, spawnZone] : gameServices_.getSpawnZoneManager().getMobSpawnZones())
+            {
+                std::vector<MobDataStruct> mobsList = gameServices_.getMobInstanceManager().getMobInstancesInZone(spawnZone.zoneId);
+                if (mobsList.empty())
+                    continue;
+
+                WorldSnapshotFragment fragment;
+                fragment.id = spawnZone.zoneId;
+                if (spawnZone.shape == ZoneShape::RECT)
+                {
+                    fragment.x = (spawnZone.minX + spawnZone.maxX) * 0.5f;
+                    fragment.y = (spawnZone.minY + spawnZone.maxY) * 0.5f;
+                }
+                else
+                {
+                    fragment.x = spawnZone.centerX;
+                    fragment.y = spawnZone.centerY;
+                }
+
+                JsonWriter w(fragment.json);
+                w.beginObject().field("zoneId", spawnZone.zoneId).key("mobs").beginArray();
+                for (const auto &mob : mobsList)
+                {
+                    nlohmann::json mobJson = mobToJson(mob);
+                    mobJson["combatState"] = static_cast<int>(gameServices_.getMobMovementManager().getMobMovementData(mob.uid).combatState);
+                    w.value(mobJson);
+                }
+                w.endArray().endObject();
+                out.push_back(std::move(fragment));
+            }
+        });
 
-        nlohmann::json response = ResponseBuilder()
-                                      .setHeader("message", "Spawning mobs success!")
-                                      .setHeader("hash", "")
-                                      .setHeader("clientId", clientID)
-                                      .setHeader("eventType", "spawnMobsInZone")
-                                      .setBody("zoneId", spawnZone.zoneId)
-                                      .setBody("mobs", mobsArray)
-                                      .build();
+    log_->info("[MobEventHandler] Server-push: sending {} spawn zones to client {}", fragments->size(), clientID);
 
-        networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+    for (const auto &zone : *fragments)
+    {
+        stream.add(zone.x, zone.y,
+            JsonPackets::encodeEnvelope(clientID, "spawnMobsInZone", "Spawning mobs success!", "",
+                [&zone](JsonWriter &w)
+                { w.raw(zone.json); },
+                zone.json.size()));
     }
 }
 
@@ -504,54 +532,112 @@ MobEventHandler::handleMobMoveUpdateEvent(const Event &event)
 
     try
     {
-        if (!std::holds_alternative<std::vector<MobMoveUpdateStruct>>(data))
+        if (!std::holds_alternative<MobMoveUpdateBatchStruct>(data))
         {
             log_->error("Invalid data type for MOB_MOVE_UPDATE event");
             return;
         }
 
-        const auto &movedMobs = std::get<std::vector<MobMoveUpdateStruct>>(data);
-
-        nlohmann::json mobsArray = nlohmann::json::array();
-        for (const auto &mob : movedMobs)
-        {
-            nlohmann::json entry = {{"uid", mob.uid},
-                {"zoneId", mob.zoneId},
-                {"position", {{"x", mob.position.positionX}, {"y", mob.position.positionY}, {"z", mob.position.positionZ}, {"rotationZ", mob.position.rotationZ}}},
-                {"velocity", {{"dirX", mob.dirX}, {"dirY", mob.dirY}, {"speed", mob.speed}}},
-                {"combatState", mob.combatState},
-                {"stepTimestampMs", mob.stepTimestampMs}};
-
-            if (mob.hasWaypoint)
-            {
-                entry["waypoint"] = {{"x", mob.waypointX}, {"y", mob.waypointY}};
-            }
-
-            mobsArray.push_back(std::move(entry));
-        }
+        const auto &batch = std::get<MobMoveUpdateBatchStruct>(data);
 
         if (clientID == 0 || !clientSocket || !clientSocket->is_open())
         {
             log_->error("MOB_MOVE_UPDATE: invalid client " + std::to_string(clientID));
             return;
         }
+        if (!batch.fragments || batch.indices.empty())
+            return;
 
-        nlohmann::json response = ResponseBuilder()
-                                      .setHeader("message", "Mob movement update")
-                                      .setHeader("hash", "")
-                                      .setHeader("clientId", clientID)
-                                      .setHeader("eventType", "mobMoveUpdate")
-                                      .setHeader("serverSendMs", TimestampUtils::getCurrentTimestampMs())
-                                      .setBody("mobs", mobsArray)
-                                      .build();
+        // Lets a newer update replace this one while it waits in a lagging client's bulk lane
+        std::vector<int> mobUids;
+        mobUids.reserve(batch.indices.size());
+        for (uint32_t i : batch.indices)
+            mobUids.push_back(batch.fragments->uids[i]);
+        std::sort(mobUids.begin(), mobUids.end());
+
+        // The tick's mobs were serialized once by the replication step; only the
+        // envelope is written here and the client's fragments are copied in.
+        // A client that switched to binary after the tick was encoded gets this one as JSON.
+        if (!batch.fragments->binaryFrame.empty() && networkManager_.isBinaryWire(clientSocket))
+        {
+            networkManager_.sendResponseBulk(clientSocket,
+                BinaryCodec::assembleMobMoveUpdate(*batch.fragments, batch.indices, TimestampUtils::getCurrentTimestampMs()),
+                std::move(mobUids));
+            return;
+        }
 
-        std::string responseData = networkManager_.generateResponseMessage("success", response);
+        std::string responseData = JsonPackets::assembleMobMoveUpdate(clientID, *batch.fragments, batch.indices);
         // Use bulk priority so mob position updates never block combat/stats packets
         // that might already be queued in the per-socket critical priority lane.
-        networkManager_.sendResponseBulk(clientSocket, std::make_shared<const std::string>(std::move(responseData)));
+        networkManager_.sendResponseBulk(clientSocket, std::make_shared<const std::string>(std::move(responseData)), std::move(mobUids));
     }
     catch (const std::bad_variant_access &ex)
     {
         gameServices_.getLogger().logError("Error in handleMobMoveUpdateEvent: " + std::string(ex.what()));
     }
 }
+
+void
+MobEventHandler::handleMobViewDeltaEvent(const Event &event)
+{
+    const auto &data = event.getData();
+    int clientID = event.getClientID();
+    std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket = getClientSocket(event);
+
+    try
+    {
+        if (!std::holds_alternative<MobViewDeltaStruct>(data))
+        {
+            log_->error("Invalid data type for MOB_VIEW_DELTA event");
+            return;
+        }
+
+        const auto &delta = std::get<MobViewDeltaStruct>(data);
+
+        if (clientID == 0 || !clientSocket || !clientSocket->is_open())
+            return;
+
+        if (!delta.enteredUids.empty())
+        {
+            nlohmann::json mobsArray = nlohmann::json::array();
+            for (int uid : delta.enteredUids)
+            {
+                MobDataStruct mob = gameServices_.getMobInstanceManager().getMobInstance(uid);
+                if (mob.uid == 0 || mob.isDead)
+                    continue;
+
+                nlohmann::json mobJson = mobToJson(mob);
+                mobJson["combatState"] = static_cast<int>(gameServices_.getMobMovementManager().getMobMovementData(uid).combatState);
+                mobsArray.push_back(std::move(mobJson));
+            }
+
+            if (!mobsArray.empty())
+            {
+                nlohmann::json response = ResponseBuilder()
+                                              .setHeader("message", "success")
+                                              .setHeader("hash", "")
+                                              .setHeader("clientId", clientID)
+                                              .setHeader("eventType", "mobEnteredView")
+                                              .setBody("mobs", mobsArray)
+                                              .build();
+                networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+            }
+        }
+
+        if (!delta.leftUids.empty())
+        {
+            nlohmann::json response = ResponseBuilder()
+                                          .setHeader("message", "success")
+                                          .setHeader("hash", "")
+                                          .setHeader("clientId", clientID)
+                                          .setHeader("eventType", "mobLeftView")
+                                          .setBody("uids", delta.leftUids)
+                                          .build();
+            networkManager_.sendResponse(clientSocket, networkManager_.generateResponseMessage("success", response));
+        }
+    }
+    catch (const std::bad_variant_access &ex)
+    {
+        gameServices_.getLogger().logError("Error in handleMobViewDeltaEvent: " + std::string(ex.what()));
+    }
+}
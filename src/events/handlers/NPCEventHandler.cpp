@@ -1,7 +1,9 @@
 #include "events/handlers/NPCEventHandler.hpp"
 #include "events/EventData.hpp"
+#include "network/JsonWriter.hpp"
 #include "utils/ResponseBuilder.hpp"
 #include "utils/TerminalColors.hpp"
+#include <algorithm>
 #include <spdlog/logger.h>
 
 NPCEventHandler::NPCEventHandler(
@@ -91,61 +93,19 @@ NPCEventHandler::sendNPCSpawnDataToClient(int clientId, const PositionStruct &pl
 {
     try
     {
-        if (!gameServices_.getNPCManager().isNPCsLoaded())
-        {
-            log_->info("NPCs not loaded yet, cannot send spawn data to client " + std::to_string(clientId));
-            return;
-        }
-
-        // Get NPCs in area around player
-        std::vector<NPCDataStruct> nearbyNPCs = gameServices_.getNPCManager().getNPCsInArea(
-            playerPosition.positionX,
-            playerPosition.positionY,
-            spawnRadius);
-
-        if (nearbyNPCs.empty())
+        auto clientSocket = gameServices_.getClientManager().getClientSocket(clientId);
+        if (!clientSocket)
         {
-            log_->debug("No NPCs found near player " + std::to_string(clientId));
+            log_->error("Client socket not found for client " + std::to_string(clientId));
             return;
         }
 
-        // Convert NPCs to JSON array
-        nlohmann::json npcsSpawnJson = nlohmann::json::array();
-
         // Get character ID for this client so we can compute per-player quest status
         const int characterId = gameServices_.getClientManager().getClientData(clientId).characterId;
 
-        for (const auto &npc : nearbyNPCs)
-        {
-            npcsSpawnJson.push_back(convertNPCToSpawnJson(npc, characterId));
-        }
-
-        // Build response message
-        nlohmann::json response = ResponseBuilder()
-                                      .setHeader("message", "NPCs spawn data for area")
-                                      .setHeader("hash", "")
-                                      .setHeader("clientId", clientId)
-                                      .setHeader("eventType", "spawnNPCs")
-                                      .setBody("npcsSpawn", npcsSpawnJson)
-                                      .setBody("spawnRadius", spawnRadius)
-                                      .setBody("npcCount", nearbyNPCs.size())
-                                      .build();
-
-        // Send response to client
-        auto clientSocket = gameServices_.getClientManager().getClientSocket(clientId);
-        if (clientSocket)
-        {
-            std::string responseData = networkManager_.generateResponseMessage("success", response);
-            networkManager_.sendResponse(clientSocket, responseData);
-        }
-        else
-        {
-            log_->error("Client socket not found for client " + std::to_string(clientId));
-        }
-
-        gameServices_.getLogger().log(
-            "Sent " + std::to_string(nearbyNPCs.size()) + " NPCs spawn data to client " + std::to_string(clientId),
-            GREEN);
+        WorldSnapshotStream stream(playerPosition);
+        appendNPCSpawnSnapshot(clientId, characterId, spawnRadius, stream);
+        stream.send(networkManager_, clientSocket, -1.0f);
     }
     catch (const std::exception &ex)
     {
@@ -154,33 +114,103 @@ NPCEventHandler::sendNPCSpawnDataToClient(int clientId, const PositionStruct &pl
     }
 }
 
-nlohmann::json
-NPCEventHandler::convertNPCToSpawnJson(const NPCDataStruct &npc, int characterId)
+void
+NPCEventHandler::appendNPCSpawnSnapshot(int clientId, int characterId, float spawnRadius, WorldSnapshotStream &stream)
 {
-    // Build per-quest status array for this NPC x this character
-    // Possible statuses: available | in_progress | completable | turned_in | failed
-    nlohmann::json questsJson = nlohmann::json::array();
-    for (const auto &slug : npc.questSlugs)
+    auto &npcManager = gameServices_.getNPCManager();
+    if (!npcManager.isNPCsLoaded())
+    {
+        log_->info("NPCs not loaded yet, cannot send spawn data to client " + std::to_string(clientId));
+        return;
+    }
+
+    auto fragments = npcSnapshot_.get(npcManager.getVersion(), [this, &npcManager](WorldSnapshotSection::Fragments &out)
+        {
+            for (const auto &npc : npcManager.getAllNPCs())
+            {
+                WorldSnapshotFragment fragment;
+                fragment.id = npc.id;
+                fragment.x = npc.position.positionX;
+                fragment.y = npc.position.positionY;
+                fragment.json = convertNPCToSpawnJson(npc).dump();
+                fragment.refs = npc.questSlugs;
+                out.push_back(std::move(fragment));
+            }
+        });
+
+    // Nearest first, in chunks of NPC_SPAWN_CHUNK
+    const float radiusSq = spawnRadius * spawnRadius;
+    std::vector<std::pair<float, const WorldSnapshotFragment *>> nearby;
+    for (const auto &fragment : *fragments)
+    {
+        const float distanceSq = stream.distanceSq(fragment.x, fragment.y);
+        if (distanceSq <= radiusSq)
+            nearby.emplace_back(distanceSq, &fragment);
+    }
+    if (nearby.empty())
+    {
+        log_->debug("No NPCs found near player " + std::to_string(clientId));
+        return;
+    }
+    std::sort(nearby.begin(), nearby.end(), [](const auto &a, const auto &b)
+        { return a.first < b.first; });
+
+    for (size_t begin = 0; begin < nearby.size(); begin += NPC_SPAWN_CHUNK)
     {
-        const std::string state = characterId > 0
-                                      ? gameServices_.getQuestManager().getQuestStateBySlug(characterId, slug)
-                                      : "";
-
-        std::string status;
-        if (state.empty() || state == "offered")
-            status = "available";
-        else if (state == "active")
-            status = "in_progress";
-        else if (state == "completed")
-            status = "completable";
-        else if (state == "turned_in")
-            status = "turned_in";
-        else // failed
-            status = state;
-
-        questsJson.push_back({{"slug", slug}, {"status", status}});
+        const size_t end = std::min(nearby.size(), begin + NPC_SPAWN_CHUNK);
+        std::string packet = JsonPackets::encodeEnvelope(clientId, "spawnNPCs", "NPCs spawn data for area", "",
+            [&](JsonWriter &w)
+            {
+                w.beginObject().key("npcsSpawn").beginArray();
+                for (size_t i = begin; i < end; ++i)
+                {
+                    const WorldSnapshotFragment &npc = *nearby[i].second;
+                    w.beginRawObject(npc.json).key("quests").beginArray();
+                    for (const auto &slug : npc.refs)
+                    {
+                        w.beginObject()
+                            .field("slug", slug)
+                            .field("status", questStatusForNPC(characterId, slug))
+                            .endObject();
+                    }
+                    w.endArray().endObject();
+                }
+                w.endArray()
+                    .field("spawnRadius", spawnRadius)
+                    .field("npcCount", end - begin)
+                    .endObject();
+            });
+        const WorldSnapshotFragment &first = *nearby[begin].second;
+        stream.add(first.x, first.y, std::move(packet), true /* critical */);
     }
 
+    gameServices_.getLogger().log(
+        "Sent " + std::to_string(nearby.size()) + " NPCs spawn data to client " + std::to_string(clientId),
+        GREEN);
+}
+
+std::string
+NPCEventHandler::questStatusForNPC(int characterId, const std::string &questSlug)
+{
+    const std::string state = characterId > 0
+                                  ? gameServices_.getQuestManager().getQuestStateBySlug(characterId, questSlug)
+                                  : "";
+
+    if (state.empty() || state == "offered")
+        return "available";
+    if (state == "active")
+        return "in_progress";
+    if (state == "completed")
+        return "completable";
+    if (state == "turned_in")
+        return "turned_in";
+    return state; // failed
+}
+
+nlohmann::json
+NPCEventHandler::convertNPCToSpawnJson(const NPCDataStruct &npc)
+{
+    // "quests" is per character and appended on assembly (appendNPCSpawnSnapshot)
     nlohmann::json npcJson = {
         {"id", npc.id},
         {"name", npc.name},
@@ -190,7 +220,6 @@ NPCEventHandler::convertNPCToSpawnJson(const NPCDataStruct &npc, int characterId
         {"npcType", npc.npcType},
         {"isInteractable", npc.isInteractable},
         {"dialogueId", npc.dialogueId},
-        {"quests", questsJson},
         {"stats", {{"health", {{"current", npc.currentHealth}, {"max", npc.maxHealth}}}, {"mana", {{"current", npc.currentMana}, {"max", npc.maxMana}}}}},
         {"position", {{"x", npc.position.positionX}, {"y", npc.position.positionY}, {"z", npc.position.positionZ}, {"rotationZ", npc.position.rotationZ}}},
         {"attributes", nlohmann::json::array()}};
@@ -67,7 +67,9 @@ VendorEventHandler::saveDurabilityChange(int characterId, int inventoryItemId, i
     pkt["body"]["characterId"] = characterId;
     pkt["body"]["inventoryItemId"] = inventoryItemId;
     pkt["body"]["durabilityCurrent"] = newDurability;
-    gameServerWorker_.sendDataToGameServer(pkt.dump() + "\n");
+    // Same journal key as combat wear, so the repaired value replaces a pending
+    // pre-repair write instead of racing it to the game server.
+    gameServices_.getPersistenceJournal().stage(characterId, "durability:" + std::to_string(inventoryItemId), pkt.dump() + "\n");
 }
 
 void
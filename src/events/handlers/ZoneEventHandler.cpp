@@ -145,6 +145,7 @@ ZoneEventHandler::handleSetGameZonesEvent(const Event &event)
         {
             std::vector<GameZoneStruct> zones = std::get<std::vector<GameZoneStruct>>(data);
             gameServices_.getGameZoneManager().loadGameZones(zones);
+            gameServices_.getNavigationManager().loadGameZoneGrids(zones);
             log_->info("[ZoneEventHandler] Loaded {} game zones", zones.size());
         }
         else
@@ -6,14 +6,13 @@ MessageHandler::MessageHandler(JSONParser &jsonParser) : jsonParser_(jsonParser)
 std::tuple<std::string, ClientDataStruct, CharacterDataStruct, PositionStruct, MessageStruct>
 MessageHandler::parseMessage(const std::string &message)
 {
-    const char *data = message.data();
-    size_t messageLength = message.size();
+    nlohmann::json jsonData = nlohmann::json::parse(message);
 
-    std::string eventType = jsonParser_.parseEventType(data, messageLength);
-    ClientDataStruct clientData = jsonParser_.parseClientData(data, messageLength);
-    CharacterDataStruct characterData = jsonParser_.parseCharacterData(data, messageLength);
-    PositionStruct positionData = jsonParser_.parsePositionData(data, messageLength);
-    MessageStruct messageStruct = jsonParser_.parseMessage(data, messageLength);
+    std::string eventType = jsonParser_.parseEventType(jsonData);
+    ClientDataStruct clientData = jsonParser_.parseClientData(jsonData);
+    CharacterDataStruct characterData = jsonParser_.parseCharacterData(jsonData);
+    PositionStruct positionData = jsonParser_.parsePositionData(jsonData);
+    MessageStruct messageStruct = jsonParser_.parseMessage(jsonData);
 
     return {eventType, clientData, characterData, positionData, messageStruct};
 }
@@ -21,19 +20,22 @@ MessageHandler::parseMessage(const std::string &message)
 std::tuple<std::string, ClientDataStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
 MessageHandler::parseMessageWithTimestamps(const std::string &message)
 {
-    const char *data = message.data();
-    size_t messageLength = message.size();
+    return parseMessageWithTimestamps(nlohmann::json::parse(message));
+}
 
-    std::string eventType = jsonParser_.parseEventType(data, messageLength);
-    ClientDataStruct clientData = jsonParser_.parseClientData(data, messageLength);
-    CharacterDataStruct characterData = jsonParser_.parseCharacterData(data, messageLength);
-    PositionStruct positionData = jsonParser_.parsePositionData(data, messageLength);
-    MessageStruct messageStruct = jsonParser_.parseMessage(data, messageLength);
+std::tuple<std::string, ClientDataStruct, CharacterDataStruct, PositionStruct, MessageStruct, TimestampStruct>
+MessageHandler::parseMessageWithTimestamps(const nlohmann::json &jsonData)
+{
+    std::string eventType = jsonParser_.parseEventType(jsonData);
+    ClientDataStruct clientData = jsonParser_.parseClientData(jsonData);
+    CharacterDataStruct characterData = jsonParser_.parseCharacterData(jsonData);
+    PositionStruct positionData = jsonParser_.parsePositionData(jsonData);
+    MessageStruct messageStruct = jsonParser_.parseMessage(jsonData);
 
     // Parse timestamps and create receive timestamp with current server time
-    TimestampStruct parsedTimestamps = jsonParser_.parseTimestamps(data, messageLength);
-    std::string requestId = jsonParser_.parseRequestId(data, messageLength);
+    TimestampStruct parsedTimestamps = jsonParser_.parseTimestamps(jsonData);
+    std::string requestId = jsonParser_.parseRequestId(jsonData);
     TimestampStruct serverTimestamps = TimestampUtils::createReceiveTimestamp(parsedTimestamps.clientSendMsEcho, requestId);
 
     return {eventType, clientData, characterData, positionData, messageStruct, serverTimestamps};
-}
\ No newline at end of file
+}
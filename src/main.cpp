@@ -36,9 +36,11 @@ main()
         auto configs = config.parseConfig();
 
         // Initialize EventQueue
-        EventQueue eventQueueChunkServer;
-        EventQueue eventQueueGameServer;
-        EventQueue eventQueueChunkServerPing;
+        // Client packets (many IO-thread producers) and pings use the lock-free ring;
+        // game-server data must never be dropped, so its queue keeps the mutex backend.
+        EventQueue eventQueueChunkServer(10000, EventQueueBackend::RING, EventQueueOverflowPolicy::DROP_OLDEST);
+        EventQueue eventQueueGameServer(10000, EventQueueBackend::MUTEX);
+        EventQueue eventQueueChunkServerPing(1024, EventQueueBackend::RING, EventQueueOverflowPolicy::DROP_OLDEST);
 
         // Initialize Scheduler
         Scheduler scheduler;
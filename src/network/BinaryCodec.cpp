@@ -0,0 +1,401 @@
+#include "network/BinaryCodec.hpp"
+#include <algorithm>
+#include <cstring>
+
+namespace
+{
+// Explicit little-endian writers/readers so the layout does not depend on host byte order.
+class FrameWriter
+{
+  public:
+    FrameWriter(BinaryMessageType type, size_t payloadReserve)
+    {
+        buf_.reserve(BinaryCodec::FRAME_HEADER_SIZE + payloadReserve);
+        putU8(BinaryCodec::FRAME_MAGIC);
+        putU8(static_cast<uint8_t>(type));
+        putU32(0); // payload length, patched in finish()
+    }
+
+    void putU8(uint8_t v)
+    {
+        buf_.push_back(static_cast<char>(v));
+    }
+
+    void putU16(uint16_t v)
+    {
+        putU8(static_cast<uint8_t>(v));
+        putU8(static_cast<uint8_t>(v >> 8));
+    }
+
+    void putU32(uint32_t v)
+    {
+        for (int i = 0; i < 4; ++i)
+            putU8(static_cast<uint8_t>(v >> (8 * i)));
+    }
+
+    void putI32(int32_t v)
+    {
+        putU32(static_cast<uint32_t>(v));
+    }
+
+    void putI64(int64_t v)
+    {
+        const uint64_t u = static_cast<uint64_t>(v);
+        for (int i = 0; i < 8; ++i)
+            putU8(static_cast<uint8_t>(u >> (8 * i)));
+    }
+
+    void putF32(float v)
+    {
+        uint32_t bits;
+        std::memcpy(&bits, &v, sizeof(bits));
+        putU32(bits);
+    }
+
+    void putBytes(const char *data, size_t length)
+    {
+        buf_.append(data, length);
+    }
+
+    size_t size() const
+    {
+        return buf_.size();
+    }
+
+    /// u8 length prefix; strings longer than 255 bytes are truncated (slugs only).
+    void putShortString(const std::string &s)
+    {
+        const size_t len = std::min<size_t>(s.size(), 255);
+        putU8(static_cast<uint8_t>(len));
+        buf_.append(s.data(), len);
+    }
+
+    std::string finish()
+    {
+        const uint32_t payload = static_cast<uint32_t>(buf_.size() - BinaryCodec::FRAME_HEADER_SIZE);
+        for (int i = 0; i < 4; ++i)
+            buf_[2 + i] = static_cast<char>(static_cast<uint8_t>(payload >> (8 * i)));
+        return std::move(buf_);
+    }
+
+  private:
+    std::string buf_;
+};
+
+class PayloadReader
+{
+  public:
+    PayloadReader(const char *data, size_t length) : data_(reinterpret_cast<const uint8_t *>(data)), length_(length) {}
+
+    bool ok() const
+    {
+        return ok_;
+    }
+
+    uint8_t getU8()
+    {
+        if (!require(1))
+            return 0;
+        return data_[pos_++];
+    }
+
+    uint32_t getU32()
+    {
+        if (!require(4))
+            return 0;
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i)
+            v |= static_cast<uint32_t>(data_[pos_++]) << (8 * i);
+        return v;
+    }
+
+    int32_t getI32()
+    {
+        return static_cast<int32_t>(getU32());
+    }
+
+    int64_t getI64()
+    {
+        if (!require(8))
+            return 0;
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i)
+            v |= static_cast<uint64_t>(data_[pos_++]) << (8 * i);
+        return static_cast<int64_t>(v);
+    }
+
+    float getF32()
+    {
+        const uint32_t bits = getU32();
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+  private:
+    bool require(size_t n)
+    {
+        if (!ok_ || pos_ + n > length_)
+        {
+            ok_ = false;
+            return false;
+        }
+        return true;
+    }
+
+    const uint8_t *data_;
+    size_t length_;
+    size_t pos_ = 0;
+    bool ok_ = true;
+};
+
+void
+putPosition(FrameWriter &w, const PositionStruct &p)
+{
+    w.putF32(p.positionX);
+    w.putF32(p.positionY);
+    w.putF32(p.positionZ);
+    w.putF32(p.rotationZ);
+}
+
+int
+jsonInt(const nlohmann::json &obj, const char *key)
+{
+    auto it = obj.find(key);
+    return (it != obj.end() && it->is_number()) ? it->get<int>() : 0;
+}
+
+bool
+jsonBool(const nlohmann::json &obj, const char *key)
+{
+    auto it = obj.find(key);
+    return it != obj.end() && it->is_boolean() && it->get<bool>();
+}
+
+std::string
+jsonString(const nlohmann::json &obj, const char *key)
+{
+    auto it = obj.find(key);
+    return (it != obj.end() && it->is_string()) ? it->get<std::string>() : std::string{};
+}
+} // namespace
+
+BinaryCodec::PeekResult
+BinaryCodec::peekFrame(const char *data, size_t length, size_t maxPayload, BinaryFrameHeader &header)
+{
+    if (length < FRAME_HEADER_SIZE)
+        return PeekResult::INCOMPLETE;
+
+    PayloadReader r(data, FRAME_HEADER_SIZE);
+    if (r.getU8() != FRAME_MAGIC)
+        return PeekResult::INVALID;
+    header.type = static_cast<BinaryMessageType>(r.getU8());
+    header.payloadLength = r.getU32();
+
+    if (header.payloadLength > maxPayload)
+        return PeekResult::INVALID;
+    if (length < FRAME_HEADER_SIZE + header.payloadLength)
+        return PeekResult::INCOMPLETE;
+    return PeekResult::READY;
+}
+
+std::string
+BinaryCodec::encodeMoveCharacter(const MovementDataStruct &movement, long long clientSendMs)
+{
+    FrameWriter w(BinaryMessageType::MOVE_CHARACTER, 29);
+    w.putI32(movement.characterId);
+    putPosition(w, movement.position);
+    w.putU8(movement.isFalling ? 1 : 0);
+    w.putI64(clientSendMs);
+    return w.finish();
+}
+
+bool
+BinaryCodec::decodeMoveCharacter(const char *payload, size_t length, MovementDataStruct &movement, long long &clientSendMs)
+{
+    PayloadReader r(payload, length);
+    movement.characterId = r.getI32();
+    movement.position.positionX = r.getF32();
+    movement.position.positionY = r.getF32();
+    movement.position.positionZ = r.getF32();
+    movement.position.rotationZ = r.getF32();
+    movement.isFalling = (r.getU8() & 0x01) != 0;
+    clientSendMs = r.getI64();
+    return r.ok();
+}
+
+std::string
+BinaryCodec::encodeCharacterMoved(int clientId, const MovementDataStruct &movement, const TimestampStruct &timestamps)
+{
+    FrameWriter w(BinaryMessageType::CHARACTER_MOVED, 49);
+    w.putI32(clientId);
+    w.putI32(movement.characterId);
+    putPosition(w, movement.position);
+    w.putU8(movement.isFalling ? 1 : 0);
+    w.putI64(timestamps.serverRecvMs);
+    w.putI64(timestamps.serverSendMs);
+    w.putI64(timestamps.clientSendMsEcho);
+    return w.finish();
+}
+
+std::string
+BinaryCodec::encodeMobMoveUpdate(const std::vector<MobMoveUpdateStruct> &mobs, long long serverSendMs,
+    std::vector<uint32_t> *recordOffsets)
+{
+    const size_t count = std::min<size_t>(mobs.size(), UINT16_MAX);
+    FrameWriter w(BinaryMessageType::MOB_MOVE_UPDATE, 10 + count * 54);
+    w.putI64(serverSendMs);
+    w.putU16(static_cast<uint16_t>(count));
+    if (recordOffsets)
+    {
+        recordOffsets->clear();
+        recordOffsets->reserve(count + 1);
+    }
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (recordOffsets)
+            recordOffsets->push_back(static_cast<uint32_t>(w.size()));
+        const auto &mob = mobs[i];
+        w.putI32(mob.uid);
+        w.putI32(mob.zoneId);
+        putPosition(w, mob.position);
+        w.putF32(mob.dirX);
+        w.putF32(mob.dirY);
+        w.putF32(mob.speed);
+        w.putU8(static_cast<uint8_t>(mob.combatState));
+        w.putU8(mob.hasWaypoint ? 1 : 0);
+        w.putI64(mob.stepTimestampMs);
+        if (mob.hasWaypoint)
+        {
+            w.putF32(mob.waypointX);
+            w.putF32(mob.waypointY);
+        }
+    }
+    if (recordOffsets)
+        recordOffsets->push_back(static_cast<uint32_t>(w.size()));
+    return w.finish();
+}
+
+std::shared_ptr<const std::string>
+BinaryCodec::assembleMobMoveUpdate(const MobMoveFragmentsStruct &f, const std::vector<uint32_t> &indices,
+    long long serverSendMs)
+{
+    const size_t total = f.binaryOffsets.empty() ? 0 : f.binaryOffsets.size() - 1;
+    // Client sees every mob of the tick (indices are distinct): one copy of the
+    // shared frame with its send time patched in
+    if (total == f.count() && indices.size() == total)
+    {
+        std::string frame = f.binaryFrame;
+        const uint64_t u = static_cast<uint64_t>(serverSendMs);
+        for (int i = 0; i < 8; ++i)
+            frame[FRAME_HEADER_SIZE + i] = static_cast<char>(static_cast<uint8_t>(u >> (8 * i)));
+        return std::make_shared<const std::string>(std::move(frame));
+    }
+
+    // Mobs past the frame's u16 count limit have no record
+    size_t count = 0;
+    size_t payload = 10;
+    for (uint32_t i : indices)
+    {
+        if (i >= total)
+            continue;
+        ++count;
+        payload += f.binaryOffsets[i + 1] - f.binaryOffsets[i];
+    }
+
+    FrameWriter w(BinaryMessageType::MOB_MOVE_UPDATE, payload);
+    w.putI64(serverSendMs);
+    w.putU16(static_cast<uint16_t>(count));
+    for (uint32_t i : indices)
+    {
+        if (i < total)
+            w.putBytes(f.binaryFrame.data() + f.binaryOffsets[i], f.binaryOffsets[i + 1] - f.binaryOffsets[i]);
+    }
+    return std::make_shared<const std::string>(w.finish());
+}
+
+std::shared_ptr<const std::string>
+BinaryCodec::encodeFromJson(const nlohmann::json &packet)
+{
+    auto headerIt = packet.find("header");
+    auto bodyIt = packet.find("body");
+    if (headerIt == packet.end() || bodyIt == packet.end() || !headerIt->is_object() || !bodyIt->is_object())
+        return nullptr;
+
+    const std::string eventType = jsonString(*headerIt, "eventType");
+    const auto &body = *bodyIt;
+
+    if (eventType == "combatResult")
+    {
+        // Payload: i32 casterId, i32 targetId, u8 casterType, u8 targetType,
+        // u8 flags (bit0 crit, bit1 blocked, bit2 missed, bit3 targetDied), i32 damage,
+        // i32 finalTargetHealth, i32 finalTargetMana, i32 finalCasterMana,
+        // i64 serverTimestamp, u8 len + skillSlug.
+        auto resultIt = body.find("skillResult");
+        if (resultIt == body.end() || !resultIt->is_object() || !jsonBool(*resultIt, "success"))
+            return nullptr;
+        const auto &r = *resultIt;
+
+        uint8_t flags = 0;
+        flags |= jsonBool(r, "isCritical") ? 0x01 : 0;
+        flags |= jsonBool(r, "isBlocked") ? 0x02 : 0;
+        flags |= jsonBool(r, "isMissed") ? 0x04 : 0;
+        flags |= jsonBool(r, "targetDied") ? 0x08 : 0;
+
+        const std::string skillSlug = jsonString(r, "skillSlug");
+        FrameWriter w(BinaryMessageType::COMBAT_RESULT, 40 + skillSlug.size());
+        w.putI32(jsonInt(r, "casterId"));
+        w.putI32(jsonInt(r, "targetId"));
+        w.putU8(static_cast<uint8_t>(jsonInt(r, "casterType")));
+        w.putU8(static_cast<uint8_t>(jsonInt(r, "targetType")));
+        w.putU8(flags);
+        w.putI32(jsonInt(r, "damage"));
+        w.putI32(jsonInt(r, "finalTargetHealth"));
+        w.putI32(jsonInt(r, "finalTargetMana"));
+        w.putI32(jsonInt(r, "finalCasterMana"));
+        auto tsIt = r.find("serverTimestamp");
+        w.putI64((tsIt != r.end() && tsIt->is_number()) ? tsIt->get<int64_t>() : 0);
+        w.putShortString(skillSlug);
+        return std::make_shared<const std::string>(w.finish());
+    }
+
+    if (eventType == "effectTick")
+    {
+        // Payload: i32 characterId, f32 value, i32 newHealth, i32 newMana,
+        // u8 flags (bit0 targetDied, bit1 hot), u8 len + effectSlug.
+        const std::string effectSlug = jsonString(body, "effectSlug");
+        uint8_t flags = 0;
+        flags |= jsonBool(body, "targetDied") ? 0x01 : 0;
+        flags |= jsonString(body, "effectTypeSlug") == "hot" ? 0x02 : 0;
+
+        auto valueIt = body.find("value");
+        FrameWriter w(BinaryMessageType::EFFECT_TICK, 18 + effectSlug.size());
+        w.putI32(jsonInt(body, "characterId"));
+        w.putF32((valueIt != body.end() && valueIt->is_number()) ? valueIt->get<float>() : 0.0f);
+        w.putI32(jsonInt(body, "newHealth"));
+        w.putI32(jsonInt(body, "newMana"));
+        w.putU8(flags);
+        w.putShortString(effectSlug);
+        return std::make_shared<const std::string>(w.finish());
+    }
+
+    if (eventType == "stats_update" && jsonString(body, "source") == "regen")
+    {
+        // Regen only touches HP/mana, so the full attribute sheet is not needed.
+        // Payload: i32 characterId, i32 hp, i32 maxHp, i32 mana, i32 maxMana.
+        auto hpIt = body.find("health");
+        auto mpIt = body.find("mana");
+        if (hpIt == body.end() || mpIt == body.end() || !hpIt->is_object() || !mpIt->is_object())
+            return nullptr;
+
+        FrameWriter w(BinaryMessageType::VITALS_UPDATE, 20);
+        w.putI32(jsonInt(body, "characterId"));
+        w.putI32(jsonInt(*hpIt, "current"));
+        w.putI32(jsonInt(*hpIt, "max"));
+        w.putI32(jsonInt(*mpIt, "current"));
+        w.putI32(jsonInt(*mpIt, "max"));
+        return std::make_shared<const std::string>(w.finish());
+    }
+
+    return nullptr;
+}
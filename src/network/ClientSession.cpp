@@ -2,6 +2,7 @@
 #include "chunk_server/ChunkServer.hpp"
 #include "events/EventDispatcher.hpp"
 #include "handlers/MessageHandler.hpp"
+#include "network/BinaryCodec.hpp"
 #include "utils/TimestampUtils.hpp"
 #include <spdlog/logger.h>
 
@@ -56,13 +57,37 @@ ClientSession::doRead()
                 size_t processed_messages = 0;
                 constexpr size_t MAX_MESSAGES_PER_READ = 10; // Limit messages per read cycle
 
+                constexpr size_t MAX_MESSAGE_SIZE = 8 * 1024; // 8KB per message
+
                 // Process all complete messages found.
-                while ((pos = accumulatedData_.find(delimiter)) != std::string::npos && processed_messages < MAX_MESSAGES_PER_READ)
+                while (processed_messages < MAX_MESSAGES_PER_READ && !accumulatedData_.empty())
                 {
+                    // Length-prefixed binary frame (only after the client negotiated it at joinGameClient)
+                    if (binaryWire_ && static_cast<uint8_t>(accumulatedData_[0]) == BinaryCodec::FRAME_MAGIC)
+                    {
+                        BinaryFrameHeader header;
+                        auto peek = BinaryCodec::peekFrame(accumulatedData_.data(), accumulatedData_.size(), MAX_MESSAGE_SIZE, header);
+                        if (peek == BinaryCodec::PeekResult::INCOMPLETE)
+                            break;
+                        if (peek == BinaryCodec::PeekResult::INVALID)
+                        {
+                            log_->error("Invalid binary frame, disconnecting client");
+                            handleClientDisconnect();
+                            return;
+                        }
+
+                        processBinaryFrame(header, accumulatedData_.data() + BinaryCodec::FRAME_HEADER_SIZE);
+                        accumulatedData_.erase(0, BinaryCodec::FRAME_HEADER_SIZE + header.payloadLength);
+                        processed_messages++;
+                        continue;
+                    }
+
+                    if ((pos = accumulatedData_.find(delimiter)) == std::string::npos)
+                        break;
+
                     std::string message = accumulatedData_.substr(0, pos);
 
                     // Check message size limit
-                    constexpr size_t MAX_MESSAGE_SIZE = 8 * 1024; // 8KB per message
                     if (message.size() > MAX_MESSAGE_SIZE)
                     {
                         gameServices_.getLogger().logError("Message too large, skipping: " + std::to_string(message.size()) + " bytes", RED);
@@ -77,10 +102,14 @@ ClientSession::doRead()
                     processed_messages++;
                 }
 
-                // If accumulated buffer is getting large without complete messages, clear it
-                if (accumulatedData_.size() > MAX_BUFFER_SIZE / 2 && accumulatedData_.find(delimiter) == std::string::npos)
+                // Per-frame size guard. A binary frame at the head is bounded by peekFrame
+                // (payload <= MAX_MESSAGE_SIZE) and must be kept until it completes, so only
+                // an unterminated JSON line can outgrow its limit; drop that line alone.
+                const bool binaryHead = binaryWire_ && !accumulatedData_.empty() &&
+                                        static_cast<uint8_t>(accumulatedData_[0]) == BinaryCodec::FRAME_MAGIC;
+                if (!binaryHead && accumulatedData_.size() > MAX_MESSAGE_SIZE && accumulatedData_.find(delimiter) == std::string::npos)
                 {
-                    log_->error("Clearing large incomplete buffer to prevent memory leak");
+                    log_->error("Dropping unterminated message over " + std::to_string(MAX_MESSAGE_SIZE) + " bytes");
                     accumulatedData_.clear();
                 }
 
@@ -174,7 +203,7 @@ ClientSession::processMessage(const std::string &message)
                 PositionStruct emptyPositionData{};
                 MessageStruct emptyMessageData{};
 
-                EventContext pingContext{eventType, clientData, emptyCharacterData, emptyPositionData, emptyMessageData, message, serverTimestamps};
+                EventContext pingContext{eventType, clientData, emptyCharacterData, emptyPositionData, emptyMessageData, message, serverTimestamps, std::make_shared<nlohmann::json>(std::move(jsonData))};
                 eventDispatcher_.dispatch(pingContext, socket_);
             }
             else
@@ -189,8 +218,14 @@ ClientSession::processMessage(const std::string &message)
             return;
         }
 
-        // For non-ping events, do full parsing using MessageHandler with timestamps
-        auto [fullEventType, clientData, characterData, positionData, messageStruct, timestamps] = messageHandler_.parseMessageWithTimestamps(message);
+        // For non-ping events, decode the envelope fields from the already-parsed document
+        auto [fullEventType, clientData, characterData, positionData, messageStruct, timestamps] = messageHandler_.parseMessageWithTimestamps(jsonData);
+
+        // Accept binary frames on this connection once the client has asked for them
+        if (fullEventType == "joinGameClient" && clientData.binaryWire)
+        {
+            binaryWire_ = true;
+        }
 
         // If client ID is not provided in the message (or is 0), try to look it up by socket
         if (clientData.clientId == 0 && socket_)
@@ -264,8 +299,9 @@ ClientSession::processMessage(const std::string &message)
             }
         }
 
-        // Create full context for non-ping events with timestamps
-        EventContext context{fullEventType, clientData, characterData, positionData, messageStruct, message, timestamps};
+        // Create full context for non-ping events with timestamps; the parsed document
+        // travels with it so dispatcher handlers never parse the message again
+        EventContext context{fullEventType, clientData, characterData, positionData, messageStruct, message, timestamps, std::make_shared<nlohmann::json>(std::move(jsonData))};
         eventDispatcher_.dispatch(context, socket_);
     }
     catch (const nlohmann::json::parse_error &e)
@@ -274,6 +310,36 @@ ClientSession::processMessage(const std::string &message)
     }
 }
 
+void
+ClientSession::processBinaryFrame(const BinaryFrameHeader &header, const char *payload)
+{
+    if (header.type != BinaryMessageType::MOVE_CHARACTER)
+    {
+        log_->error("Unsupported inbound binary frame type: " + std::to_string(static_cast<int>(header.type)));
+        return;
+    }
+
+    MovementDataStruct movementData;
+    long long clientSendMs = 0;
+    if (!BinaryCodec::decodeMoveCharacter(payload, header.payloadLength, movementData, clientSendMs))
+    {
+        gameServices_.getLogger().logError("Malformed binary moveCharacter frame", RED);
+        return;
+    }
+
+    // Identity comes from the authenticated socket, never from the frame
+    int clientId = gameServices_.getClientManager().getClientIdBySocket(socket_);
+    if (clientId == 0)
+    {
+        return;
+    }
+    movementData.clientId = clientId;
+    movementData.characterId = gameServices_.getClientManager().getClientData(clientId).characterId;
+    movementData.timestamps = TimestampUtils::createReceiveTimestamp(clientSendMs);
+
+    eventDispatcher_.dispatchMovement(std::move(movementData), socket_);
+}
+
 void
 ClientSession::handleClientDisconnect()
 {
@@ -104,6 +104,11 @@ GameServerWorker::sendDataToGameServer(const std::string &data)
 {
     // CRITICAL-2: post onto strand so sendQueue_ and writePending_ are only
     // accessed from one logical thread, eliminating concurrent async_write.
+    pendingSends_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(drainMutex_);
+        ++unfinishedSends_;
+    }
     boost::asio::post(strand_, [this, data]()
         {
         sendQueue_.push(data);
@@ -122,6 +127,7 @@ GameServerWorker::doNextWrite()
     writePending_ = true;
     auto payload = std::make_shared<std::string>(std::move(sendQueue_.front()));
     sendQueue_.pop();
+    pendingSends_.fetch_sub(1, std::memory_order_relaxed);
     boost::asio::async_write(
         *game_server_socket_,
         boost::asio::buffer(*payload),
@@ -133,9 +139,26 @@ GameServerWorker::doNextWrite()
             } else {
                 log_->error("Error in sending data to Game Server: " + error.message());
             }
+            finishSend();
             doNextWrite(); }));
 }
 
+void
+GameServerWorker::finishSend()
+{
+    std::lock_guard<std::mutex> lock(drainMutex_);
+    if (unfinishedSends_ > 0 && --unfinishedSends_ == 0)
+        drainCv_.notify_all();
+}
+
+bool
+GameServerWorker::waitForSendsDrained(std::chrono::milliseconds timeout)
+{
+    std::unique_lock<std::mutex> lock(drainMutex_);
+    return drainCv_.wait_for(lock, timeout, [this]
+        { return unfinishedSends_ == 0; });
+}
+
 void
 GameServerWorker::processGameServerData(std::string_view data)
 {
@@ -414,6 +437,7 @@ GameServerWorker::receiveDataFromGameServer()
                 game_server_socket_ = std::make_shared<boost::asio::ip::tcp::socket>(io_context_game_server_);
                 boost::asio::post(strand_, [this]()
                     {
+                    pendingSends_.fetch_sub(sendQueue_.size(), std::memory_order_relaxed);
                     while (!sendQueue_.empty()) sendQueue_.pop();
                     writePending_ = false; });
                 connect(endpoints_, 0);
@@ -0,0 +1,462 @@
+#include "network/JsonWriter.hpp"
+#include "network/BinaryCodec.hpp"
+#include "utils/TimestampUtils.hpp"
+#include <charconv>
+#include <cmath>
+#include <stdexcept>
+
+namespace
+{
+constexpr char HEX_DIGITS[] = "0123456789abcdef";
+
+// Typical sizes; the buffer grows if a packet is larger.
+constexpr size_t ENVELOPE_RESERVE = 192;
+constexpr size_t MOB_ENTRY_RESERVE = 224;
+
+bool
+isEnvelopeKey(const std::string &key)
+{
+    return key == "status" || key == "timestamp" || key == "version";
+}
+
+bool
+isTimestampKey(const std::string &key)
+{
+    return key == "serverRecvMs" || key == "serverSendMs" || key == "clientSendMsEcho" || key == "requestIdEcho";
+}
+
+void
+writeEnvelopeTail(JsonWriter &w, std::string_view status)
+{
+    char timestamp[TimestampUtils::TIMESTAMP_BUFFER_SIZE];
+    const size_t length = TimestampUtils::formatCurrentTimestamp(timestamp, sizeof(timestamp));
+    w.field("status", status)
+        .field("timestamp", std::string_view(timestamp, length))
+        .field("version", "1.0");
+}
+
+void
+writeTimestamps(JsonWriter &w, const TimestampStruct &timestamps)
+{
+    w.field("serverRecvMs", timestamps.serverRecvMs)
+        .field("serverSendMs", timestamps.serverSendMs)
+        .field("clientSendMsEcho", timestamps.clientSendMsEcho);
+    if (!timestamps.requestId.empty())
+        w.field("requestIdEcho", timestamps.requestId);
+}
+
+void
+writePosition(JsonWriter &w, const PositionStruct &position)
+{
+    w.beginObject()
+        .field("x", position.positionX)
+        .field("y", position.positionY)
+        .field("z", position.positionZ)
+        .field("rotationZ", position.rotationZ)
+        .endObject();
+}
+} // namespace
+
+// ---------------------------------------------------------------------------
+// JsonWriter
+// ---------------------------------------------------------------------------
+
+void
+JsonWriter::separate()
+{
+    if (afterKey_)
+    {
+        afterKey_ = false;
+        return;
+    }
+    if (depth_ > 0)
+    {
+        if (hasItems_[depth_ - 1])
+            out_ += ',';
+        hasItems_[depth_ - 1] = true;
+    }
+}
+
+void
+JsonWriter::enterLevel(bool hasItems)
+{
+    // hasItems_ is indexed by depth_ - 1 in separate(); refuse to nest past it
+    if (depth_ >= MAX_DEPTH)
+        throw std::length_error("JsonWriter: nesting deeper than " + std::to_string(MAX_DEPTH));
+    hasItems_[depth_] = hasItems;
+    ++depth_;
+}
+
+void
+JsonWriter::push(char open)
+{
+    separate();
+    out_ += open;
+    enterLevel(false);
+}
+
+void
+JsonWriter::pop(char close)
+{
+    out_ += close;
+    if (depth_ > 0)
+        --depth_;
+}
+
+JsonWriter &
+JsonWriter::beginObject()
+{
+    push('{');
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::endObject()
+{
+    pop('}');
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::beginArray()
+{
+    push('[');
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::endArray()
+{
+    pop(']');
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::key(std::string_view name)
+{
+    separate();
+    writeString(name);
+    out_ += ':';
+    afterKey_ = true;
+    return *this;
+}
+
+void
+JsonWriter::writeString(std::string_view s)
+{
+    out_ += '"';
+    size_t runStart = 0;
+    for (size_t i = 0; i < s.size(); ++i)
+    {
+        const auto c = static_cast<unsigned char>(s[i]);
+        if (c >= 0x20 && c != '"' && c != '\\')
+            continue;
+
+        out_.append(s.data() + runStart, i - runStart);
+        runStart = i + 1;
+        switch (c)
+        {
+        case '"':
+            out_ += "\\\"";
+            break;
+        case '\\':
+            out_ += "\\\\";
+            break;
+        case '\n':
+            out_ += "\\n";
+            break;
+        case '\r':
+            out_ += "\\r";
+            break;
+        case '\t':
+            out_ += "\\t";
+            break;
+        case '\b':
+            out_ += "\\b";
+            break;
+        case '\f':
+            out_ += "\\f";
+            break;
+        default:
+            out_ += "\\u00";
+            out_ += HEX_DIGITS[c >> 4];
+            out_ += HEX_DIGITS[c & 0x0F];
+            break;
+        }
+    }
+    out_.append(s.data() + runStart, s.size() - runStart);
+    out_ += '"';
+}
+
+JsonWriter &
+JsonWriter::value(std::string_view v)
+{
+    separate();
+    writeString(v);
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::value(bool v)
+{
+    separate();
+    out_ += v ? "true" : "false";
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::value(std::nullptr_t)
+{
+    separate();
+    out_ += "null";
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::value(double v)
+{
+    separate();
+    if (!std::isfinite(v))
+    {
+        out_ += "null";
+        return *this;
+    }
+    char buf[32];
+    auto result = std::to_chars(buf, buf + sizeof(buf), v);
+    out_.append(buf, result.ptr);
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::value(float v)
+{
+    separate();
+    if (!std::isfinite(v))
+    {
+        out_ += "null";
+        return *this;
+    }
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), v);
+    out_.append(buf, result.ptr);
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::writeSigned(long long v)
+{
+    separate();
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), v);
+    out_.append(buf, result.ptr);
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::writeUnsigned(unsigned long long v)
+{
+    separate();
+    char buf[24];
+    auto result = std::to_chars(buf, buf + sizeof(buf), v);
+    out_.append(buf, result.ptr);
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::value(const nlohmann::json &v)
+{
+    separate();
+    out_ += v.dump();
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::raw(std::string_view json)
+{
+    separate();
+    out_.append(json.data(), json.size());
+    return *this;
+}
+
+JsonWriter &
+JsonWriter::beginRawObject(std::string_view objectJson)
+{
+    // objectJson is "{...}": drop the closing brace and continue the object
+    const std::string_view open = objectJson.substr(0, objectJson.size() - 1);
+    separate();
+    out_.append(open.data(), open.size());
+    enterLevel(open.size() > 1);
+    return *this;
+}
+
+// ---------------------------------------------------------------------------
+// JsonPackets
+// ---------------------------------------------------------------------------
+
+std::string
+JsonPackets::encodeResponse(const std::string &status, const nlohmann::json &message, const TimestampStruct *timestamps)
+{
+    std::string out;
+    out.reserve(ENVELOPE_RESERVE);
+    JsonWriter w(out);
+
+    w.beginObject().key("header").beginObject();
+    auto header = message.find("header");
+    if (header != message.end() && header->is_object())
+    {
+        for (auto it = header->begin(); it != header->end(); ++it)
+        {
+            if (isEnvelopeKey(it.key()) || (timestamps && isTimestampKey(it.key())))
+                continue;
+            w.key(it.key()).value(it.value());
+        }
+    }
+    writeEnvelopeTail(w, status);
+    if (timestamps)
+    {
+        TimestampStruct sendTimestamps = *timestamps;
+        TimestampUtils::setServerSendTimestamp(sendTimestamps);
+        writeTimestamps(w, sendTimestamps);
+    }
+    w.endObject();
+
+    w.key("body");
+    auto body = message.find("body");
+    if (body != message.end())
+        w.value(*body);
+    else
+        w.beginObject().endObject();
+    w.endObject();
+
+    out += '\n';
+    return out;
+}
+
+std::shared_ptr<const MobMoveFragmentsStruct>
+JsonPackets::encodeMobMoveFragments(const std::vector<MobMoveUpdateStruct> &mobs, bool withBinaryFrame)
+{
+    auto fragments = std::make_shared<MobMoveFragmentsStruct>();
+    fragments->json.reserve(mobs.size() * MOB_ENTRY_RESERVE);
+    fragments->jsonOffsets.reserve(mobs.size() + 1);
+    fragments->uids.reserve(mobs.size());
+
+    for (const auto &mob : mobs)
+    {
+        fragments->jsonOffsets.push_back(static_cast<uint32_t>(fragments->json.size()));
+        fragments->uids.push_back(mob.uid);
+        // Each fragment is a standalone object; the array commas are added on assembly
+        JsonWriter w(fragments->json);
+        w.beginObject()
+            .field("uid", mob.uid)
+            .field("zoneId", mob.zoneId);
+        w.key("position");
+        writePosition(w, mob.position);
+        w.key("velocity").beginObject()
+            .field("dirX", mob.dirX)
+            .field("dirY", mob.dirY)
+            .field("speed", mob.speed)
+            .endObject();
+        w.field("combatState", mob.combatState)
+            .field("stepTimestampMs", mob.stepTimestampMs);
+        if (mob.hasWaypoint)
+        {
+            w.key("waypoint").beginObject()
+                .field("x", mob.waypointX)
+                .field("y", mob.waypointY)
+                .endObject();
+        }
+        w.endObject();
+    }
+    fragments->jsonOffsets.push_back(static_cast<uint32_t>(fragments->json.size()));
+
+    // serverSendMs in the frame header is rewritten on assembly
+    if (withBinaryFrame)
+        fragments->binaryFrame = BinaryCodec::encodeMobMoveUpdate(mobs, 0, &fragments->binaryOffsets);
+    return fragments;
+}
+
+std::string
+JsonPackets::assembleMobMoveUpdate(int clientId, const MobMoveFragmentsStruct &fragments, const std::vector<uint32_t> &indices)
+{
+    size_t payload = 0;
+    for (uint32_t i : indices)
+        payload += fragments.jsonOffsets[i + 1] - fragments.jsonOffsets[i] + 1;
+
+    std::string out;
+    out.reserve(ENVELOPE_RESERVE + payload);
+    JsonWriter w(out);
+
+    w.beginObject().key("header").beginObject()
+        .field("message", "Mob movement update")
+        .field("hash", "")
+        .field("clientId", clientId)
+        .field("eventType", "mobMoveUpdate")
+        .field("serverSendMs", TimestampUtils::getCurrentTimestampMs());
+    writeEnvelopeTail(w, "success");
+    w.endObject();
+
+    w.key("body").beginObject().key("mobs").beginArray();
+    for (uint32_t i : indices)
+    {
+        w.raw(std::string_view(fragments.json.data() + fragments.jsonOffsets[i],
+            fragments.jsonOffsets[i + 1] - fragments.jsonOffsets[i]));
+    }
+    w.endArray().endObject().endObject();
+
+    out += '\n';
+    return out;
+}
+
+std::string
+JsonPackets::encodeEnvelope(int clientId, std::string_view eventType, std::string_view message,
+    const char *hash, const std::function<void(JsonWriter &)> &writeBody, size_t reserve)
+{
+    std::string out;
+    out.reserve(ENVELOPE_RESERVE + reserve);
+    JsonWriter w(out);
+
+    w.beginObject().key("header").beginObject()
+        .field("message", message);
+    if (hash)
+        w.field("hash", hash);
+    w.field("clientId", clientId)
+        .field("eventType", eventType);
+    writeEnvelopeTail(w, "success");
+    w.endObject();
+
+    w.key("body");
+    writeBody(w);
+    w.endObject();
+
+    out += '\n';
+    return out;
+}
+
+std::string
+JsonPackets::encodeCharacterMoved(int clientId, const MovementDataStruct &movement, const TimestampStruct &timestamps)
+{
+    std::string out;
+    out.reserve(ENVELOPE_RESERVE + 160);
+    JsonWriter w(out);
+
+    w.beginObject().key("header").beginObject()
+        .field("message", "Movement success for character!")
+        .field("hash", "")
+        .field("clientId", clientId)
+        .field("eventType", "moveCharacter");
+    writeEnvelopeTail(w, "success");
+    writeTimestamps(w, timestamps);
+    w.endObject();
+
+    w.key("body").beginObject().key("character").beginObject()
+        .field("id", movement.characterId);
+    w.key("position");
+    writePosition(w, movement.position);
+    w.field("isFalling", movement.isFalling)
+        .endObject()
+        .endObject()
+        .endObject();
+
+    out += '\n';
+    return out;
+}
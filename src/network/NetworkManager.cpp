@@ -1,7 +1,10 @@
 #include "network/NetworkManager.hpp"
 #include "events/EventDispatcher.hpp"
 #include "handlers/MessageHandler.hpp"
+#include "network/JsonWriter.hpp"
 #include "utils/TimestampUtils.hpp"
+#include <algorithm>
+#include <iterator>
 #include <netinet/tcp.h>
 #include <spdlog/logger.h>
 
@@ -19,6 +22,9 @@ NetworkManager::NetworkManager(
       gameServices_(gameServices)
 {
     log_ = gameServices_.getLogger().getSystem("network");
+    applyEgressConfig(gameServices_.getGameConfigService());
+    gameServices_.getGameConfigService().subscribe([this](const GameConfigService &config)
+        { applyEgressConfig(config); });
     boost::system::error_code ec;
 
     short customPort = std::get<1>(configs).port;
@@ -167,6 +173,56 @@ NetworkManager::sendResponseBulk(std::shared_ptr<boost::asio::ip::tcp::socket> c
     enqueueWrite(std::move(clientSocket), std::move(data), false /* bulk */);
 }
 
+void
+NetworkManager::sendResponseBulk(std::shared_ptr<boost::asio::ip::tcp::socket> clientSocket,
+    std::shared_ptr<const std::string> data,
+    std::vector<int> entityIds)
+{
+    if (!clientSocket || !data)
+        return;
+
+    enqueueWrite(std::move(clientSocket), std::move(data), false /* bulk */, std::move(entityIds));
+}
+
+void
+NetworkManager::applyEgressConfig(const GameConfigService &config)
+{
+    clientBudgetBytesPerSec_.store(static_cast<size_t>(std::max(0, config.getInt("network.clientBudgetBytesPerSec", 256 * 1024))),
+        std::memory_order_relaxed);
+    bulkStaleMs_.store(std::max(0, config.getInt("network.bulkStaleMs", 250)), std::memory_order_relaxed);
+    bulkMaxQueuedSec_.store(std::max(1, config.getInt("network.bulkMaxQueuedSec", 2)), std::memory_order_relaxed);
+}
+
+void
+NetworkManager::setBinaryWire(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket, bool enabled)
+{
+    if (!clientSocket)
+        return;
+    if (getOrCreateWriteQueue(clientSocket.get())->binaryWire.exchange(enabled) != enabled)
+    {
+        if (enabled)
+            binaryWireSockets_.fetch_add(1, std::memory_order_relaxed);
+        else
+            binaryWireSockets_.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+bool
+NetworkManager::hasBinaryWireClients() const
+{
+    return binaryWireSockets_.load(std::memory_order_relaxed) > 0;
+}
+
+bool
+NetworkManager::isBinaryWire(const std::shared_ptr<boost::asio::ip::tcp::socket> &clientSocket)
+{
+    if (!clientSocket)
+        return false;
+    std::lock_guard<std::mutex> lock(writeQueuesMutex_);
+    auto it = writeQueues_.find(clientSocket.get());
+    return it != writeQueues_.end() && it->second->binaryWire.load(std::memory_order_relaxed);
+}
+
 std::shared_ptr<NetworkManager::SocketWriteQueue>
 NetworkManager::getOrCreateWriteQueue(boost::asio::ip::tcp::socket *key)
 {
@@ -183,119 +239,303 @@ void
 NetworkManager::removeWriteQueue(boost::asio::ip::tcp::socket *key)
 {
     std::lock_guard<std::mutex> lock(writeQueuesMutex_);
-    writeQueues_.erase(key);
+    auto it = writeQueues_.find(key);
+    if (it == writeQueues_.end())
+        return;
+    if (it->second->binaryWire.exchange(false))
+        binaryWireSockets_.fetch_sub(1, std::memory_order_relaxed);
+    writeQueues_.erase(it);
 }
 
 void
 NetworkManager::enqueueWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
     std::shared_ptr<const std::string> data,
-    bool critical)
+    bool critical,
+    std::vector<int> entityIds)
 {
     auto queue = getOrCreateWriteQueue(socket.get());
     boost::asio::post(queue->strand,
-        [this, socket = std::move(socket), queue, data = std::move(data), critical]() mutable
+        [this, socket = std::move(socket), queue, data = std::move(data), critical, entityIds = std::move(entityIds)]() mutable
         {
             if (critical)
+            {
                 queue->criticalQ.push_back(std::move(data));
+            }
             else
-                queue->bulkQ.push_back(std::move(data));
+            {
+                const auto now = std::chrono::steady_clock::now();
+                const size_t budget = refillBudget(*queue);
+
+                // The lane is behind: this update makes older ones for the same mobs obsolete
+                if (!entityIds.empty() && !queue->bulkQ.empty() &&
+                    (queue->pacing || now - queue->bulkQ.front().enqueuedAt > std::chrono::milliseconds(bulkStaleMs_.load(std::memory_order_relaxed))))
+                {
+                    supersedeBulk(*queue, entityIds);
+                }
+
+                // Hard cap on the backlog of a client that stays over budget
+                const size_t maxQueued = budget * static_cast<size_t>(bulkMaxQueuedSec_.load(std::memory_order_relaxed));
+                if (budget > 0 && queue->bulkBytes + data->size() > maxQueued)
+                    dropCoveredBulk(*queue, entityIds, data->size(), maxQueued);
+
+                queue->bulkBytes += data->size();
+                queue->bulkQ.push_back({std::move(data), now, std::move(entityIds)});
+            }
             if (!queue->writing)
                 doNextWrite(std::move(socket), std::move(queue));
         });
 }
 
+void
+NetworkManager::supersedeBulk(SocketWriteQueue &queue, const std::vector<int> &entityIds)
+{
+    auto &bulkQ = queue.bulkQ;
+    auto kept = std::remove_if(bulkQ.begin(), bulkQ.end(), [&](const BulkPacket &packet)
+        {
+            if (packet.entityIds.empty() ||
+                !std::includes(entityIds.begin(), entityIds.end(), packet.entityIds.begin(), packet.entityIds.end()))
+                return false;
+            supersededBytes_.fetch_add(packet.data->size(), std::memory_order_relaxed);
+            queue.bulkBytes -= packet.data->size();
+            return true;
+        });
+    bulkQ.erase(kept, bulkQ.end());
+}
+
+void
+NetworkManager::dropCoveredBulk(SocketWriteQueue &queue, const std::vector<int> &incomingIds, size_t incomingBytes,
+    size_t maxQueued)
+{
+    // Walk newest to oldest collecting the entities that a later packet (or the
+    // incoming one) updates; a packet whose entities are all in that set carries
+    // no last-known state and may go. Anything else is kept even past the cap, so
+    // a mob that stops moving never leaves a lagging client with a stale position.
+    auto &bulkQ = queue.bulkQ;
+    std::vector<int> covered = incomingIds;
+    std::vector<int> merged;
+    std::vector<char> droppable(bulkQ.size(), 0);
+    for (size_t i = bulkQ.size(); i-- > 0;)
+    {
+        const auto &ids = bulkQ[i].entityIds;
+        if (ids.empty())
+            continue;
+        if (std::includes(covered.begin(), covered.end(), ids.begin(), ids.end()))
+        {
+            droppable[i] = 1;
+            continue;
+        }
+        merged.clear();
+        std::set_union(covered.begin(), covered.end(), ids.begin(), ids.end(), std::back_inserter(merged));
+        covered.swap(merged);
+    }
+
+    // Oldest first, only until the backlog fits
+    size_t out = 0;
+    for (size_t i = 0; i < bulkQ.size(); ++i)
+    {
+        if (droppable[i] && queue.bulkBytes + incomingBytes > maxQueued)
+        {
+            const size_t size = bulkQ[i].data->size();
+            droppedBytes_.fetch_add(size, std::memory_order_relaxed);
+            queue.bulkBytes -= size;
+            continue;
+        }
+        if (out != i)
+            bulkQ[out] = std::move(bulkQ[i]);
+        ++out;
+    }
+    bulkQ.erase(bulkQ.begin() + static_cast<std::ptrdiff_t>(out), bulkQ.end());
+}
+
+size_t
+NetworkManager::refillBudget(SocketWriteQueue &queue)
+{
+    const size_t budget = clientBudgetBytesPerSec_.load(std::memory_order_relaxed);
+    const auto now = std::chrono::steady_clock::now();
+    const double elapsedSec = std::chrono::duration<double>(now - queue.budgetRefilledAt).count();
+    queue.budgetRefilledAt = now;
+    if (budget == 0)
+        return 0;
+    // Burst of at most one second of budget
+    queue.budgetTokens = std::min(static_cast<double>(budget), queue.budgetTokens + elapsedSec * static_cast<double>(budget));
+    return budget;
+}
+
+void
+NetworkManager::schedulePacedWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+    std::shared_ptr<SocketWriteQueue> queue)
+{
+    if (queue->pacing)
+        return;
+    const size_t budget = clientBudgetBytesPerSec_.load(std::memory_order_relaxed);
+    // Wait until the bucket is back above zero (at least 1ms)
+    const double waitSec = budget > 0 ? -queue->budgetTokens / static_cast<double>(budget) : 0.0;
+    const auto wait = std::max(std::chrono::milliseconds(1),
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::duration<double>(waitSec)) + std::chrono::milliseconds(1));
+
+    queue->pacing = true;
+    pacedWaits_.fetch_add(1, std::memory_order_relaxed);
+    queue->paceTimer.expires_after(wait);
+    queue->paceTimer.async_wait(boost::asio::bind_executor(queue->strand,
+        [this, socket = std::move(socket), queue](const boost::system::error_code &) mutable
+        {
+            queue->pacing = false;
+            if (!queue->writing)
+                doNextWrite(std::move(socket), std::move(queue));
+        }));
+}
+
 void
 NetworkManager::doNextWrite(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
     std::shared_ptr<SocketWriteQueue> queue)
 {
     // Must be called on queue->strand.
-    std::shared_ptr<const std::string> data;
-    if (!queue->criticalQ.empty())
+    queue->inFlight.clear();
+    queue->gather.clear();
+
+    if (!socket || !socket->is_open())
+    {
+        queue->writing = false;
+        queue->criticalQ.clear();
+        queue->bulkQ.clear();
+        queue->bulkBytes = 0;
+        return;
+    }
+
+    // Critical packets first, then bulk while the egress budget lasts; stop at
+    // the buffer or byte cap (a single oversized packet still goes out on its own).
+    const bool budgeted = refillBudget(*queue) > 0;
+    size_t bytes = 0;
+    auto room = [&](size_t size)
+    {
+        return queue->inFlight.size() < MAX_GATHER_BUFFERS &&
+               (queue->inFlight.empty() || bytes + size <= MAX_GATHER_BYTES);
+    };
+    auto add = [&](std::shared_ptr<const std::string> data)
+    {
+        bytes += data->size();
+        queue->gather.emplace_back(data->data(), data->size());
+        queue->inFlight.push_back(std::move(data));
+    };
+
+    while (!queue->criticalQ.empty() && room(queue->criticalQ.front()->size()))
     {
-        data = std::move(queue->criticalQ.front());
+        add(std::move(queue->criticalQ.front()));
         queue->criticalQ.pop_front();
     }
-    else if (!queue->bulkQ.empty())
+    const bool criticalDrained = queue->criticalQ.empty();
+    if (budgeted)
+        queue->budgetTokens -= static_cast<double>(bytes);
+    while (criticalDrained && !queue->bulkQ.empty() && room(queue->bulkQ.front().data->size()) &&
+           (!budgeted || queue->budgetTokens > 0.0))
     {
-        data = std::move(queue->bulkQ.front());
+        const size_t size = queue->bulkQ.front().data->size();
+        if (budgeted)
+            queue->budgetTokens -= static_cast<double>(size);
+        queue->bulkBytes -= size;
+        add(std::move(queue->bulkQ.front().data));
         queue->bulkQ.pop_front();
     }
-    else
+
+    if (queue->inFlight.empty())
     {
         queue->writing = false;
+        // Only bulk is left and the client is over budget
+        if (!queue->bulkQ.empty())
+            schedulePacedWrite(std::move(socket), std::move(queue));
         return;
     }
 
-    if (!socket || !socket->is_open())
+    const uint64_t packets = queue->inFlight.size();
+    writeFlushes_.fetch_add(1, std::memory_order_relaxed);
+    writePackets_.fetch_add(packets, std::memory_order_relaxed);
+    writeBytes_.fetch_add(bytes, std::memory_order_relaxed);
+    uint64_t maxPackets = writeMaxPacketsPerFlush_.load(std::memory_order_relaxed);
+    while (packets > maxPackets && !writeMaxPacketsPerFlush_.compare_exchange_weak(maxPackets, packets, std::memory_order_relaxed))
     {
-        queue->writing = false;
-        queue->criticalQ.clear();
-        queue->bulkQ.clear();
-        return;
     }
 
     queue->writing = true;
-    boost::asio::async_write(*socket,
-        boost::asio::buffer(*data),
+    writeGather(std::move(socket), std::move(queue));
+}
+
+void
+NetworkManager::writeGather(std::shared_ptr<boost::asio::ip::tcp::socket> socket,
+    std::shared_ptr<SocketWriteQueue> queue)
+{
+    // queue->gather and the strings it points into (queue->inFlight) stay
+    // untouched until the handler runs on the strand.
+    socket->async_write_some(queue->gather,
         boost::asio::bind_executor(queue->strand,
-            [this, socket, queue, data](const boost::system::error_code &error, size_t bytes_transferred) mutable
+            [this, socket, queue](const boost::system::error_code &error, size_t bytes_transferred) mutable
             {
+                writeSyscalls_.fetch_add(1, std::memory_order_relaxed);
                 if (error)
                 {
                     log_->error("Priority write error: " + error.message());
                     queue->writing = false;
+                    queue->inFlight.clear();
+                    queue->gather.clear();
                     queue->criticalQ.clear();
                     queue->bulkQ.clear();
+                    queue->bulkBytes = 0;
                     if (socket->is_open())
                     {
                         boost::system::error_code ec;
                         socket->close(ec);
                     }
+                    return;
                 }
-                else
+
+                // Drop fully written buffers; advance into a partially written one
+                auto &gather = queue->gather;
+                size_t written = 0;
+                while (written < gather.size() && bytes_transferred >= gather[written].size())
                 {
-                    log_->debug("Bytes sent: " + std::to_string(bytes_transferred));
-                    doNextWrite(std::move(socket), std::move(queue));
+                    bytes_transferred -= gather[written].size();
+                    ++written;
                 }
+                gather.erase(gather.begin(), gather.begin() + static_cast<std::ptrdiff_t>(written));
+                if (!gather.empty())
+                {
+                    gather.front() += bytes_transferred;
+                    writeGather(std::move(socket), std::move(queue));
+                    return;
+                }
+
+                doNextWrite(std::move(socket), std::move(queue));
             }));
 }
 
+NetworkWriteStats
+NetworkManager::collectWriteStats()
+{
+    NetworkWriteStats stats;
+    stats.flushes = writeFlushes_.exchange(0, std::memory_order_relaxed);
+    stats.syscalls = writeSyscalls_.exchange(0, std::memory_order_relaxed);
+    stats.packets = writePackets_.exchange(0, std::memory_order_relaxed);
+    stats.bytes = writeBytes_.exchange(0, std::memory_order_relaxed);
+    stats.maxPacketsPerFlush = writeMaxPacketsPerFlush_.exchange(0, std::memory_order_relaxed);
+    stats.supersededBytes = supersededBytes_.exchange(0, std::memory_order_relaxed);
+    stats.droppedBytes = droppedBytes_.exchange(0, std::memory_order_relaxed);
+    stats.pacedWaits = pacedWaits_.exchange(0, std::memory_order_relaxed);
+    return stats;
+}
+
 std::string
 NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message)
 {
-    nlohmann::json response;
-    std::string currentTimestamp = TimestampUtils::getCurrentTimestamp();
-    response["header"] = message["header"];
-    response["header"]["status"] = status;
-    response["header"]["timestamp"] = currentTimestamp;
-    response["header"]["version"] = "1.0";
-    response["body"] = message["body"];
-
-    std::string responseString = response.dump();
-    log_->info("Response generated: " + responseString);
-    return responseString + "\n";
+    std::string responseString = JsonPackets::encodeResponse(status, message);
+    log_->info("Response generated: {}", std::string_view(responseString.data(), responseString.size() - 1));
+    return responseString;
 }
 
 std::string
 NetworkManager::generateResponseMessage(const std::string &status, const nlohmann::json &message, const TimestampStruct &timestamps)
 {
-    nlohmann::json response;
-    std::string currentTimestamp = TimestampUtils::getCurrentTimestamp();
-    response["header"] = message["header"];
-    response["header"]["status"] = status;
-    response["header"]["timestamp"] = currentTimestamp;
-    response["header"]["version"] = "1.0";
-
-    // Add lag compensation timestamps to header
-    TimestampStruct finalTimestamps = timestamps;
-    TimestampUtils::setServerSendTimestamp(finalTimestamps); // Set serverSendMs to current time
-    TimestampUtils::addTimestampsToHeader(response, finalTimestamps);
-
-    response["body"] = message["body"];
-
-    std::string responseString = response.dump();
-    log_->info("Response with timestamps generated: " + responseString);
-    return responseString + "\n";
+    std::string responseString = JsonPackets::encodeResponse(status, message, &timestamps);
+    log_->info("Response with timestamps generated: {}", std::string_view(responseString.data(), responseString.size() - 1));
+    return responseString;
 }
 
 void
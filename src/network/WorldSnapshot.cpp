@@ -0,0 +1,49 @@
+#include "network/WorldSnapshot.hpp"
+#include "network/NetworkManager.hpp"
+#include "utils/TimestampUtils.hpp"
+#include <algorithm>
+
+std::shared_ptr<const WorldSnapshotSection::Fragments>
+WorldSnapshotSection::get(uint64_t sourceVersion, const Builder &build)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    const int64_t nowMs = TimestampUtils::getCurrentTimestampMs();
+    if (fragments_ && builtSourceVersion_ == sourceVersion && nowMs - builtAtMs_ <= maxAgeMs_)
+    {
+        return fragments_;
+    }
+
+    auto fragments = std::make_shared<Fragments>();
+    build(*fragments);
+    fragments_ = std::move(fragments);
+    builtSourceVersion_ = sourceVersion;
+    builtAtMs_ = nowMs;
+    return fragments_;
+}
+
+void
+WorldSnapshotStream::add(float x, float y, std::string packet, bool critical)
+{
+    packets_.push_back({distanceSq(x, y), critical, std::make_shared<const std::string>(std::move(packet))});
+}
+
+void
+WorldSnapshotStream::send(NetworkManager &networkManager, const std::shared_ptr<boost::asio::ip::tcp::socket> &socket, float nearRadius)
+{
+    // Critical packets first (later packets may refer to them), each group nearest first
+    std::stable_sort(packets_.begin(), packets_.end(), [](const Packet &a, const Packet &b)
+        {
+            if (a.critical != b.critical)
+                return a.critical;
+            return a.distanceSq < b.distanceSq; });
+
+    const float nearSq = nearRadius * nearRadius;
+    for (auto &packet : packets_)
+    {
+        if (packet.critical || nearRadius < 0.0f || packet.distanceSq <= nearSq)
+            networkManager.sendResponse(socket, std::move(packet.data));
+        else
+            networkManager.sendResponseBulk(socket, std::move(packet.data));
+    }
+    packets_.clear();
+}
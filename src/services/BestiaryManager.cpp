@@ -238,7 +238,7 @@ BestiaryManager::setThresholds(std::vector<int> thresholds)
 }
 
 void
-BestiaryManager::setSaveCallback(std::function<void(const std::string &)> callback)
+BestiaryManager::setSaveCallback(PersistWriteCallback callback)
 {
     saveCallback_ = std::move(callback);
 }
@@ -267,7 +267,7 @@ BestiaryManager::persist(int characterId, int mobTemplateId, int killCount)
         pkt["body"]["characterId"] = characterId;
         pkt["body"]["mobTemplateId"] = mobTemplateId;
         pkt["body"]["killCount"] = killCount;
-        saveCallback_(pkt.dump() + "\n");
+        saveCallback_(characterId, "bestiary:" + std::to_string(characterId) + ":" + std::to_string(mobTemplateId), pkt.dump() + "\n");
     }
     catch (const std::exception &e)
     {
@@ -9,8 +9,51 @@
 #include <unordered_map>
 #include <vector>
 
+namespace
+{
+// Covers a typical aggro range (~400 units) in a 3x3 neighbourhood.
+constexpr float CHARACTER_GRID_CELL_SIZE = 1000.0f;
+
+int64_t
+unixNowSec()
+{
+    return std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+        .count();
+}
+
+// Slugs are interned once on the way in so ticks, stat compiles and combat
+// compare integers. Entries already resolved upstream (JSONParser) are kept.
+void
+resolveAttributeSymbols(std::vector<CharacterAttributeStruct> &attributes)
+{
+    for (auto &attr : attributes)
+        if (attr.slugId == NO_SYMBOL)
+            attr.slugId = internSymbol(attr.slug);
+}
+
+void
+resolveEffectListSymbols(std::vector<ActiveEffectStruct> &effects)
+{
+    for (auto &eff : effects)
+        if (eff.attributeSlugId == NO_SYMBOL)
+            resolveEffectSymbols(eff);
+}
+
+void
+resolveCharacterSymbols(CharacterDataStruct &character)
+{
+    resolveAttributeSymbols(character.attributes);
+    resolveAttributeSymbols(character.equipmentAttributes);
+    resolveEffectListSymbols(character.activeEffects);
+    for (auto &skill : character.skills)
+        if (skill.skillSlugId == NO_SYMBOL)
+            resolveSkillSymbols(skill);
+}
+} // namespace
+
 CharacterManager::CharacterManager(Logger &logger)
-    : logger_(logger)
+    : logger_(logger), positionGrid_(CHARACTER_GRID_CELL_SIZE)
 {
     log_ = logger.getSystem("character");
     // Initialize properties or perform any setup here
@@ -30,8 +73,11 @@ CharacterManager::loadCharactersList(std::vector<CharacterDataStruct> characters
         for (const auto &row : charactersList)
         {
             // HIGH-9: O(1) insert/update
-            charactersMap_[row.characterId].characterId = row.characterId;
+            auto &character = charactersMap_[row.characterId];
+            character.characterId = row.characterId;
+            positionGrid_.update(row.characterId, character.characterPosition.positionX, character.characterPosition.positionY);
         }
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
     }
     catch (const std::exception &e)
     {
@@ -51,6 +97,7 @@ CharacterManager::loadCharacterAttributes(std::vector<CharacterAttributeStruct>
         }
 
         std::unique_lock<std::shared_mutex> lock(mutex_);
+        std::unordered_set<int> touched;
         for (const auto &row : characterAttributes)
         {
             CharacterAttributeStruct attributeData;
@@ -58,6 +105,7 @@ CharacterManager::loadCharacterAttributes(std::vector<CharacterAttributeStruct>
             attributeData.id = row.id;
             attributeData.name = row.name;
             attributeData.slug = row.slug;
+            attributeData.slugId = row.slugId != NO_SYMBOL ? row.slugId : internSymbol(row.slug);
             attributeData.value = row.value;
 
             // CRITICAL-4 + HIGH-9 fix: O(1) map lookup instead of OOB vector index
@@ -65,8 +113,13 @@ CharacterManager::loadCharacterAttributes(std::vector<CharacterAttributeStruct>
             if (it != charactersMap_.end())
             {
                 it->second.attributes.push_back(attributeData);
+                touched.insert(attributeData.character_id);
             }
         }
+
+        const int64_t nowSec = unixNowSec();
+        for (int characterId : touched)
+            compileStatSheetLocked(charactersMap_[characterId], nowSec);
     }
     catch (const std::exception &e)
     {
@@ -123,8 +176,10 @@ CharacterManager::loadCharacterData(CharacterDataStruct characterData)
             log_->error("No character data found in GS");
         }
 
+        resolveCharacterSymbols(characterData);
         std::unique_lock<std::shared_mutex> lock(mutex_);
         // HIGH-9: O(1) map lookup + update
+        const auto armAt = queueEffectDeadlineLocked(characterData);
         auto it = charactersMap_.find(characterData.characterId);
         if (it != charactersMap_.end())
         {
@@ -135,6 +190,9 @@ CharacterManager::loadCharacterData(CharacterDataStruct characterData)
             // the new position against a stale lastValidatedPosition.
             characterData.lastValidatedPosition = it->second.lastValidatedPosition;
             characterData.lastMoveSrvMs = it->second.lastMoveSrvMs;
+            // Equipment bonuses are owned by EquipmentManager, never by the snapshot.
+            characterData.equipmentAttributes = it->second.equipmentAttributes;
+            compileStatSheetLocked(characterData, unixNowSec());
             it->second = characterData;
         }
         else
@@ -142,8 +200,13 @@ CharacterManager::loadCharacterData(CharacterDataStruct characterData)
             // Character not yet in map (race during login) — insert it
             if (characterData.joinTimestamp == std::chrono::steady_clock::time_point{})
                 characterData.joinTimestamp = std::chrono::steady_clock::now();
+            compileStatSheetLocked(characterData, unixNowSec());
             charactersMap_[characterData.characterId] = characterData;
         }
+        positionGrid_.update(characterData.characterId, characterData.characterPosition.positionX, characterData.characterPosition.positionY);
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
+        lock.unlock();
+        armEffectTimer(armAt);
     }
     catch (const std::exception &e)
     {
@@ -156,21 +219,33 @@ CharacterManager::addCharacter(const CharacterDataStruct &characterData)
 {
     std::unique_lock<std::shared_mutex> lock(mutex_);
 
-    if (charactersMap_.count(characterData.characterId))
+    std::vector<CharacterAttributeStruct> equipmentAttributes = characterData.equipmentAttributes;
+    auto existing = charactersMap_.find(characterData.characterId);
+    if (existing != charactersMap_.end())
     {
         // Character already cached (e.g. from a previous session that did not cleanly
         // disconnect).  Overwrite with the fresh data received from the Game Server so
         // that position and stats always reflect the current DB state on login.
         log_->warn("Character with ID " + std::to_string(characterData.characterId) +
                    " already exists — overwriting with fresh Game Server data.");
+        equipmentAttributes = std::move(existing->second.equipmentAttributes);
     }
 
     charactersMap_[characterData.characterId] = characterData;
+    charactersMap_[characterData.characterId].equipmentAttributes = std::move(equipmentAttributes);
+    resolveCharacterSymbols(charactersMap_[characterData.characterId]);
+    compileStatSheetLocked(charactersMap_[characterData.characterId], unixNowSec());
 
     // Set join timestamp for ghost character detection if not already set
     if (charactersMap_[characterData.characterId].joinTimestamp == std::chrono::steady_clock::time_point{})
         charactersMap_[characterData.characterId].joinTimestamp = std::chrono::steady_clock::now();
 
+    positionGrid_.update(characterData.characterId, characterData.characterPosition.positionX, characterData.characterPosition.positionY);
+    const auto armAt = queueEffectDeadlineLocked(charactersMap_[characterData.characterId]);
+    membershipVersion_.fetch_add(1, std::memory_order_relaxed);
+    lock.unlock();
+    armEffectTimer(armAt);
+
     log_->info("Character with ID " + std::to_string(characterData.characterId) + " added/updated.");
 }
 
@@ -183,6 +258,8 @@ CharacterManager::removeCharacter(int characterID)
     if (it != charactersMap_.end())
     {
         charactersMap_.erase(it);
+        positionGrid_.remove(characterID);
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
         log_->info("Character with ID " + std::to_string(characterID) + " removed.");
     }
     else
@@ -252,7 +329,10 @@ CharacterManager::setCharacterPosition(int characterID, PositionStruct position)
     std::unique_lock<std::shared_mutex> lock(mutex_);
     auto it = charactersMap_.find(characterID);
     if (it != charactersMap_.end())
+    {
         it->second.characterPosition = position;
+        positionGrid_.update(characterID, position.positionX, position.positionY);
+    }
 }
 
 void
@@ -424,22 +504,34 @@ CharacterManager::addExperienceDebt(int characterID, int debt)
 std::vector<CharacterDataStruct>
 CharacterManager::getCharactersInZone(float centerX, float centerY, float radius)
 {
-    std::shared_lock<std::shared_mutex> lock(mutex_);
     std::vector<CharacterDataStruct> charactersInZone;
+    forEachCharacterInRange(centerX, centerY, radius, [&](const CharacterDataStruct &character, float)
+        { charactersInZone.push_back(character); });
+    return charactersInZone;
+}
 
-    for (const auto &[id, character] : charactersMap_)
-    {
-        float distance = calculateDistance(
-            {centerX, centerY, 0.0f, 0.0f},
-            character.characterPosition);
+std::vector<CharacterRangeHit>
+CharacterManager::getCharactersInRange(float centerX, float centerY, float radius) const
+{
+    std::vector<CharacterRangeHit> result;
+    forEachCharacterInRange(centerX, centerY, radius, [&](const CharacterDataStruct &character, float distSq)
+        { result.push_back({character.characterId, character.characterPosition, distSq}); });
+    return result;
+}
 
-        if (distance <= radius && !character.isDead)
+void
+CharacterManager::forEachCharacterInRange(float centerX,
+    float centerY,
+    float radius,
+    const std::function<void(const CharacterDataStruct &, float)> &visitor) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    positionGrid_.forEachInRange(centerX, centerY, radius, [&](int characterId, float, float, float distSq)
         {
-            charactersInZone.push_back(character);
-        }
-    }
-
-    return charactersInZone;
+            auto it = charactersMap_.find(characterId);
+            if (it != charactersMap_.end() && !it->second.isDead)
+                visitor(it->second, distSq);
+        });
 }
 
 CharacterDataStruct
@@ -468,9 +560,14 @@ CharacterManager::setCharacterActiveEffects(int characterID, std::vector<ActiveE
     if (it != charactersMap_.end())
     {
         it->second.activeEffects = std::move(effects);
+        resolveEffectListSymbols(it->second.activeEffects);
+        compileStatSheetLocked(it->second, unixNowSec());
         logger_.log("[CharacterManager] Set " +
                     std::to_string(it->second.activeEffects.size()) +
                     " active effects for character " + std::to_string(characterID));
+        const auto armAt = queueEffectDeadlineLocked(it->second);
+        lock.unlock();
+        armEffectTimer(armAt);
         return;
     }
     log_->error("[CharacterManager] setCharacterActiveEffects: character " +
@@ -502,8 +599,15 @@ CharacterManager::addActiveEffect(int characterID, const ActiveEffectStruct &eff
     else
     {
         effects.push_back(effect);
+        if (effects.back().attributeSlugId == NO_SYMBOL)
+            resolveEffectSymbols(effects.back());
         log_->info("[CharacterManager] Added effect '" + effect.effectSlug + "' for character " + std::to_string(characterID));
     }
+    compileStatSheetLocked(it->second, unixNowSec());
+
+    const auto armAt = queueEffectDeadlineLocked(it->second);
+    lock.unlock();
+    armEffectTimer(armAt);
 }
 
 void
@@ -523,7 +627,10 @@ CharacterManager::removeActiveEffectBySlug(int characterID, const std::string &e
             { return e.effectSlug == effectSlug; }),
         effects.end());
     if (effects.size() < before)
+    {
+        compileStatSheetLocked(it->second, unixNowSec());
         log_->info("[CharacterManager] Removed effect '{}' from character {}", effectSlug, characterID);
+    }
 }
 
 int
@@ -533,22 +640,13 @@ CharacterManager::restoreManaToCharacter(int characterID, int amount)
     auto it = charactersMap_.find(characterID);
     if (it != charactersMap_.end())
     {
-        // Compute effective max mana (base + permanent active-effect bonuses)
+        // Compute effective max mana (base + active-effect bonuses)
         // so that passive skills like mana_shield are respected as the true cap.
-        int effectiveMaxMana = it->second.characterMaxMana;
-        const int64_t nowSec = static_cast<int64_t>(std::chrono::duration_cast<std::chrono::seconds>(
-            std::chrono::system_clock::now().time_since_epoch())
-                .count());
-        for (const auto &eff : it->second.activeEffects)
-        {
-            if (eff.attributeSlug != "max_mana")
-                continue;
-            if (eff.tickMs > 0)
-                continue; // skip DoT/HoT
-            if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
-                continue;
-            effectiveMaxMana += static_cast<int>(std::round(eff.value));
-        }
+        const int64_t nowSec = unixNowSec();
+        if (!it->second.statSheet.isFresh(nowSec))
+            compileStatSheetLocked(it->second, nowSec);
+        const int effectiveMaxMana = it->second.characterMaxMana +
+                                     it->second.statSheet.roundedStaticEffect[static_cast<std::size_t>(StatId::MAX_MANA)];
         int newMana = std::min(effectiveMaxMana, it->second.characterCurrentMana + amount);
         it->second.characterCurrentMana = newMana;
         return newMana;
@@ -590,6 +688,8 @@ CharacterManager::replaceCharacterAttributes(int characterID, std::vector<Charac
     if (it != charactersMap_.end())
     {
         it->second.attributes = std::move(attributes);
+        resolveAttributeSymbols(it->second.attributes);
+        compileStatSheetLocked(it->second, unixNowSec());
         logger_.log("[CharacterManager] Replaced " +
                     std::to_string(it->second.attributes.size()) +
                     " attributes for character " + std::to_string(characterID));
@@ -615,6 +715,7 @@ CharacterManager::processEffectTicks()
         int characterId;
         std::string effectSlug;
         std::string effectTypeSlug;
+        EffectTickKind tickKind;
         float value; // abs amount per tick
     };
     std::vector<PendingTick> pending;
@@ -623,32 +724,45 @@ CharacterManager::processEffectTicks()
     // Advance nextTickAt, remove expired effects, collect pending HP-change work.
     // No external calls are made here — the lock window is kept to pure in-memory
     // iteration so concurrent shared_lock readers (e.g. getCharactersList) are
-    // blocked for the shortest possible time.
+    // blocked for the shortest possible time. Only characters with a due
+    // deadline are visited.
+    EffectClock::time_point armAt = EffectClock::time_point::max();
     {
         std::unique_lock<std::shared_mutex> lock(mutex_);
-        for (auto &[id, character] : charactersMap_)
+
+        std::vector<int> dueCharacters;
+        while (!effectDeadlines_.empty() && effectDeadlines_.top().first <= now)
         {
-            int effectiveMaxHealth = character.characterMaxHealth;
-            for (const auto &eff : character.activeEffects)
-            {
-                if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
-                    continue;
-                if (eff.effectTypeSlug == "dot" || eff.effectTypeSlug == "hot")
-                    continue;
-                if (eff.attributeSlug == "max_health")
-                    effectiveMaxHealth += static_cast<int>(std::round(eff.value));
-            }
-            effectiveMaxHealth = std::max(1, effectiveMaxHealth);
+            dueCharacters.push_back(effectDeadlines_.top().second);
+            effectDeadlines_.pop();
+        }
+        std::sort(dueCharacters.begin(), dueCharacters.end());
+        dueCharacters.erase(std::unique(dueCharacters.begin(), dueCharacters.end()), dueCharacters.end());
+        effectTimerArmedAt_ = EffectClock::time_point::max(); // the timer that got us here has fired
+
+        for (int characterId : dueCharacters)
+        {
+            auto characterIt = charactersMap_.find(characterId);
+            if (characterIt == charactersMap_.end())
+                continue;
+            auto &character = characterIt->second;
+
+            if (!character.statSheet.isFresh(nowSec))
+                compileStatSheetLocked(character, nowSec);
+            const int effectiveMaxHealth = std::max(1, character.characterMaxHealth + character.statSheet.roundedEffect[static_cast<std::size_t>(StatId::MAX_HEALTH)]);
 
             for (auto &eff : character.activeEffects)
             {
                 if (eff.tickMs <= 0)
                     continue; // not a tick effect
-                if (eff.effectTypeSlug != "dot" && eff.effectTypeSlug != "hot")
+                if (eff.tickKind == EffectTickKind::NONE)
                     continue;
                 if (character.isDead)
+                {
+                    eff.nextTickAt = now + std::chrono::milliseconds(eff.tickMs);
                     continue; // already dead — skip ticks
-                if (eff.effectTypeSlug == "dot" && effectiveMaxHealth > 0 &&
+                }
+                if (eff.tickKind == EffectTickKind::DOT && effectiveMaxHealth > 0 &&
                     character.characterCurrentHealth <= static_cast<int>(effectiveMaxHealth * 0.10f))
                 {
                     eff.nextTickAt = now + std::chrono::milliseconds(eff.tickMs);
@@ -662,7 +776,7 @@ CharacterManager::processEffectTicks()
                 if (eff.nextTickAt < now)
                     eff.nextTickAt = now + std::chrono::milliseconds(eff.tickMs);
 
-                pending.push_back({character.characterId, eff.effectSlug, eff.effectTypeSlug, std::abs(eff.value)});
+                pending.push_back({character.characterId, eff.effectSlug, eff.effectTypeSlug, eff.tickKind, std::abs(eff.value)});
             }
 
             // Remove expired effects
@@ -672,9 +786,21 @@ CharacterManager::processEffectTicks()
                     { return e.expiresAt != 0 && e.expiresAt <= nowSec; }),
                 character.activeEffects.end());
             if (character.activeEffects.size() < countBefore)
+            {
                 expiredCharacters.insert(character.characterId);
+                compileStatSheetLocked(character, nowSec);
+            }
+
+            queueEffectDeadlineLocked(character);
+        }
+
+        if (!effectDeadlines_.empty())
+        {
+            armAt = effectDeadlines_.top().first;
+            effectTimerArmedAt_ = armAt;
         }
     } // unique_lock released here
+    armEffectTimer(armAt);
 
     // ── Phase 2: per-call narrow locks ───────────────────────────────────────
     // Apply HP deltas one character at a time. Each call acquires its own
@@ -687,7 +813,7 @@ CharacterManager::processEffectTicks()
         tick.effectTypeSlug = pt.effectTypeSlug;
         tick.value = pt.value;
 
-        if (pt.effectTypeSlug == "dot")
+        if (pt.tickKind == EffectTickKind::DOT)
         {
             auto hr = applyDamageToCharacter(pt.characterId, static_cast<int>(pt.value));
             tick.newHealth = hr.newHealth;
@@ -707,6 +833,54 @@ CharacterManager::processEffectTicks()
     return {results, expiredCharacters};
 }
 
+void
+CharacterManager::setEffectTimerCallback(std::function<void(std::chrono::steady_clock::time_point)> callback)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    effectTimerCallback_ = std::move(callback);
+}
+
+CharacterManager::EffectClock::time_point
+CharacterManager::queueEffectDeadlineLocked(const CharacterDataStruct &character)
+{
+    const auto now = EffectClock::now();
+    const int64_t nowSec = std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch())
+                               .count();
+
+    auto due = EffectClock::time_point::max();
+    for (const auto &eff : character.activeEffects)
+    {
+        if (eff.tickMs > 0 && eff.tickKind != EffectTickKind::NONE)
+            due = std::min(due, std::max(now, eff.nextTickAt));
+        // expiresAt is wall-clock seconds; mapped onto the steady clock from now
+        if (eff.expiresAt != 0)
+            due = std::min(due, now + std::chrono::seconds(std::max<int64_t>(0, eff.expiresAt - nowSec)));
+    }
+    if (due == EffectClock::time_point::max())
+        return due;
+
+    effectDeadlines_.push({due, character.characterId});
+    if (due >= effectTimerArmedAt_)
+        return EffectClock::time_point::max();
+    effectTimerArmedAt_ = due;
+    return due;
+}
+
+void
+CharacterManager::armEffectTimer(EffectClock::time_point due)
+{
+    if (due == EffectClock::time_point::max())
+        return;
+    std::function<void(EffectClock::time_point)> callback;
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        callback = effectTimerCallback_;
+    }
+    if (callback)
+        callback(due);
+}
+
 void
 CharacterManager::removeExpiredActiveEffects(int characterID)
 {
@@ -719,10 +893,57 @@ CharacterManager::removeExpiredActiveEffects(int characterID)
     if (it == charactersMap_.end())
         return;
     auto &effects = it->second.activeEffects;
+    const std::size_t countBefore = effects.size();
     effects.erase(
         std::remove_if(effects.begin(), effects.end(), [&](const ActiveEffectStruct &eff)
             { return eff.expiresAt != 0 && eff.expiresAt <= nowSec; }),
         effects.end());
+    if (effects.size() < countBefore || !it->second.statSheet.isFresh(nowSec))
+        compileStatSheetLocked(it->second, nowSec);
+}
+
+void
+CharacterManager::setCharacterEquipmentBonuses(int characterID, std::vector<CharacterAttributeStruct> bonuses)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = charactersMap_.find(characterID);
+    if (it == charactersMap_.end())
+    {
+        log_->error("[CharacterManager] setCharacterEquipmentBonuses: character " + std::to_string(characterID) + " not found");
+        return;
+    }
+    it->second.equipmentAttributes = std::move(bonuses);
+    resolveAttributeSymbols(it->second.equipmentAttributes);
+    compileStatSheetLocked(it->second, unixNowSec());
+}
+
+CharacterStatSheet
+CharacterManager::getCharacterStatSheet(int characterID)
+{
+    const int64_t nowSec = unixNowSec();
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = charactersMap_.find(characterID);
+        if (it == charactersMap_.end())
+            return CharacterStatSheet{};
+        if (it->second.statSheet.isFresh(nowSec))
+            return it->second.statSheet;
+    }
+
+    // A timed effect expired since the last compile — rebuild under the write lock.
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = charactersMap_.find(characterID);
+    if (it == charactersMap_.end())
+        return CharacterStatSheet{};
+    if (!it->second.statSheet.isFresh(nowSec))
+        compileStatSheetLocked(it->second, nowSec);
+    return it->second.statSheet;
+}
+
+void
+CharacterManager::compileStatSheetLocked(CharacterDataStruct &character, int64_t nowSec)
+{
+    character.statSheet = compileStatSheet(character.attributes, character.equipmentAttributes, character.activeEffects, nowSec);
 }
 
 // ── Skill system helpers ──────────────────────────────────────────────────
@@ -741,10 +962,14 @@ CharacterManager::addCharacterSkill(int characterID, const SkillStruct &skill)
         if (s.skillSlug == skill.skillSlug)
         {
             s = skill;
+            if (s.skillSlugId == NO_SYMBOL)
+                resolveSkillSymbols(s);
             return;
         }
     }
     skills.push_back(skill);
+    if (skills.back().skillSlugId == NO_SYMBOL)
+        resolveSkillSymbols(skills.back());
 }
 
 void
@@ -145,57 +145,23 @@ CharacterStatsNotificationService::buildStatsUpdatePacket(int characterId)
     float currentWeight = gameServices_->getInventoryManager().getTotalWeight(characterId);
     float weightLimit = gameServices_->getEquipmentManager().getCarryWeightLimit(characterId);
 
-    // ── Build effective attributes: base + equipment bonuses + active effects ─
-    // Start with base character attributes
-    std::unordered_map<std::string, int> baseValues;
-    std::unordered_map<std::string, float> effectiveValues;
-    std::unordered_map<std::string, std::string> attrNames;
-
-    for (const auto &a : characterData.attributes)
-    {
-        baseValues[a.slug] = a.value;
-        effectiveValues[a.slug] = a.value;
-        attrNames[a.slug] = a.name;
-    }
-
-    // Add item attribute bonuses from equipped gear (apply_on == "equip")
-    const auto equipState = gameServices_->getEquipmentManager().getEquipmentState(characterId);
-    for (const auto &[slotSlug, slot] : equipState.slots)
-    {
-        if (slot.inventoryItemId == 0)
-            continue;
-        const auto item = gameServices_->getItemManager().getItemById(slot.itemId);
-        if (item.id == 0)
-            continue;
-        for (const auto &attr : item.attributes)
-        {
-            if (attr.apply_on != "equip")
-                continue;
-            effectiveValues[attr.slug] += attr.value;
-            if (attrNames.find(attr.slug) == attrNames.end())
-                attrNames[attr.slug] = attr.name;
-        }
-    }
-
-    // Add non-expired stat-modifier active effects (skip dot/hot – they are damage ticks)
+    // ── Effective attributes: base + equipment bonuses + active effects ───────
+    // Read from the compiled stat sheet; only the display names are gathered here.
     const int64_t nowSec = std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::system_clock::now().time_since_epoch())
                                .count();
+    CharacterStatSheet statScratch;
+    const CharacterStatSheet &stats = statSheetFor(characterData, statScratch, nowSec);
 
-    for (const auto &eff : characterData.activeEffects)
-    {
-        if (eff.attributeSlug.empty())
-            continue;
-        if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
-            continue;
-        if (eff.effectTypeSlug == "dot" || eff.effectTypeSlug == "hot")
-            continue;
-        effectiveValues[eff.attributeSlug] += static_cast<float>(eff.value);
-        if (attrNames.find(eff.attributeSlug) == attrNames.end())
-            attrNames[eff.attributeSlug] = eff.attributeSlug;
-    }
+    std::unordered_map<std::string, std::string> attrNames;
+    for (const auto &a : characterData.attributes)
+        attrNames.emplace(a.slug, a.name);
+    for (const auto &a : characterData.equipmentAttributes)
+        attrNames.emplace(a.slug, a.name);
 
-    // Item Soul: apply kill-count tier bonus to the equipped weapon's primary attribute
+    // Item Soul: kill-count tier bonus on the equipped weapon's primary attribute (display only)
+    std::string soulSlug;
+    int soulBonus = 0;
     try
     {
         auto weaponOpt = gameServices_->getInventoryManager().getEquippedWeapon(characterId);
@@ -206,20 +172,19 @@ CharacterStatsNotificationService::buildStatsUpdatePacket(int characterId)
             const int t1 = cfg.getInt("item_soul.tier1_kills", 50);
             const int t2 = cfg.getInt("item_soul.tier2_kills", 200);
             const int t3 = cfg.getInt("item_soul.tier3_kills", 500);
-            const int soulBonus = (kc >= t3)   ? cfg.getInt("item_soul.tier3_bonus_flat", 3)
-                                  : (kc >= t2) ? cfg.getInt("item_soul.tier2_bonus_flat", 2)
-                                  : (kc >= t1) ? cfg.getInt("item_soul.tier1_bonus_flat", 1)
-                                               : 0;
+            soulBonus = (kc >= t3)   ? cfg.getInt("item_soul.tier3_bonus_flat", 3)
+                        : (kc >= t2) ? cfg.getInt("item_soul.tier2_bonus_flat", 2)
+                        : (kc >= t1) ? cfg.getInt("item_soul.tier1_bonus_flat", 1)
+                                     : 0;
             if (soulBonus > 0)
             {
                 const auto &wItem = gameServices_->getItemManager().getItemById(weaponOpt->itemId);
                 for (const auto &attr : wItem.attributes)
                 {
-                    if (attr.apply_on == "equip" && !attr.slug.empty())
+                    if (attr.applyOn == ItemAttributeApplyOn::EQUIP && !attr.slug.empty())
                     {
-                        effectiveValues[attr.slug] += soulBonus;
-                        if (attrNames.find(attr.slug) == attrNames.end())
-                            attrNames[attr.slug] = attr.name;
+                        soulSlug = attr.slug;
+                        attrNames.emplace(attr.slug, attr.name);
                         break; // one bonus per weapon
                     }
                 }
@@ -232,22 +197,32 @@ CharacterStatsNotificationService::buildStatsUpdatePacket(int characterId)
 
     // Build attributes JSON array (base attrs + any extras added only by equipment/effects)
     nlohmann::json attributesJson = nlohmann::json::array();
-    for (const auto &[slug, baseVal] : baseValues)
+    bool soulApplied = soulSlug.empty();
+    auto appendAttribute = [&](const std::string &slug, int baseVal, float effVal)
     {
+        if (slug == soulSlug)
+        {
+            effVal += static_cast<float>(soulBonus);
+            soulApplied = true;
+        }
+        auto nameIt = attrNames.find(slug);
         attributesJson.push_back({{"slug", slug},
-            {"name", attrNames.count(slug) ? attrNames.at(slug) : slug},
+            {"name", nameIt != attrNames.end() ? nameIt->second : slug},
             {"base", baseVal},
-            {"effective", effectiveValues.at(slug)}});
-    }
-    for (const auto &[slug, effVal] : effectiveValues)
-    {
-        if (baseValues.count(slug))
-            continue; // already included above
-        attributesJson.push_back({{"slug", slug},
-            {"name", attrNames.count(slug) ? attrNames.at(slug) : slug},
-            {"base", 0},
             {"effective", effVal}});
+    };
+    for (std::size_t i = 0; i < STAT_COUNT; ++i)
+    {
+        if (!stats.present.test(i))
+            continue;
+        appendAttribute(statSlug(static_cast<StatId>(i)),
+            stats.base[i],
+            static_cast<float>(stats.base[i] + stats.equip[i]) + stats.effect[i]);
     }
+    for (const auto &[symbol, x] : stats.extra)
+        appendAttribute(symbolName(symbol), x.base, static_cast<float>(x.base + x.equip) + x.effect);
+    if (!soulApplied)
+        appendAttribute(soulSlug, 0, 0.0f);
 
     // ── Active effects display list (all non-expired effects) ─────────────────
     nlohmann::json activeEffectsJson = nlohmann::json::array();
@@ -267,12 +242,18 @@ CharacterStatsNotificationService::buildStatsUpdatePacket(int characterId)
     // so the client bar is drawn against the real cap, not the stripped base value.
     // This matches what is reported in the attributes array and prevents false "current > max"
     // warnings when passive skills (e.g. mana_shield) raise the effective maximum.
-    const int effectiveMaxHealth = effectiveValues.count("max_health")
-                                        ? static_cast<int>(std::round(effectiveValues.at("max_health")))
-                                        : characterData.characterMaxHealth;
-    const int effectiveMaxMana = effectiveValues.count("max_mana")
-                                      ? static_cast<int>(std::round(effectiveValues.at("max_mana")))
-                                      : characterData.characterMaxMana;
+    auto effectiveMax = [&](StatId id, int fallback)
+    {
+        const auto i = static_cast<std::size_t>(id);
+        if (!stats.present.test(i))
+            return fallback;
+        float eff = static_cast<float>(stats.base[i] + stats.equip[i]) + stats.effect[i];
+        if (statSlug(id) == soulSlug)
+            eff += static_cast<float>(soulBonus);
+        return static_cast<int>(std::round(eff));
+    };
+    const int effectiveMaxHealth = effectiveMax(StatId::MAX_HEALTH, characterData.characterMaxHealth);
+    const int effectiveMaxMana = effectiveMax(StatId::MAX_MANA, characterData.characterMaxMana);
 
     TimestampStruct timestamps = TimestampUtils::createReceiveTimestamp(0, requestId);
     ResponseBuilder builder;
@@ -143,6 +143,18 @@ ClientManager::getClientDataByCharacterId(int characterId)
     return ClientDataStruct();
 }
 
+int
+ClientManager::getCharacterIdByClientId(int clientID) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (const auto &client : clientsList_)
+    {
+        if (client.clientId == clientID)
+            return client.characterId;
+    }
+    return 0;
+}
+
 std::shared_ptr<boost::asio::ip::tcp::socket>
 ClientManager::getClientSocket(int clientID)
 {
@@ -403,6 +415,23 @@ ClientManager::getActiveSockets(int excludeClientId) const
     return result;
 }
 
+std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>>
+ClientManager::getSocketsForClients(const std::vector<int> &clientIds) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    std::vector<std::shared_ptr<boost::asio::ip::tcp::socket>> result;
+    result.reserve(clientIds.size());
+    for (int id : clientIds)
+    {
+        auto it = clientSockets_.find(id);
+        if (it != clientSockets_.end() && it->second)
+        {
+            result.push_back(it->second);
+        }
+    }
+    return result;
+}
+
 // Separated dead-socket cleanup from the hot broadcast path.
 // Called by Scheduler every 30 seconds, NOT from broadcastToAllClients.
 void
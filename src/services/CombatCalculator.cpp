@@ -2,62 +2,64 @@
 #include <algorithm>
 #include <cmath>
 
+namespace
+{
+// Skills built without resolveSkillSymbols() (NO_SYMBOL) intern on the spot.
+SymbolId
+scaleStatSymbol(const SkillStruct &skill)
+{
+    return skill.scaleStatId != NO_SYMBOL ? skill.scaleStatId : internSymbol(skill.scaleStat);
+}
+
+SymbolId
+resistanceSymbol(const SkillStruct &skill)
+{
+    return skill.resistanceId != NO_SYMBOL ? skill.resistanceId : internSymbol(skill.school + "_resistance");
+}
+} // namespace
+
 CombatCalculator::CombatCalculator(GameConfigService *configService)
-    : gen_(rd_()), dis_(0.0f, 1.0f), gameConfig_(configService)
+    : gen_(rd_()), dis_(0.0f, 1.0f)
 {
+    setGameConfigService(configService);
 }
 
 void
 CombatCalculator::setGameConfigService(GameConfigService *configService)
 {
     gameConfig_ = configService;
+    if (!gameConfig_)
+        return;
+    keys_.levelDiffCap = gameConfig_->key("combat.level_diff_cap");
+    keys_.levelDiffHitPerLevel = gameConfig_->key("combat.level_diff_hit_per_level");
+    keys_.levelDiffDamagePerLevel = gameConfig_->key("combat.level_diff_damage_per_level");
+    keys_.defaultCritMultiplier = gameConfig_->key("combat.default_crit_multiplier");
+    keys_.maxResistanceCap = gameConfig_->key("combat.max_resistance_cap");
+    keys_.healVariance = gameConfig_->key("combat.heal_variance");
+    keys_.damageVariance = gameConfig_->key("combat.damage_variance");
+    keys_.critChanceCap = gameConfig_->key("combat.crit_chance_cap");
+    keys_.blockChanceCap = gameConfig_->key("combat.block_chance_cap");
+    keys_.baseHitChance = gameConfig_->key("combat.base_hit_chance");
+    keys_.hitChanceMin = gameConfig_->key("combat.hit_chance_min");
+    keys_.hitChanceMax = gameConfig_->key("combat.hit_chance_max");
+    keys_.defenseFormulaK = gameConfig_->key("combat.defense_formula_k");
+    keys_.defenseCap = gameConfig_->key("combat.defense_cap");
 }
 
 float
-CombatCalculator::cfg(const std::string &key, float defaultValue) const
+CombatCalculator::cfg(GameConfigKey key, float defaultValue) const
 {
     if (!gameConfig_)
         return defaultValue;
     return gameConfig_->getFloat(key, defaultValue);
 }
 
-std::vector<CharacterAttributeStruct>
-CombatCalculator::mergeEffects(const CharacterDataStruct &character) const
+int64_t
+CombatCalculator::unixNowSec()
 {
-    auto attrs = character.attributes; // copy base attributes
-
-    if (character.activeEffects.empty())
-        return attrs;
-
-    const int64_t nowSec = std::chrono::duration_cast<std::chrono::seconds>(
+    return std::chrono::duration_cast<std::chrono::seconds>(
         std::chrono::system_clock::now().time_since_epoch())
-                               .count();
-
-    for (const auto &eff : character.activeEffects)
-    {
-        if (eff.attributeSlug.empty())
-            continue; // non-stat effect
-        if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
-            continue; // expired
-        // DoT/HoT are not stat modifiers — handled by tickEffects()
-        if (eff.effectTypeSlug == "dot" || eff.effectTypeSlug == "hot")
-            continue;
-
-        auto it = std::find_if(attrs.begin(), attrs.end(), [&](const CharacterAttributeStruct &a)
-            { return a.slug == eff.attributeSlug; });
-        if (it != attrs.end())
-        {
-            it->value += static_cast<int>(std::round(eff.value));
-        }
-        else
-        {
-            CharacterAttributeStruct newAttr;
-            newAttr.slug = eff.attributeSlug;
-            newAttr.value = static_cast<int>(std::round(eff.value));
-            attrs.push_back(std::move(newAttr));
-        }
-    }
-    return attrs;
+        .count();
 }
 
 DamageCalculationStruct
@@ -69,16 +71,18 @@ CombatCalculator::calculateSkillDamage(
     DamageCalculationStruct result;
     result.damageType = (skill.school == "physical") ? "physical" : "magical";
 
-    // Apply non-expired active effects to base attributes
-    const auto effAtk = mergeEffects(attacker);
-    const auto effTgt = mergeEffects(target);
+    // Base attributes + non-expired active effects, from the compiled stat sheets
+    const int64_t nowSec = unixNowSec();
+    CharacterStatSheet atkScratch, tgtScratch;
+    const CharacterStatSheet &effAtk = statSheetFor(attacker, atkScratch, nowSec);
+    const CharacterStatSheet &effTgt = statSheetFor(target, tgtScratch, nowSec);
 
     // Level difference modifier
     const int rawDiff = attacker.characterLevel - target.characterLevel;
-    const int cap = static_cast<int>(cfg("combat.level_diff_cap", 10.0f));
+    const int cap = static_cast<int>(cfg(keys_.levelDiffCap, 10.0f));
     const int levelDiff = std::clamp(rawDiff, -cap, cap);
-    const float hitMod = levelDiff * cfg("combat.level_diff_hit_per_level", 0.02f);
-    const float dmgMod = 1.0f + levelDiff * cfg("combat.level_diff_damage_per_level", 0.04f);
+    const float hitMod = levelDiff * cfg(keys_.levelDiffHitPerLevel, 0.02f);
+    const float dmgMod = 1.0f + levelDiff * cfg(keys_.levelDiffDamagePerLevel, 0.04f);
 
     // Проверка промаха
     result.isMissed = rollMiss(effAtk, effTgt, hitMod);
@@ -94,9 +98,9 @@ CombatCalculator::calculateSkillDamage(
     result.isCritical = rollCriticalHit(effAtk);
     if (result.isCritical)
     {
-        float critMultiplierPct = static_cast<float>(getAttributeValue(effAtk, "crit_multiplier"));
+        float critMultiplierPct = static_cast<float>(effAtk.withEffects(StatId::CRIT_MULTIPLIER));
         if (critMultiplierPct <= 0.0f)
-            critMultiplierPct = cfg("combat.default_crit_multiplier", 200.0f);
+            critMultiplierPct = cfg(keys_.defaultCritMultiplier, 200.0f);
         result.scaledDamage = static_cast<int>(result.baseDamage * (critMultiplierPct / 100.0f));
     }
     else
@@ -108,7 +112,7 @@ CombatCalculator::calculateSkillDamage(
     result.isBlocked = rollBlock(effTgt);
     if (result.isBlocked)
     {
-        int blockValue = getAttributeValue(effTgt, "block_value");
+        int blockValue = effTgt.withEffects(StatId::BLOCK_VALUE);
         result.scaledDamage = std::max(0, result.scaledDamage - blockValue);
     }
 
@@ -119,19 +123,19 @@ CombatCalculator::calculateSkillDamage(
     int defenseValue;
     if (result.damageType == "physical")
     {
-        defenseValue = getAttributeValue(effTgt, "physical_defense");
+        defenseValue = effTgt.withEffects(StatId::PHYSICAL_DEFENSE);
     }
     else
     {
-        defenseValue = getAttributeValue(effTgt, "magical_defense");
+        defenseValue = effTgt.withEffects(StatId::MAGICAL_DEFENSE);
     }
 
     result.totalDamage = applyDefense(result.scaledDamage, defenseValue, result.damageType, target.characterLevel);
 
     // Сопротивление школы: {school}_resistance — дополнительный % от пост-защитного урона
     {
-        int resistRaw = getAttributeValue(effTgt, skill.school + "_resistance");
-        const float maxResCap = cfg("combat.max_resistance_cap", 75.0f);
+        int resistRaw = effTgt.withEffects(resistanceSymbol(skill));
+        const float maxResCap = cfg(keys_.maxResistanceCap, 75.0f);
         const float resistPct = std::min(static_cast<float>(resistRaw), maxResCap) / 100.0f;
         result.totalDamage = std::max(0, static_cast<int>(result.totalDamage * (1.0f - resistPct)));
     }
@@ -148,15 +152,16 @@ CombatCalculator::calculateMobSkillDamage(
     DamageCalculationStruct result;
     result.damageType = (skill.school == "physical") ? "physical" : "magical";
 
-    // Apply non-expired active effects to target's base attributes
-    const auto effTgt = mergeEffects(target);
+    // Target's base attributes + non-expired active effects
+    CharacterStatSheet tgtScratch;
+    const CharacterStatSheet &effTgt = statSheetFor(target, tgtScratch, unixNowSec());
 
     // Level difference modifier (mob level - character level)
     const int rawDiff = attacker.level - target.characterLevel;
-    const int cap = static_cast<int>(cfg("combat.level_diff_cap", 10.0f));
+    const int cap = static_cast<int>(cfg(keys_.levelDiffCap, 10.0f));
     const int levelDiff = std::clamp(rawDiff, -cap, cap);
-    const float hitMod = levelDiff * cfg("combat.level_diff_hit_per_level", 0.02f);
-    const float dmgMod = 1.0f + levelDiff * cfg("combat.level_diff_damage_per_level", 0.04f);
+    const float hitMod = levelDiff * cfg(keys_.levelDiffHitPerLevel, 0.02f);
+    const float dmgMod = 1.0f + levelDiff * cfg(keys_.levelDiffDamagePerLevel, 0.04f);
 
     // Промах: accuracy моба vs evasion игрока — симметрично calculateSkillDamage
     result.isMissed = rollMiss(attacker.attributes, effTgt, hitMod);
@@ -172,9 +177,9 @@ CombatCalculator::calculateMobSkillDamage(
     result.isCritical = rollCriticalHit(attacker.attributes);
     if (result.isCritical)
     {
-        float critMultiplierPct = static_cast<float>(getAttributeValue(attacker.attributes, "crit_multiplier"));
+        float critMultiplierPct = static_cast<float>(getAttributeValue(attacker.attributes, statSymbol(StatId::CRIT_MULTIPLIER)));
         if (critMultiplierPct <= 0.0f)
-            critMultiplierPct = cfg("combat.default_crit_multiplier", 200.0f);
+            critMultiplierPct = cfg(keys_.defaultCritMultiplier, 200.0f);
         result.scaledDamage = static_cast<int>(result.baseDamage * (critMultiplierPct / 100.0f));
     }
     else
@@ -186,7 +191,7 @@ CombatCalculator::calculateMobSkillDamage(
     result.isBlocked = rollBlock(effTgt);
     if (result.isBlocked)
     {
-        int blockValue = getAttributeValue(effTgt, "block_value");
+        int blockValue = effTgt.withEffects(StatId::BLOCK_VALUE);
         result.scaledDamage = std::max(0, result.scaledDamage - blockValue);
     }
 
@@ -197,19 +202,19 @@ CombatCalculator::calculateMobSkillDamage(
     int defenseValue;
     if (result.damageType == "physical")
     {
-        defenseValue = getAttributeValue(effTgt, "physical_defense");
+        defenseValue = effTgt.withEffects(StatId::PHYSICAL_DEFENSE);
     }
     else
     {
-        defenseValue = getAttributeValue(effTgt, "magical_defense");
+        defenseValue = effTgt.withEffects(StatId::MAGICAL_DEFENSE);
     }
 
     result.totalDamage = applyDefense(result.scaledDamage, defenseValue, result.damageType, target.characterLevel);
 
     // Сопротивление школы: {school}_resistance — дополнительный % от пост-защитного урона
     {
-        int resistRaw = getAttributeValue(effTgt, skill.school + "_resistance");
-        const float maxResCap = cfg("combat.max_resistance_cap", 75.0f);
+        int resistRaw = effTgt.withEffects(resistanceSymbol(skill));
+        const float maxResCap = cfg(keys_.maxResistanceCap, 75.0f);
         const float resistPct = std::min(static_cast<float>(resistRaw), maxResCap) / 100.0f;
         result.totalDamage = std::max(0, static_cast<int>(result.totalDamage * (1.0f - resistPct)));
     }
@@ -226,11 +231,11 @@ CombatCalculator::calculateHealAmount(
     // but is NOT reduced by the target's armour or resistances.
     // A separate heal-variance config key (default 0.10 = ±10%) ensures heals are
     // slightly randomised but more predictable than damage.
-    int scaleStat = getAttributeValue(casterAttributes, skill.scaleStat);
+    int scaleStat = getAttributeValue(casterAttributes, scaleStatSymbol(skill));
     int rawHeal = static_cast<int>(skill.flatAdd + (scaleStat * skill.coeff));
     rawHeal = std::max(1, rawHeal);
 
-    const float variance = cfg("combat.heal_variance", 0.10f);
+    const float variance = cfg(keys_.healVariance, 0.10f);
     float factor = 1.0f + (dis_(gen_) * 2.0f - 1.0f) * variance;
     return std::max(1, static_cast<int>(rawHeal * factor));
 }
@@ -238,14 +243,14 @@ CombatCalculator::calculateHealAmount(
 int
 CombatCalculator::calculateBaseDamage(
     const SkillStruct &skill,
-    const std::vector<CharacterAttributeStruct> &attackerAttributes)
+    const CharacterStatSheet &attackerStats)
 {
-    int scaleStatValue = getAttributeValue(attackerAttributes, skill.scaleStat);
+    int scaleStatValue = attackerStats.withEffects(scaleStatSymbol(skill));
     int rawDamage = static_cast<int>(skill.flatAdd + (scaleStatValue * skill.coeff));
     rawDamage = std::max(1, rawDamage);
 
     // Разброс урона ±N%: каждый удар не должен быть детерминированным числом
-    const float variance = cfg("combat.damage_variance", 0.12f);
+    const float variance = cfg(keys_.damageVariance, 0.12f);
     float factor = 1.0f + (dis_(gen_) * 2.0f - 1.0f) * variance; // [1-v, 1+v]
     return std::max(1, static_cast<int>(rawDamage * factor));
 }
@@ -255,20 +260,20 @@ CombatCalculator::calculateBaseDamage(
     const SkillStruct &skill,
     const std::vector<MobAttributeStruct> &attackerAttributes)
 {
-    int scaleStatValue = getAttributeValue(attackerAttributes, skill.scaleStat);
+    int scaleStatValue = getAttributeValue(attackerAttributes, scaleStatSymbol(skill));
     int rawDamage = static_cast<int>(skill.flatAdd + (scaleStatValue * skill.coeff));
     rawDamage = std::max(1, rawDamage);
 
-    const float variance = cfg("combat.damage_variance", 0.12f);
+    const float variance = cfg(keys_.damageVariance, 0.12f);
     float factor = 1.0f + (dis_(gen_) * 2.0f - 1.0f) * variance;
     return std::max(1, static_cast<int>(rawDamage * factor));
 }
 
 bool
-CombatCalculator::rollCriticalHit(const std::vector<CharacterAttributeStruct> &attackerAttributes)
+CombatCalculator::rollCriticalHit(const CharacterStatSheet &attackerStats)
 {
-    int critChance = getAttributeValue(attackerAttributes, "crit_chance");
-    const float cap = cfg("combat.crit_chance_cap", 75.0f);
+    int critChance = attackerStats.withEffects(StatId::CRIT_CHANCE);
+    const float cap = cfg(keys_.critChanceCap, 75.0f);
     float effective = std::min(static_cast<float>(critChance), cap);
     return dis_(gen_) < (effective / 100.0f);
 }
@@ -276,33 +281,33 @@ CombatCalculator::rollCriticalHit(const std::vector<CharacterAttributeStruct> &a
 bool
 CombatCalculator::rollCriticalHit(const std::vector<MobAttributeStruct> &attackerAttributes)
 {
-    int critChance = getAttributeValue(attackerAttributes, "crit_chance");
-    const float cap = cfg("combat.crit_chance_cap", 75.0f);
+    int critChance = getAttributeValue(attackerAttributes, statSymbol(StatId::CRIT_CHANCE));
+    const float cap = cfg(keys_.critChanceCap, 75.0f);
     float effective = std::min(static_cast<float>(critChance), cap);
     return dis_(gen_) < (effective / 100.0f);
 }
 
 bool
-CombatCalculator::rollBlock(const std::vector<CharacterAttributeStruct> &targetAttributes)
+CombatCalculator::rollBlock(const CharacterStatSheet &targetStats)
 {
-    int blockChance = getAttributeValue(targetAttributes, "block_chance");
-    const float cap = cfg("combat.block_chance_cap", 75.0f);
+    int blockChance = targetStats.withEffects(StatId::BLOCK_CHANCE);
+    const float cap = cfg(keys_.blockChanceCap, 75.0f);
     float effective = std::min(static_cast<float>(blockChance), cap);
     return dis_(gen_) < (effective / 100.0f);
 }
 
 bool
 CombatCalculator::rollMiss(
-    const std::vector<CharacterAttributeStruct> &attackerAttributes,
-    const std::vector<CharacterAttributeStruct> &targetAttributes,
+    const CharacterStatSheet &attackerStats,
+    const CharacterStatSheet &targetStats,
     float hitModifier)
 {
-    int accuracy = getAttributeValue(attackerAttributes, "accuracy");
-    int evasion = getAttributeValue(targetAttributes, "evasion");
+    int accuracy = attackerStats.withEffects(StatId::ACCURACY);
+    int evasion = targetStats.withEffects(StatId::EVASION);
 
-    const float baseHit = cfg("combat.base_hit_chance", 0.95f);
-    const float minHit = cfg("combat.hit_chance_min", 0.05f);
-    const float maxHit = cfg("combat.hit_chance_max", 0.95f);
+    const float baseHit = cfg(keys_.baseHitChance, 0.95f);
+    const float minHit = cfg(keys_.hitChanceMin, 0.05f);
+    const float maxHit = cfg(keys_.hitChanceMax, 0.95f);
 
     float hitChance = baseHit + (accuracy - evasion) * 0.01f + hitModifier;
     hitChance = std::clamp(hitChance, minHit, maxHit);
@@ -313,15 +318,15 @@ CombatCalculator::rollMiss(
 bool
 CombatCalculator::rollMiss(
     const std::vector<MobAttributeStruct> &attackerAttributes,
-    const std::vector<CharacterAttributeStruct> &targetAttributes,
+    const CharacterStatSheet &targetStats,
     float hitModifier)
 {
-    int accuracy = getAttributeValue(attackerAttributes, "accuracy");
-    int evasion = getAttributeValue(targetAttributes, "evasion");
+    int accuracy = getAttributeValue(attackerAttributes, statSymbol(StatId::ACCURACY));
+    int evasion = targetStats.withEffects(StatId::EVASION);
 
-    const float baseHit = cfg("combat.base_hit_chance", 0.95f);
-    const float minHit = cfg("combat.hit_chance_min", 0.05f);
-    const float maxHit = cfg("combat.hit_chance_max", 0.95f);
+    const float baseHit = cfg(keys_.baseHitChance, 0.95f);
+    const float minHit = cfg(keys_.hitChanceMin, 0.05f);
+    const float maxHit = cfg(keys_.hitChanceMax, 0.95f);
 
     float hitChance = baseHit + (accuracy - evasion) * 0.01f + hitModifier;
     hitChance = std::clamp(hitChance, minHit, maxHit);
@@ -330,11 +335,11 @@ CombatCalculator::rollMiss(
 }
 
 int
-CombatCalculator::getAttributeValue(const std::vector<CharacterAttributeStruct> &attributes, const std::string &slug)
+CombatCalculator::getAttributeValue(const std::vector<CharacterAttributeStruct> &attributes, SymbolId slugId)
 {
     for (const auto &attr : attributes)
     {
-        if (attr.slug == slug)
+        if (attr.slugId == slugId)
         {
             return attr.value;
         }
@@ -343,11 +348,11 @@ CombatCalculator::getAttributeValue(const std::vector<CharacterAttributeStruct>
 }
 
 int
-CombatCalculator::getAttributeValue(const std::vector<MobAttributeStruct> &attributes, const std::string &slug)
+CombatCalculator::getAttributeValue(const std::vector<MobAttributeStruct> &attributes, SymbolId slugId)
 {
     for (const auto &attr : attributes)
     {
-        if (attr.slug == slug)
+        if (attr.slugId == slugId)
         {
             return attr.value;
         }
@@ -360,8 +365,8 @@ CombatCalculator::applyDefense(int damage, int defenseValue, const std::string &
 {
     // Формула убывающей доходности: reduction = armor / (armor + K * targetLevel)
     // K и cap читаются из GameConfigService (если недоступен — используются хардкодные значения).
-    const float K = cfg("combat.defense_formula_k", 7.5f);
-    const float cap = cfg("combat.defense_cap", 0.85f);
+    const float K = cfg(keys_.defenseFormulaK, 7.5f);
+    const float cap = cfg(keys_.defenseCap, 0.85f);
 
     const int effectiveLevel = std::max(1, targetLevel);
     float damageReduction = static_cast<float>(defenseValue) /
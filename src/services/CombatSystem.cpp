@@ -257,7 +257,7 @@ CombatSystem::initiateSkillUsage(int casterId, const std::string &skillSlug, int
         // the cooldown is not re-checked (it would look "on cooldown" and fail).
         {
             bool onGCD = false;
-            if (!skillSystem_->trySetCooldown(casterId, skillSlug, skill.cooldownMs, skill.gcdMs, &onGCD))
+            if (!skillSystem_->trySetCooldown(casterId, skillSymbol(skill), skill.cooldownMs, skill.gcdMs, &onGCD))
             {
                 if (onGCD)
                 {
@@ -338,25 +338,13 @@ CombatSystem::initiateSkillUsage(int casterId, const std::string &skillSlug, int
                 auto &gameCfg = gameServices_->getGameConfigService();
                 if (skill.castMs > 0)
                 {
-                    int castSpd = 0;
-                    for (const auto &a : casterData.attributes)
-                        if (a.slug == "cast_speed")
-                        {
-                            castSpd = a.value;
-                            break;
-                        }
+                    const int castSpd = casterData.statSheet.base[static_cast<std::size_t>(StatId::CAST_SPEED)];
                     float divisor = gameCfg.getFloat("combat.cast_speed_base_divisor", 100.0f);
                     speedFactor = 1.0f / (1.0f + static_cast<float>(castSpd) / divisor);
                 }
                 else
                 {
-                    int atkSpd = 0;
-                    for (const auto &a : casterData.attributes)
-                        if (a.slug == "attack_speed")
-                        {
-                            atkSpd = a.value;
-                            break;
-                        }
+                    const int atkSpd = casterData.statSheet.base[static_cast<std::size_t>(StatId::ATTACK_SPEED)];
                     float divisor = gameCfg.getFloat("combat.attack_speed_base_divisor", 100.0f);
                     speedFactor = 1.0f / (1.0f + static_cast<float>(atkSpd) / divisor);
                 }
@@ -385,11 +373,15 @@ CombatSystem::initiateSkillUsage(int casterId, const std::string &skillSlug, int
         int effectiveSwingMs = static_cast<int>(skill.swingMs * speedFactor);
         action->endTime = action->startTime + std::chrono::milliseconds(effectiveCastMs - effectiveSwingMs);
 
-        // Сохраняем ongoing action
+        // Сохраняем ongoing action; каст с задержкой получает дедлайн и таймер
         {
             std::lock_guard<std::mutex> lock(actionsMutex_);
             ongoingActions_[casterId] = action;
+            if (action->state == CombatActionState::CASTING)
+                castDeadlines_.push({action->endTime, casterId});
         }
+        if (action->state == CombatActionState::CASTING && castTimerCallback_)
+            castTimerCallback_(action->endTime);
 
         result.success = true;
         result.castTime = action->castTime;
@@ -726,6 +718,7 @@ CombatSystem::executeSkillUsage(int casterId, const std::string &skillSlug, int
         }
 
         // НЕ удаляем ongoing action здесь - это делается в updateOngoingActions()
+        // (касты) или clearOngoingAction() (мгновенные скилы)
         // ongoingActions_.erase(casterId);
 
         // Mark caster as in-combat so their regen is suppressed while fighting
@@ -819,35 +812,39 @@ CombatSystem::clearOngoingAction(int casterId)
     ongoingActions_.erase(casterId);
 }
 
+void
+CombatSystem::setCastTimerCallback(std::function<void(std::chrono::steady_clock::time_point)> callback)
+{
+    castTimerCallback_ = std::move(callback);
+}
+
 std::vector<SkillExecutionResult>
 CombatSystem::updateOngoingActions()
 {
     auto now = std::chrono::steady_clock::now();
 
-    // Snapshot actions that are ready to execute, erase them under lock,
-    // then execute outside the lock to avoid holding it during heavy work.
+    // Pop due deadlines, erase their actions under lock, then execute outside
+    // the lock to avoid holding it during heavy work. Casters with nothing due
+    // are never visited.
     std::vector<std::tuple<int, std::string, int, CombatTargetType, std::string, bool>> toExecute;
     {
         std::lock_guard<std::mutex> lock(actionsMutex_);
-        for (auto it = ongoingActions_.begin(); it != ongoingActions_.end();)
+        while (!castDeadlines_.empty() && castDeadlines_.top().first <= now)
         {
+            const auto [endTime, casterId] = castDeadlines_.top();
+            castDeadlines_.pop();
+
+            // Interrupted, already executed, or replaced by a newer cast: stale deadline.
+            auto it = ongoingActions_.find(casterId);
+            if (it == ongoingActions_.end())
+                continue;
             auto &action = it->second;
-            if (action->state == CombatActionState::CASTING && now >= action->endTime)
-            {
-                action->state = CombatActionState::EXECUTING;
-                toExecute.emplace_back(action->casterId, action->skillSlug, action->targetId, action->targetType, action->actionName, action->cooldownPreset);
-                it = ongoingActions_.erase(it);
-            }
-            else if (action->state == CombatActionState::EXECUTING)
-            {
-                // Instant skills (castMs=0) are executed synchronously in dispatchSkillAction
-                // and leave a stale EXECUTING entry. Clean it up here.
-                it = ongoingActions_.erase(it);
-            }
-            else
-            {
-                ++it;
-            }
+            if (action->state != CombatActionState::CASTING || action->endTime != endTime)
+                continue;
+
+            action->state = CombatActionState::EXECUTING;
+            toExecute.emplace_back(action->casterId, action->skillSlug, action->targetId, action->targetType, action->actionName, action->cooldownPreset);
+            ongoingActions_.erase(it);
         }
     }
 
@@ -964,16 +961,23 @@ CombatSystem::executeAoESkillUsage(int casterId, const std::string &skillSlug, b
                                           .count();
         batchResult.finalCasterMana = (casterData.characterId != 0) ? casterData.characterCurrentMana : 0;
 
+        // Caster stats (base + active effects) compiled once for every target below
+        CharacterStatSheet casterScratch;
+        const CharacterStatSheet &casterStats = statSheetFor(casterData, casterScratch, batchResult.serverTimestamp / 1000);
+
         // ---- Mob targets ----
+        // Nearest first, so maxHits caps the farthest targets rather than arbitrary ones.
         auto mobs = gameServices_->getMobInstanceManager().getMobsInRange(cx, cy, radius);
+        std::sort(mobs.begin(), mobs.end(), [](const MobRangeHit &a, const MobRangeHit &b)
+            { return a.distanceSq < b.distanceSq; });
         for (const auto &mob : mobs)
         {
             if (hitCount >= maxHits)
                 break;
 
             // Simplified player→mob path (mirror of SkillSystem::useSkill MOB branch)
-            int dmg = calc->calculateBaseDamage(skill, casterData.attributes);
-            bool isCrit = calc->rollCriticalHit(casterData.attributes);
+            int dmg = calc->calculateBaseDamage(skill, casterStats);
+            bool isCrit = calc->rollCriticalHit(casterStats);
             if (isCrit)
                 dmg = static_cast<int>(dmg * 2.0f);
             dmg = std::max(0, dmg);
@@ -1924,7 +1928,7 @@ CombatSystem::processAIAttack(int mobId, int targetPlayerId, const std::string &
 }
 
 void
-CombatSystem::setSaveDurabilityCallback(std::function<void(const std::string &)> callback)
+CombatSystem::setSaveDurabilityCallback(PersistWriteCallback callback)
 {
     saveDurabilityCallback_ = std::move(callback);
 }
@@ -1999,7 +2003,7 @@ CombatSystem::checkAndTriggerDurabilityWarning(int characterId, int oldDur, int
 }
 
 void
-CombatSystem::setSaveItemKillCountCallback(std::function<void(const std::string &)> callback)
+CombatSystem::setSaveItemKillCountCallback(PersistWriteCallback callback)
 {
     saveItemKillCountCallback_ = std::move(callback);
 }
@@ -2016,7 +2020,7 @@ CombatSystem::saveItemKillCountChange(int characterId, int inventoryItemId, int
     packet["body"]["characterId"] = characterId;
     packet["body"]["inventoryItemId"] = inventoryItemId;
     packet["body"]["killCount"] = killCount;
-    saveItemKillCountCallback_(packet.dump() + "\n");
+    saveItemKillCountCallback_(characterId, "itemKillCount:" + std::to_string(inventoryItemId), packet.dump() + "\n");
 }
 
 void
@@ -2031,7 +2035,7 @@ CombatSystem::saveDurabilityChange(int characterId, int inventoryItemId, int dur
     packet["body"]["characterId"] = characterId;
     packet["body"]["inventoryItemId"] = inventoryItemId;
     packet["body"]["durabilityCurrent"] = durabilityCurrent;
-    saveDurabilityCallback_(packet.dump() + "\n");
+    saveDurabilityCallback_(characterId, "durability:" + std::to_string(inventoryItemId), packet.dump() + "\n");
 }
 
 void
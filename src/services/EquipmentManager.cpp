@@ -51,6 +51,31 @@ EquipmentManager::slotFromInventoryItem(
     return slot;
 }
 
+std::vector<CharacterAttributeStruct>
+EquipmentManager::collectEquipBonusesLocked(const CharacterEquipmentStruct &equip) const
+{
+    std::vector<CharacterAttributeStruct> bonuses;
+    for (const auto &[slotSlug, slot] : equip.slots)
+    {
+        if (slot.inventoryItemId == 0)
+            continue;
+        const ItemDataStruct item = itemManager_.getItemById(slot.itemId);
+        for (const auto &attr : item.attributes)
+        {
+            if (attr.applyOn != ItemAttributeApplyOn::EQUIP)
+                continue;
+            CharacterAttributeStruct bonus;
+            bonus.character_id = equip.characterId;
+            bonus.name = attr.name;
+            bonus.slug = attr.slug;
+            bonus.slugId = attr.slugId;
+            bonus.value = attr.value;
+            bonuses.push_back(std::move(bonus));
+        }
+    }
+    return bonuses;
+}
+
 // ─── Public API ───────────────────────────────────────────────────────────────
 
 void
@@ -93,6 +118,12 @@ EquipmentManager::buildFromInventory(int characterId)
     log_->info("[EquipmentManager] Built equipment for char=" + std::to_string(characterId) +
                " slots=" + std::to_string(equip.slots.size()) +
                " 2h=" + std::to_string(equip.twoHandedActive));
+
+    // Publish the bonus layer outside our lock (CharacterManager has its own mutex).
+    auto bonuses = collectEquipBonusesLocked(equip);
+    version_.fetch_add(1, std::memory_order_relaxed);
+    lock.unlock();
+    characterManager_.setCharacterEquipmentBonuses(characterId, std::move(bonuses));
 }
 
 EquipmentManager::EquipResult
@@ -221,6 +252,11 @@ EquipmentManager::equipItem(int characterId, int inventoryItemId)
     result.equipSlotSlug = targetSlug;
     log_->info("[EquipmentManager] equipItem: char=" + std::to_string(characterId) +
                " item=" + std::to_string(inventoryItemId) + " slot=" + targetSlug);
+
+    auto bonuses = collectEquipBonusesLocked(equip);
+    version_.fetch_add(1, std::memory_order_relaxed);
+    lock.unlock();
+    characterManager_.setCharacterEquipmentBonuses(characterId, std::move(bonuses));
     return result;
 }
 
@@ -257,6 +293,11 @@ EquipmentManager::unequipItem(int characterId, const std::string &slotSlug)
 
     log_->info("[EquipmentManager] unequipItem: char=" + std::to_string(characterId) +
                " slot=" + slotSlug + " item=" + std::to_string(result.inventoryItemId));
+
+    auto bonuses = collectEquipBonusesLocked(equip);
+    version_.fetch_add(1, std::memory_order_relaxed);
+    lock.unlock();
+    characterManager_.setCharacterEquipmentBonuses(characterId, std::move(bonuses));
     return result;
 }
 
@@ -331,6 +372,7 @@ EquipmentManager::clearCharacter(int characterId)
 {
     std::unique_lock lock(mutex_);
     equipment_.erase(characterId);
+    version_.fetch_add(1, std::memory_order_relaxed);
     log_->info("[EquipmentManager] Cleared equipment for char=" + std::to_string(characterId));
 }
 
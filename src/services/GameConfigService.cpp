@@ -3,88 +3,196 @@
 #include <stdexcept>
 #include <spdlog/logger.h>
 
+namespace
+{
+GameConfigValue
+parseValue(const std::string &key, const std::string &raw)
+{
+    GameConfigValue value;
+    value.key = key;
+    value.raw = raw;
+    try
+    {
+        value.floatValue = std::stof(raw);
+        value.hasFloat = true;
+    }
+    catch (...)
+    {
+    }
+    try
+    {
+        value.intValue = std::stoi(raw);
+        value.hasInt = true;
+    }
+    catch (...)
+    {
+    }
+    if (raw == "true" || raw == "1" || raw == "yes")
+    {
+        value.boolValue = true;
+        value.hasBool = true;
+    }
+    else if (raw == "false" || raw == "0" || raw == "no")
+    {
+        value.boolValue = false;
+        value.hasBool = true;
+    }
+    return value;
+}
+} // namespace
+
+const GameConfigValue *
+GameConfigSnapshot::find(const std::string &key) const
+{
+    auto it = entries_.find(key);
+    return it != entries_.end() ? &it->second : nullptr;
+}
+
 GameConfigService::GameConfigService(Logger &logger)
     : logger_(logger)
 {
     log_ = logger.getSystem("config");
+    std::lock_guard lock(writeMutex_);
+    publishLocked();
 }
 
 void
 GameConfigService::setConfig(const std::unordered_map<std::string, std::string> &config)
 {
-    std::unique_lock lock(mutex_);
-    config_ = config;
-    logger_.log("GameConfigService: received " + std::to_string(config_.size()) + " config entries.");
+    std::vector<ChangeListener> listeners;
+    {
+        std::lock_guard lock(writeMutex_);
+        raw_ = config;
+        publishLocked();
+        listeners = listeners_;
+    }
+    logger_.log("GameConfigService: received " + std::to_string(config.size()) + " config entries.");
+
+    for (const auto &listener : listeners)
+        listener(*this);
+}
+
+GameConfigKey
+GameConfigService::key(const std::string &name)
+{
+    std::lock_guard lock(writeMutex_);
+    auto it = keySlots_.find(name);
+    if (it != keySlots_.end())
+        return GameConfigKey{it->second};
+
+    const auto slot = static_cast<uint32_t>(keyNames_.size());
+    keyNames_.push_back(name);
+    keySlots_.emplace(name, slot);
+    // The published snapshot has no slot for the new key yet
+    if (!raw_.empty())
+        publishLocked();
+    return GameConfigKey{slot};
+}
+
+void
+GameConfigService::subscribe(ChangeListener listener)
+{
+    std::lock_guard lock(writeMutex_);
+    listeners_.push_back(std::move(listener));
+}
+
+void
+GameConfigService::publishLocked()
+{
+    auto snapshot = std::make_unique<GameConfigSnapshot>();
+    snapshot->entries_.reserve(raw_.size());
+    for (const auto &[key, raw] : raw_)
+        snapshot->entries_.emplace(key, parseValue(key, raw));
+
+    snapshot->slots_.reserve(keyNames_.size());
+    for (const auto &name : keyNames_)
+        snapshot->slots_.push_back(snapshot->find(name));
+
+    current_.store(snapshot.get(), std::memory_order_release);
+    snapshots_.push_back(std::move(snapshot));
 }
 
 float
-GameConfigService::getFloat(const std::string &key, float defaultValue) const
+GameConfigService::readFloat(const GameConfigValue *value, float defaultValue) const
 {
-    std::shared_lock lock(mutex_);
-    auto it = config_.find(key);
-    if (it == config_.end())
+    if (!value)
         return defaultValue;
-    try
-    {
-        return std::stof(it->second);
-    }
-    catch (...)
-    {
-        log_->error("GameConfigService::getFloat: invalid value for key '" + key +
-                         "' = '" + it->second + "', using default " + std::to_string(defaultValue));
-        return defaultValue;
-    }
+    if (value->hasFloat)
+        return value->floatValue;
+    log_->error("GameConfigService::getFloat: invalid value for key '" + value->key +
+                "' = '" + value->raw + "', using default " + std::to_string(defaultValue));
+    return defaultValue;
 }
 
 int
-GameConfigService::getInt(const std::string &key, int defaultValue) const
+GameConfigService::readInt(const GameConfigValue *value, int defaultValue) const
 {
-    std::shared_lock lock(mutex_);
-    auto it = config_.find(key);
-    if (it == config_.end())
-        return defaultValue;
-    try
-    {
-        return std::stoi(it->second);
-    }
-    catch (...)
-    {
-        log_->error("GameConfigService::getInt: invalid value for key '" + key +
-                         "' = '" + it->second + "', using default " + std::to_string(defaultValue));
+    if (!value)
         return defaultValue;
-    }
+    if (value->hasInt)
+        return value->intValue;
+    log_->error("GameConfigService::getInt: invalid value for key '" + value->key +
+                "' = '" + value->raw + "', using default " + std::to_string(defaultValue));
+    return defaultValue;
 }
 
 bool
-GameConfigService::getBool(const std::string &key, bool defaultValue) const
+GameConfigService::readBool(const GameConfigValue *value, bool defaultValue) const
 {
-    std::shared_lock lock(mutex_);
-    auto it = config_.find(key);
-    if (it == config_.end())
+    if (!value)
         return defaultValue;
-    const std::string &v = it->second;
-    if (v == "true" || v == "1" || v == "yes")
-        return true;
-    if (v == "false" || v == "0" || v == "no")
-        return false;
-    log_->error("GameConfigService::getBool: invalid value for key '" + key +
-                     "' = '" + v + "', using default");
+    if (value->hasBool)
+        return value->boolValue;
+    log_->error("GameConfigService::getBool: invalid value for key '" + value->key +
+                "' = '" + value->raw + "', using default");
     return defaultValue;
 }
 
+float
+GameConfigService::getFloat(const std::string &key, float defaultValue) const
+{
+    return readFloat(snapshot().find(key), defaultValue);
+}
+
+int
+GameConfigService::getInt(const std::string &key, int defaultValue) const
+{
+    return readInt(snapshot().find(key), defaultValue);
+}
+
+bool
+GameConfigService::getBool(const std::string &key, bool defaultValue) const
+{
+    return readBool(snapshot().find(key), defaultValue);
+}
+
 std::string
 GameConfigService::getString(const std::string &key, const std::string &defaultValue) const
 {
-    std::shared_lock lock(mutex_);
-    auto it = config_.find(key);
-    if (it == config_.end())
-        return defaultValue;
-    return it->second;
+    const GameConfigValue *value = snapshot().find(key);
+    return value ? value->raw : defaultValue;
+}
+
+float
+GameConfigService::getFloat(GameConfigKey key, float defaultValue) const
+{
+    return readFloat(snapshot().at(key), defaultValue);
+}
+
+int
+GameConfigService::getInt(GameConfigKey key, int defaultValue) const
+{
+    return readInt(snapshot().at(key), defaultValue);
+}
+
+bool
+GameConfigService::getBool(GameConfigKey key, bool defaultValue) const
+{
+    return readBool(snapshot().at(key), defaultValue);
 }
 
 bool
 GameConfigService::isLoaded() const
 {
-    std::shared_lock lock(mutex_);
-    return !config_.empty();
+    return !snapshot().empty();
 }
@@ -0,0 +1,355 @@
+#include "services/InterestManager.hpp"
+#include "services/GameConfigService.hpp"
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <spdlog/logger.h>
+
+namespace
+{
+constexpr float DEFAULT_VIEW_RADIUS = 10000.0f;
+constexpr float DEFAULT_HYSTERESIS = 1500.0f;
+
+int64_t
+packCell(int32_t cx, int32_t cy)
+{
+    return (static_cast<int64_t>(cx) << 32) | static_cast<uint32_t>(cy);
+}
+
+void
+eraseId(std::vector<int> &ids, int id)
+{
+    auto it = std::find(ids.begin(), ids.end(), id);
+    if (it != ids.end())
+    {
+        *it = ids.back();
+        ids.pop_back();
+    }
+}
+} // namespace
+
+InterestManager::InterestManager(Logger &logger)
+    : logger_(logger)
+{
+    log_ = logger.getSystem("interest");
+}
+
+void
+InterestManager::setGameConfigService(GameConfigService *gameConfigService)
+{
+    gameConfigService_ = gameConfigService;
+    if (gameConfigService_)
+    {
+        viewRadiusKey_ = gameConfigService_->key("interest.view_radius");
+        hysteresisKey_ = gameConfigService_->key("interest.hysteresis");
+
+        // Filtering switched off: drop every view list so a later re-enable starts
+        // clean instead of trusting links that stopped being maintained.
+        gameConfigService_->subscribe([this](const GameConfigService &)
+            {
+                if (isEnabled())
+                    return;
+                std::unique_lock<std::shared_mutex> lock(mutex_);
+                clearViewsLocked(); });
+    }
+}
+
+void
+InterestManager::clearViewsLocked()
+{
+    size_t links = 0;
+    for (auto &[id, entry] : entries_)
+    {
+        links += entry.visible.size() + entry.visibleMobs.size();
+        entry.visible.clear();
+        entry.visibleMobs.clear();
+    }
+    if (links > 0)
+        log_->info("Interest filtering disabled: cleared {} view link(s) for {} player(s)", links, entries_.size());
+}
+
+bool
+InterestManager::isEnabled() const
+{
+    float viewRadius = 0.0f;
+    float leaveRadius = 0.0f;
+    return readRadii(viewRadius, leaveRadius);
+}
+
+bool
+InterestManager::readRadii(float &viewRadius, float &leaveRadius) const
+{
+    viewRadius = DEFAULT_VIEW_RADIUS;
+    float hysteresis = DEFAULT_HYSTERESIS;
+    if (gameConfigService_)
+    {
+        viewRadius = gameConfigService_->getFloat(viewRadiusKey_, DEFAULT_VIEW_RADIUS);
+        hysteresis = gameConfigService_->getFloat(hysteresisKey_, DEFAULT_HYSTERESIS);
+    }
+    leaveRadius = viewRadius + std::max(0.0f, hysteresis);
+    return viewRadius > 0.0f;
+}
+
+int64_t
+InterestManager::cellKeyFor(float x, float y) const
+{
+    return packCell(static_cast<int32_t>(std::floor(x / cellSize_)),
+        static_cast<int32_t>(std::floor(y / cellSize_)));
+}
+
+void
+InterestManager::rebuildGridLocked(float cellSize)
+{
+    cellSize_ = cellSize;
+    cells_.clear();
+    for (auto &[id, entry] : entries_)
+    {
+        entry.cellKey = cellKeyFor(entry.x, entry.y);
+        cells_[entry.cellKey].push_back(id);
+    }
+}
+
+void
+InterestManager::unlinkLocked(int characterId, int peerId)
+{
+    auto it = entries_.find(characterId);
+    if (it != entries_.end())
+        eraseId(it->second.visible, peerId);
+}
+
+InterestDelta
+InterestManager::updateCharacter(int characterId, int clientId, const PositionStruct &position)
+{
+    InterestDelta delta;
+    if (characterId == 0)
+        return delta;
+
+    float viewRadius = 0.0f;
+    float leaveRadius = 0.0f;
+    if (!readRadii(viewRadius, leaveRadius))
+        return delta;
+
+    const float enterSq = viewRadius * viewRadius;
+    const float leaveSq = leaveRadius * leaveRadius;
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+
+    // Cell size tracks the leave radius so the 3x3 neighbourhood always covers
+    // every candidate; a runtime config reload re-buckets everyone once.
+    if (cellSize_ != leaveRadius)
+    {
+        rebuildGridLocked(leaveRadius);
+        log_->info("Interest grid rebuilt: viewRadius={} leaveRadius={} players={}", viewRadius, leaveRadius, entries_.size());
+    }
+
+    auto [selfIt, inserted] = entries_.try_emplace(characterId);
+    Entry &self = selfIt->second;
+    self.clientId = clientId;
+    self.x = position.positionX;
+    self.y = position.positionY;
+
+    const int64_t newKey = cellKeyFor(self.x, self.y);
+    if (inserted || newKey != self.cellKey)
+    {
+        if (!inserted)
+        {
+            auto oldCell = cells_.find(self.cellKey);
+            if (oldCell != cells_.end())
+            {
+                eraseId(oldCell->second, characterId);
+                if (oldCell->second.empty())
+                    cells_.erase(oldCell);
+            }
+        }
+        cells_[newKey].push_back(characterId);
+        self.cellKey = newKey;
+    }
+
+    // 1. Leave: peers in view that are now past the leave radius (or gone).
+    for (size_t i = 0; i < self.visible.size();)
+    {
+        const int peerId = self.visible[i];
+        auto peerIt = entries_.find(peerId);
+        if (peerIt != entries_.end())
+        {
+            const float dx = peerIt->second.x - self.x;
+            const float dy = peerIt->second.y - self.y;
+            if (dx * dx + dy * dy <= leaveSq)
+            {
+                ++i;
+                continue;
+            }
+            eraseId(peerIt->second.visible, characterId);
+            delta.left.push_back({peerId, peerIt->second.clientId});
+        }
+        self.visible[i] = self.visible.back();
+        self.visible.pop_back();
+    }
+
+    // 2. Enter: scan the 3x3 cell neighbourhood for peers inside the view radius.
+    const int32_t cx = static_cast<int32_t>(std::floor(self.x / cellSize_));
+    const int32_t cy = static_cast<int32_t>(std::floor(self.y / cellSize_));
+    for (int32_t ox = -1; ox <= 1; ++ox)
+    {
+        for (int32_t oy = -1; oy <= 1; ++oy)
+        {
+            auto cellIt = cells_.find(packCell(cx + ox, cy + oy));
+            if (cellIt == cells_.end())
+                continue;
+
+            for (int peerId : cellIt->second)
+            {
+                if (peerId == characterId)
+                    continue;
+                Entry &peer = entries_.at(peerId);
+                const float dx = peer.x - self.x;
+                const float dy = peer.y - self.y;
+                if (dx * dx + dy * dy > enterSq)
+                    continue;
+                if (std::find(self.visible.begin(), self.visible.end(), peerId) != self.visible.end())
+                    continue;
+
+                self.visible.push_back(peerId);
+                peer.visible.push_back(characterId);
+                delta.entered.push_back({peerId, peer.clientId});
+            }
+        }
+    }
+
+    if (!delta.empty())
+        delta.sequence = nextSequence_++;
+    return delta;
+}
+
+void
+InterestManager::deliverInOrder(uint64_t sequence, const std::function<void()> &send)
+{
+    std::unique_lock<std::mutex> lock(deliveryMutex_);
+    deliveryCv_.wait(lock, [&]
+        { return nextDelivery_ == sequence; });
+
+    // Release the ticket even if send() throws, or every later delta would wait forever
+    struct Release
+    {
+        InterestManager &self;
+        ~Release()
+        {
+            ++self.nextDelivery_;
+            self.deliveryCv_.notify_all();
+        }
+    } release{*this};
+    send();
+}
+
+void
+InterestManager::removeCharacter(int characterId)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto it = entries_.find(characterId);
+    if (it == entries_.end())
+        return;
+
+    for (int peerId : it->second.visible)
+        unlinkLocked(peerId, characterId);
+
+    auto cellIt = cells_.find(it->second.cellKey);
+    if (cellIt != cells_.end())
+    {
+        eraseId(cellIt->second, characterId);
+        if (cellIt->second.empty())
+            cells_.erase(cellIt);
+    }
+
+    entries_.erase(it);
+}
+
+std::vector<int>
+InterestManager::getRecipientClientIds(int characterId, int excludeClientId) const
+{
+    std::vector<int> result;
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = entries_.find(characterId);
+    if (it == entries_.end())
+        return result;
+
+    const Entry &self = it->second;
+    result.reserve(self.visible.size() + 1);
+    if (self.clientId != 0 && self.clientId != excludeClientId)
+        result.push_back(self.clientId);
+
+    for (int peerId : self.visible)
+    {
+        auto peerIt = entries_.find(peerId);
+        if (peerIt != entries_.end() && peerIt->second.clientId != 0 && peerIt->second.clientId != excludeClientId)
+            result.push_back(peerIt->second.clientId);
+    }
+    return result;
+}
+
+std::vector<ClientMobView>
+InterestManager::updateMobVisibility(const std::vector<MobViewPoint> &mobs)
+{
+    std::vector<ClientMobView> result;
+    float viewRadius = 0.0f;
+    float leaveRadius = 0.0f;
+    if (!readRadii(viewRadius, leaveRadius))
+        return result;
+
+    const float enterSq = viewRadius * viewRadius;
+    const float leaveSq = leaveRadius * leaveRadius;
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    if (cellSize_ != leaveRadius)
+        rebuildGridLocked(leaveRadius);
+
+    // Bucket this pass's mobs with the player cell size: everything within the
+    // leave radius of a player lies in its 3x3 neighbourhood.
+    std::unordered_map<int64_t, std::vector<uint32_t>> mobCells;
+    mobCells.reserve(mobs.size() / 4 + 1);
+    for (uint32_t i = 0; i < mobs.size(); ++i)
+        mobCells[cellKeyFor(mobs[i].x, mobs[i].y)].push_back(i);
+
+    result.reserve(entries_.size());
+    for (auto &[characterId, entry] : entries_)
+    {
+        std::vector<int> next;
+        const int32_t cx = static_cast<int32_t>(std::floor(entry.x / cellSize_));
+        const int32_t cy = static_cast<int32_t>(std::floor(entry.y / cellSize_));
+        for (int32_t ox = -1; ox <= 1; ++ox)
+        {
+            for (int32_t oy = -1; oy <= 1; ++oy)
+            {
+                auto cellIt = mobCells.find(packCell(cx + ox, cy + oy));
+                if (cellIt == mobCells.end())
+                    continue;
+
+                for (uint32_t idx : cellIt->second)
+                {
+                    const MobViewPoint &mob = mobs[idx];
+                    const float dx = mob.x - entry.x;
+                    const float dy = mob.y - entry.y;
+                    const float distSq = dx * dx + dy * dy;
+                    if (distSq <= enterSq ||
+                        (distSq <= leaveSq && std::binary_search(entry.visibleMobs.begin(), entry.visibleMobs.end(), mob.uid)))
+                    {
+                        next.push_back(mob.uid);
+                    }
+                }
+            }
+        }
+        std::sort(next.begin(), next.end());
+
+        if (next.empty() && entry.visibleMobs.empty())
+            continue;
+
+        ClientMobView view;
+        view.clientId = entry.clientId;
+        std::set_difference(next.begin(), next.end(), entry.visibleMobs.begin(), entry.visibleMobs.end(), std::back_inserter(view.enteredUids));
+        std::set_difference(entry.visibleMobs.begin(), entry.visibleMobs.end(), next.begin(), next.end(), std::back_inserter(view.leftUids));
+        entry.visibleMobs = next;
+        view.visibleUids = std::move(next);
+        result.push_back(std::move(view));
+    }
+
+    return result;
+}
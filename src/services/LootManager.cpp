@@ -201,6 +201,7 @@ LootManager::generateLootOnMobDeath(int mobId, int mobUID, const PositionStruct
                 {
                     std::unique_lock<std::shared_mutex> lock(droppedItemsMutex_);
                     droppedItems_[droppedItem.uid] = droppedItem;
+                    membershipVersion_.fetch_add(1, std::memory_order_relaxed);
                 }
 
                 droppedItems.push_back(droppedItem);
@@ -415,6 +416,7 @@ LootManager::pickupDroppedItem(int itemUID, int characterId, const PositionStruc
         if (it != droppedItems_.end())
         {
             droppedItems_.erase(it);
+            membershipVersion_.fetch_add(1, std::memory_order_relaxed);
 
             logger_.log("[LOOT] Character " + std::to_string(characterId) + " picked up " +
                         itemInfo.slug + " (UID: " + std::to_string(itemUID) + ") from distance " +
@@ -469,6 +471,7 @@ LootManager::cleanupOldDroppedItems(int maxAgeSeconds)
                 if (it->second.inventoryItemId > 0)
                     expiredInstanceIds.push_back(it->second.inventoryItemId);
                 it = droppedItems_.erase(it);
+                membershipVersion_.fetch_add(1, std::memory_order_relaxed);
             }
             else
             {
@@ -524,6 +527,7 @@ LootManager::dropItemByPlayer(int characterId, int inventoryItemId, int itemId,
     {
         std::unique_lock<std::shared_mutex> lock(droppedItemsMutex_);
         droppedItems_[drop.uid] = drop;
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
     }
 
     // If this item has an existing DB row, nullify its owner instead of deleting it.
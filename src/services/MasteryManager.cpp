@@ -310,7 +310,7 @@ MasteryManager::persist(int characterId,
             pkt["body"]["characterId"] = characterId;
             pkt["body"]["masterySlug"] = masterySlug;
             pkt["body"]["value"] = value;
-            saveCallback_(pkt.dump() + "\n");
+            saveCallback_(characterId, "mastery:" + std::to_string(characterId) + ":" + masterySlug, pkt.dump() + "\n");
         }
         catch (const std::exception &e)
         {
@@ -231,29 +231,12 @@ MobAIController::countMobsEngagingTarget(int targetPlayerId, int excludeUID, flo
     if (target.characterId == 0)
         return 0;
 
-    auto nearbyMobs = mobInstanceManager_->getMobsInRange(
+    // Other zones' mobs come from the pre-fork snapshot during a parallel tick
+    return mobMovementManager_->countMeleeSlotHolders(targetPlayerId,
+        excludeUID,
         target.characterPosition.positionX,
         target.characterPosition.positionY,
         range);
-
-    int count = 0;
-    for (const auto &nearMob : nearbyMobs)
-    {
-        if (nearMob.uid == excludeUID || nearMob.isDead)
-            continue;
-
-        auto md = mobMovementManager_->getMobMovementData(nearMob.uid);
-        if (md.targetPlayerId != targetPlayerId)
-            continue;
-
-        if (md.combatState == MobCombatState::PREPARING_ATTACK ||
-            md.combatState == MobCombatState::ATTACKING ||
-            md.combatState == MobCombatState::ATTACK_COOLDOWN)
-        {
-            ++count;
-        }
-    }
-    return count;
 }
 
 bool
@@ -296,7 +279,12 @@ MobAIController::executeMobAttack(const MobDataStruct &mob, int targetPlayerId,
 
     if (combatSystem_)
     {
-        combatSystem_->processAIAttack(mob.uid, targetPlayerId, usedSkillSlug);
+        // The target may also be fought by mobs of other zones ticking in
+        // parallel; damage is applied after the zone barrier, in zone order.
+        CombatSystem *combatSystem = combatSystem_;
+        const int mobUID = mob.uid;
+        mobMovementManager_->runCrossZoneAction([combatSystem, mobUID, targetPlayerId, usedSkillSlug]()
+            { combatSystem->processAIAttack(mobUID, targetPlayerId, usedSkillSlug); });
         logger_.log("[COMBAT] Mob " + std::to_string(mob.uid) + " attacking player " +
                     std::to_string(targetPlayerId) +
                     (usedSkillSlug.empty() ? "" : " with skill [" + usedSkillSlug + "]"));
@@ -384,26 +372,23 @@ MobAIController::handleMobAttacked(int mobUID, int attackerPlayerId, int damage)
             // pack-mates the mob could "see" get alerted.  The old hardcoded
             // 20.0f was far too small compared to aggroRange (~400 units).
             const float kSocialRadius = mob.aggroRange;
-            auto neighbors = mobInstanceManager_->getMobsInRange(
-                mob.position.positionX, mob.position.positionY, kSocialRadius);
+            // Collect pack-mates under the manager's lock, alert them after it is released.
+            std::vector<int> neighborUids;
+            mobInstanceManager_->forEachMobInRange(
+                mob.position.positionX, mob.position.positionY, kSocialRadius, [&](const MobDataStruct &neighbor, float)
+                {
+                    if (neighbor.uid != mobUID && neighbor.zoneId == mob.zoneId && neighbor.raceName == mob.raceName)
+                        neighborUids.push_back(neighbor.uid);
+                });
 
-            for (const auto &neighbor : neighbors)
+            for (int neighborUid : neighborUids)
             {
-                if (neighbor.uid == mobUID)
-                    continue;
-                if (neighbor.zoneId != mob.zoneId)
-                    continue;
-                if (neighbor.raceName != mob.raceName)
-                    continue;
-                if (neighbor.isDead)
-                    continue;
-
-                auto neighborMov = mobMovementManager_->getMobMovementData(neighbor.uid);
+                auto neighborMov = mobMovementManager_->getMobMovementData(neighborUid);
                 if (neighborMov.combatState != MobCombatState::PATROLLING)
                     continue;
 
                 // Alert neighbour with 0 damage — won't chain-propagate
-                handleMobAttacked(neighbor.uid, attackerPlayerId, 0);
+                handleMobAttacked(neighborUid, attackerPlayerId, 0);
             }
         }
     }
@@ -439,7 +424,7 @@ MobAIController::handlePlayerAggro(MobDataStruct &mob, const SpawnZoneStruct &zo
     // they still defend themselves when attacked via handleMobAttacked.
     if (mob.isAggressive && movementData.targetPlayerId == 0 && !movementData.isReturningToSpawn)
     {
-        auto nearbyPlayers = characterManager_->getCharactersInZone(
+        auto nearbyPlayers = characterManager_->getCharactersInRange(
             mob.position.positionX,
             mob.position.positionY,
             mob.aggroRange);
@@ -452,12 +437,10 @@ MobAIController::handlePlayerAggro(MobDataStruct &mob, const SpawnZoneStruct &zo
             int highestThreat = -1;
             int highestThreatId = 0;
 
+            // Hits are already alive-only and carry the squared 2D distance to the mob.
             for (const auto &player : nearbyPlayers)
             {
-                if (!isTargetAlive(player.characterId))
-                    continue;
-
-                float d = calculateDistance(mob.position, player.characterPosition);
+                float d = std::sqrt(player.distanceSq);
 
                 // Track closest as fallback
                 if (d < closestDistance)
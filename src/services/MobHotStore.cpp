@@ -0,0 +1,208 @@
+#include "services/MobHotStore.hpp"
+
+void
+MobHotStore::sync(const MobDataStruct &mob)
+{
+    auto it = slotByUid_.find(mob.uid);
+    uint32_t slot;
+    if (it == slotByUid_.end())
+    {
+        slot = static_cast<uint32_t>(uid_.size());
+        slotByUid_.emplace(mob.uid, slot);
+        uid_.push_back(mob.uid);
+        templateId_.push_back(0);
+        zoneId_.push_back(mob.zoneId);
+        posX_.push_back(0.0f);
+        posY_.push_back(0.0f);
+        posZ_.push_back(0.0f);
+        rotZ_.push_back(0.0f);
+        health_.push_back(0);
+        maxHealth_.push_back(0);
+        dead_.push_back(0);
+        dirX_.push_back(0.0f);
+        dirY_.push_back(0.0f);
+        speed_.push_back(0.0f);
+        combatState_.push_back(static_cast<uint8_t>(MobCombatState::PATROLLING));
+        stepTimestampMs_.push_back(0);
+        engaged_.push_back(0);
+        zoneListIndex_.push_back(0);
+        linkToZone(slot, mob.zoneId);
+    }
+    else
+    {
+        slot = it->second;
+        if (zoneId_[slot] != mob.zoneId)
+        {
+            unlinkFromZone(slot);
+            zoneId_[slot] = mob.zoneId;
+            linkToZone(slot, mob.zoneId);
+        }
+    }
+
+    templateId_[slot] = mob.id;
+    posX_[slot] = mob.position.positionX;
+    posY_[slot] = mob.position.positionY;
+    posZ_[slot] = mob.position.positionZ;
+    rotZ_[slot] = mob.position.rotationZ;
+    health_[slot] = mob.currentHealth;
+    maxHealth_[slot] = mob.maxHealth;
+    dead_[slot] = mob.isDead ? 1 : 0;
+}
+
+void
+MobHotStore::remove(int uid)
+{
+    auto it = slotByUid_.find(uid);
+    if (it == slotByUid_.end())
+        return;
+
+    const uint32_t slot = it->second;
+    slotByUid_.erase(it);
+    unlinkFromZone(slot);
+
+    const uint32_t last = static_cast<uint32_t>(uid_.size() - 1);
+    if (slot != last)
+        moveSlot(last, slot);
+
+    uid_.pop_back();
+    templateId_.pop_back();
+    zoneId_.pop_back();
+    posX_.pop_back();
+    posY_.pop_back();
+    posZ_.pop_back();
+    rotZ_.pop_back();
+    health_.pop_back();
+    maxHealth_.pop_back();
+    dead_.pop_back();
+    dirX_.pop_back();
+    dirY_.pop_back();
+    speed_.pop_back();
+    combatState_.pop_back();
+    stepTimestampMs_.pop_back();
+    engaged_.pop_back();
+    zoneListIndex_.pop_back();
+}
+
+void
+MobHotStore::setPosition(int uid, const PositionStruct &position)
+{
+    auto it = slotByUid_.find(uid);
+    if (it == slotByUid_.end())
+        return;
+    const uint32_t slot = it->second;
+    posX_[slot] = position.positionX;
+    posY_[slot] = position.positionY;
+    posZ_[slot] = position.positionZ;
+    rotZ_[slot] = position.rotationZ;
+}
+
+void
+MobHotStore::setHealth(int uid, int currentHealth, bool isDead)
+{
+    auto it = slotByUid_.find(uid);
+    if (it == slotByUid_.end())
+        return;
+    health_[it->second] = currentHealth;
+    dead_[it->second] = isDead ? 1 : 0;
+}
+
+void
+MobHotStore::setMotion(int uid, const MobMotionState &motion)
+{
+    auto it = slotByUid_.find(uid);
+    if (it == slotByUid_.end())
+        return;
+    const uint32_t slot = it->second;
+    dirX_[slot] = motion.dirX;
+    dirY_[slot] = motion.dirY;
+    speed_[slot] = motion.speed;
+    combatState_[slot] = static_cast<uint8_t>(motion.combatState);
+    stepTimestampMs_[slot] = motion.stepTimestampMs;
+    engaged_[slot] = motion.engaged ? 1 : 0;
+}
+
+size_t
+MobHotStore::zoneSize(int zoneId) const
+{
+    auto it = zoneSlots_.find(zoneId);
+    return it == zoneSlots_.end() ? 0 : it->second.size();
+}
+
+PositionStruct
+MobHotStore::positionAt(uint32_t slot) const
+{
+    PositionStruct position;
+    position.positionX = posX_[slot];
+    position.positionY = posY_[slot];
+    position.positionZ = posZ_[slot];
+    position.rotationZ = rotZ_[slot];
+    return position;
+}
+
+MobHotView
+MobHotStore::viewAt(uint32_t slot) const
+{
+    MobHotView view;
+    view.uid = uid_[slot];
+    view.templateId = templateId_[slot];
+    view.zoneId = zoneId_[slot];
+    view.position = positionAt(slot);
+    view.currentHealth = health_[slot];
+    view.maxHealth = maxHealth_[slot];
+    view.isDead = dead_[slot] != 0;
+    view.motion.dirX = dirX_[slot];
+    view.motion.dirY = dirY_[slot];
+    view.motion.speed = speed_[slot];
+    view.motion.combatState = static_cast<MobCombatState>(combatState_[slot]);
+    view.motion.stepTimestampMs = stepTimestampMs_[slot];
+    view.motion.engaged = engaged_[slot] != 0;
+    return view;
+}
+
+void
+MobHotStore::linkToZone(uint32_t slot, int zoneId)
+{
+    auto &list = zoneSlots_[zoneId];
+    zoneListIndex_[slot] = static_cast<uint32_t>(list.size());
+    list.push_back(slot);
+}
+
+void
+MobHotStore::unlinkFromZone(uint32_t slot)
+{
+    auto it = zoneSlots_.find(zoneId_[slot]);
+    if (it == zoneSlots_.end())
+        return;
+
+    auto &list = it->second;
+    const uint32_t index = zoneListIndex_[slot];
+    const uint32_t tail = list.back();
+    list[index] = tail;
+    zoneListIndex_[tail] = index;
+    list.pop_back();
+}
+
+void
+MobHotStore::moveSlot(uint32_t from, uint32_t to)
+{
+    uid_[to] = uid_[from];
+    templateId_[to] = templateId_[from];
+    zoneId_[to] = zoneId_[from];
+    posX_[to] = posX_[from];
+    posY_[to] = posY_[from];
+    posZ_[to] = posZ_[from];
+    rotZ_[to] = rotZ_[from];
+    health_[to] = health_[from];
+    maxHealth_[to] = maxHealth_[from];
+    dead_[to] = dead_[from];
+    dirX_[to] = dirX_[from];
+    dirY_[to] = dirY_[from];
+    speed_[to] = speed_[from];
+    combatState_[to] = combatState_[from];
+    stepTimestampMs_[to] = stepTimestampMs_[from];
+    engaged_[to] = engaged_[from];
+    zoneListIndex_[to] = zoneListIndex_[from];
+
+    slotByUid_[uid_[to]] = to;
+    zoneSlots_[zoneId_[to]][zoneListIndex_[to]] = to;
+}
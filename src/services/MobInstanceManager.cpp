@@ -7,8 +7,14 @@
 #include <spdlog/logger.h>
 #include <unordered_map>
 
+namespace
+{
+// Roughly the largest AoE / social-aggro radius: most queries touch 3x3 cells.
+constexpr float MOB_GRID_CELL_SIZE = 1000.0f;
+} // namespace
+
 MobInstanceManager::MobInstanceManager(Logger &logger)
-    : logger_(logger), eventQueue_(nullptr)
+    : logger_(logger), eventQueue_(nullptr), mobGrid_(MOB_GRID_CELL_SIZE)
 {
     log_ = logger.getSystem("mob");
 }
@@ -52,9 +58,10 @@ MobInstanceManager::registerMobInstance(const MobDataStruct &mobInstance)
 
     // Register the mob instance
     mobInstances_[mobInstance.uid] = mobInstance;
+    membershipVersion_.fetch_add(1, std::memory_order_relaxed);
 
-    // Update zone index
-    updateZoneIndex(mobInstance.uid, 0, mobInstance.zoneId);
+    hotStore_.sync(mobInstance);
+    mobGrid_.update(mobInstance.uid, mobInstance.position.positionX, mobInstance.position.positionY);
 
     logger_.log("[INFO] Registered mob instance UID: " + std::to_string(mobInstance.uid) +
                 " (Type: " + std::to_string(mobInstance.id) + ", Zone: " + std::to_string(mobInstance.zoneId) + ")");
@@ -70,13 +77,12 @@ MobInstanceManager::unregisterMobInstance(int mobUID)
     auto it = mobInstances_.find(mobUID);
     if (it != mobInstances_.end())
     {
-        int zoneId = it->second.zoneId;
-
-        // Remove from zone index
-        updateZoneIndex(mobUID, zoneId, 0);
+        hotStore_.remove(mobUID);
+        mobGrid_.remove(mobUID);
 
         // Remove from main map
         mobInstances_.erase(it);
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
 
         log_->info("[INFO] Unregistered mob instance UID: " + std::to_string(mobUID));
     }
@@ -105,46 +111,64 @@ MobInstanceManager::getMobInstancesInZone(int zoneId) const
 {
     std::shared_lock<std::shared_mutex> lock(mutex_);
     std::vector<MobDataStruct> result;
+    result.reserve(hotStore_.zoneSize(zoneId));
 
-    auto zoneIt = mobsByZone_.find(zoneId);
-    if (zoneIt != mobsByZone_.end())
-    {
-        for (int mobUID : zoneIt->second)
+    hotStore_.forEachSlotInZone(zoneId, [&](uint32_t slot)
         {
-            auto mobIt = mobInstances_.find(mobUID);
+            auto mobIt = mobInstances_.find(hotStore_.uidAt(slot));
             if (mobIt != mobInstances_.end())
-            {
                 result.push_back(mobIt->second);
-            }
-        }
-    }
+        });
 
     return result;
 }
 
-std::vector<std::pair<int, PositionStruct>>
-MobInstanceManager::getMobPositionsInZone(int zoneId) const
+void
+MobInstanceManager::getLivingMobInstances(const std::vector<int> &mobUIDs, std::vector<MobDataStruct> &out) const
 {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    std::vector<std::pair<int, PositionStruct>> result;
+    size_t count = 0;
 
-    auto zoneIt = mobsByZone_.find(zoneId);
-    if (zoneIt != mobsByZone_.end())
+    for (int mobUID : mobUIDs)
     {
-        result.reserve(zoneIt->second.size());
-        for (int mobUID : zoneIt->second)
-        {
-            auto mobIt = mobInstances_.find(mobUID);
-            if (mobIt != mobInstances_.end())
-            {
-                result.emplace_back(mobUID, mobIt->second.position);
-            }
-        }
+        auto mobIt = mobInstances_.find(mobUID);
+        if (mobIt == mobInstances_.end() || mobIt->second.isDead || mobIt->second.currentHealth <= 0)
+            continue;
+        if (count < out.size())
+            out[count] = mobIt->second;
+        else
+            out.push_back(mobIt->second);
+        ++count;
     }
 
+    out.resize(count);
+}
+
+std::vector<std::pair<int, PositionStruct>>
+MobInstanceManager::getMobPositionsInZone(int zoneId) const
+{
+    std::vector<std::pair<int, PositionStruct>> result;
+    getMobPositionsInZone(zoneId, result);
     return result;
 }
 
+void
+MobInstanceManager::getMobPositionsInZone(int zoneId, std::vector<std::pair<int, PositionStruct>> &out) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    out.clear();
+    out.reserve(hotStore_.zoneSize(zoneId));
+    hotStore_.forEachSlotInZone(zoneId, [&](uint32_t slot)
+        { out.emplace_back(hotStore_.uidAt(slot), hotStore_.positionAt(slot)); });
+}
+
+void
+MobInstanceManager::updateMobMotion(int mobUID, const MobMotionState &motion)
+{
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    hotStore_.setMotion(mobUID, motion);
+}
+
 bool
 MobInstanceManager::updateMobPosition(int mobUID, const PositionStruct &position)
 {
@@ -154,6 +178,8 @@ MobInstanceManager::updateMobPosition(int mobUID, const PositionStruct &position
     if (it != mobInstances_.end())
     {
         it->second.position = position;
+        hotStore_.setPosition(mobUID, position);
+        mobGrid_.update(mobUID, position.positionX, position.positionY);
         // Only log position updates very rarely to prevent spam.
         // positionLogThrottleMap_ is already protected by unique_lock above.
         float currentTime = std::chrono::duration<float>(std::chrono::steady_clock::now().time_since_epoch()).count();
@@ -204,6 +230,7 @@ MobInstanceManager::updateMobHealth(int mobUID, int health)
         it->second.isDead = true;
         it->second.deathTimestamp = std::chrono::steady_clock::now();
         mobDied = true;
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
         log_->info("[INFO] Mob " + std::to_string(mobUID) + " has died");
 
         // Send event for loot generation
@@ -228,6 +255,8 @@ MobInstanceManager::updateMobHealth(int mobUID, int health)
         }
     }
 
+    hotStore_.setHealth(mobUID, it->second.currentHealth, it->second.isDead);
+
     return {true, mobDied, wasAlreadyDead};
 }
 
@@ -273,6 +302,7 @@ MobInstanceManager::applyDamageToMob(int mobUID, int damageAmount, int killerId)
     {
         it->second.isDead = true;
         it->second.deathTimestamp = std::chrono::steady_clock::now();
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
         logger_.log("[INFO] Mob " + std::to_string(mobUID) + " has died from " + std::to_string(damageAmount) + " damage");
 
         if (eventQueue_)
@@ -289,6 +319,8 @@ MobInstanceManager::applyDamageToMob(int mobUID, int damageAmount, int killerId)
         }
     }
 
+    hotStore_.setHealth(mobUID, it->second.currentHealth, it->second.isDead);
+
     return {true, mobDied, false, newHealth, it->second.currentMana};
 }
 
@@ -308,6 +340,8 @@ MobInstanceManager::applyHealToMob(int mobUID, int healAmount)
         it->second.currentHealth + healAmount);
     it->second.currentHealth = newHealth;
 
+    hotStore_.setHealth(mobUID, it->second.currentHealth, it->second.isDead);
+
     return {true, false, false, newHealth, it->second.currentMana};
 }
 
@@ -357,6 +391,19 @@ MobInstanceManager::isMobAlive(int mobUID) const
     return false;
 }
 
+bool
+MobInstanceManager::getLivingMobLocation(int mobUID, int &zoneId, PositionStruct &position) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+
+    auto it = mobInstances_.find(mobUID);
+    if (it == mobInstances_.end() || it->second.isDead)
+        return false;
+    zoneId = it->second.zoneId;
+    position = it->second.position;
+    return true;
+}
+
 bool
 MobInstanceManager::markMobAsDead(int mobUID)
 {
@@ -373,6 +420,9 @@ MobInstanceManager::markMobAsDead(int mobUID)
     it->second.isDead = true;
     it->second.currentHealth = 0;
     it->second.deathTimestamp = std::chrono::steady_clock::now();
+    if (wasAlive)
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
+    hotStore_.setHealth(mobUID, it->second.currentHealth, it->second.isDead);
     log_->info("[INFO] Marked mob " + std::to_string(mobUID) + " as dead");
 
     return true;
@@ -406,72 +456,53 @@ MobInstanceManager::updateMobInstance(const MobDataStruct &updated)
     auto it = mobInstances_.find(updated.uid);
     if (it == mobInstances_.end())
         return false;
+    if (it->second.isDead != updated.isDead)
+        membershipVersion_.fetch_add(1, std::memory_order_relaxed);
     it->second = updated;
+    hotStore_.sync(updated);
+    mobGrid_.update(updated.uid, updated.position.positionX, updated.position.positionY);
     return true;
 }
 
-std::vector<MobDataStruct>
+std::vector<MobRangeHit>
 MobInstanceManager::getMobsInRange(float centerX, float centerY, float radius) const
 {
-    std::vector<MobDataStruct> result;
+    std::vector<MobRangeHit> result;
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    for (const auto &[uid, mob] : mobInstances_)
-    {
-        if (mob.isDead)
-            continue;
-        float dx = mob.position.positionX - centerX;
-        float dy = mob.position.positionY - centerY;
-        if (std::sqrt(dx * dx + dy * dy) <= radius)
-            result.push_back(mob);
-    }
+    mobGrid_.forEachInRange(centerX, centerY, radius, [&](int uid, float, float, float distSq)
+        {
+            auto it = mobInstances_.find(uid);
+            if (it == mobInstances_.end() || it->second.isDead)
+                return;
+            result.push_back({uid, it->second.zoneId, it->second.position, distSq});
+        });
     return result;
 }
 
-int
-MobInstanceManager::getAliveMobCountInZone(int zoneId) const
+void
+MobInstanceManager::forEachMobInRange(float centerX,
+    float centerY,
+    float radius,
+    const std::function<void(const MobDataStruct &, float)> &visitor) const
 {
     std::shared_lock<std::shared_mutex> lock(mutex_);
-    int count = 0;
-
-    auto zoneIt = mobsByZone_.find(zoneId);
-    if (zoneIt != mobsByZone_.end())
-    {
-        for (int mobUID : zoneIt->second)
+    mobGrid_.forEachInRange(centerX, centerY, radius, [&](int uid, float, float, float distSq)
         {
-            auto mobIt = mobInstances_.find(mobUID);
-            if (mobIt != mobInstances_.end() && !mobIt->second.isDead && mobIt->second.currentHealth > 0)
-            {
-                count++;
-            }
-        }
-    }
-
-    return count;
+            auto it = mobInstances_.find(uid);
+            if (it != mobInstances_.end() && !it->second.isDead)
+                visitor(it->second, distSq);
+        });
 }
 
-void
-MobInstanceManager::updateZoneIndex(int mobUID, int oldZoneId, int newZoneId)
+int
+MobInstanceManager::getAliveMobCountInZone(int zoneId) const
 {
-    // Remove from old zone
-    if (oldZoneId != 0)
-    {
-        auto oldZoneIt = mobsByZone_.find(oldZoneId);
-        if (oldZoneIt != mobsByZone_.end())
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    int count = 0;
+    hotStore_.forEachSlotInZone(zoneId, [&](uint32_t slot)
         {
-            auto &mobList = oldZoneIt->second;
-            mobList.erase(std::remove(mobList.begin(), mobList.end(), mobUID), mobList.end());
-
-            // Remove zone entry if empty
-            if (mobList.empty())
-            {
-                mobsByZone_.erase(oldZoneIt);
-            }
-        }
-    }
-
-    // Add to new zone
-    if (newZoneId != 0)
-    {
-        mobsByZone_[newZoneId].push_back(mobUID);
-    }
+            if (hotStore_.isAlive(slot))
+                ++count;
+        });
+    return count;
 }
@@ -98,6 +98,7 @@ MobManager::setListOfMobsAttributes(
             mobAttribute.mob_id = row.mob_id;
             mobAttribute.name = row.name;
             mobAttribute.slug = row.slug;
+            mobAttribute.slugId = row.slugId != NO_SYMBOL ? row.slugId : internSymbol(row.slug);
             mobAttribute.value = row.value;
 
             mobs_[mobAttribute.mob_id].attributes.push_back(mobAttribute);
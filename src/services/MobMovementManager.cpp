@@ -1,5 +1,6 @@
 #include "services/MobMovementManager.hpp"
 #include "data/CombatStructs.hpp"
+#include "data/StatSheet.hpp"
 #include "events/Event.hpp"
 #include "events/EventData.hpp"
 #include "events/EventQueue.hpp"
@@ -8,7 +9,9 @@
 #include "services/GameServices.hpp"
 #include "services/MobInstanceManager.hpp"
 #include "services/MobManager.hpp"
+#include "services/NavigationManager.hpp"
 #include "services/SpawnZoneManager.hpp"
+#include "utils/ForkJoinPool.hpp"
 #include "utils/TimeUtils.hpp"
 #include <algorithm>
 #include <chrono>
@@ -18,6 +21,8 @@
 #include <spdlog/logger.h>
 #include <unordered_set>
 
+thread_local MobMovementManager::ZoneTickBatch *MobMovementManager::activeBatch_ = nullptr;
+
 MobMovementManager::MobMovementManager(Logger &logger)
     : logger_(logger),
       mobInstanceManager_(nullptr),
@@ -25,7 +30,7 @@ MobMovementManager::MobMovementManager(Logger &logger)
       characterManager_(nullptr),
       eventQueue_(nullptr),
       combatSystem_(nullptr),
-      rng_(std::random_device{}()),
+      rngSeed_(std::random_device{}()),
       mobAIController_(logger)
 {
     log_ = logger.getSystem("mob");
@@ -54,6 +59,12 @@ MobMovementManager::setCharacterManager(CharacterManager *characterManager)
     mobAIController_.setCharacterManager(characterManager);
 }
 
+void
+MobMovementManager::setNavigationManager(NavigationManager *navigationManager)
+{
+    navigationManager_ = navigationManager;
+}
+
 void
 MobMovementManager::setEventQueue(EventQueue *eventQueue)
 {
@@ -104,13 +115,41 @@ MobMovementManager::moveMobsInZone(int zoneId)
         return false;
     }
 
-    // Get mobs in zone (full data for AI/combat logic)
-    auto mobsInZone = mobInstanceManager_->getMobInstancesInZone(zoneId);
-    if (mobsInZone.empty())
+    // AI level of detail: players near the zone, gathered once per zone tick.
+    // Per-zone coarse timers only exist inside a parallel tick (moveMobsInZones).
+    const bool useLod = characterManager_ != nullptr;
+    ZoneSimState *sim = activeBatch_ ? activeBatch_->sim : nullptr;
+    static thread_local std::vector<PositionStruct> nearbyPlayers;
+    nearbyPlayers.clear();
+    if (useLod)
+        collectPlayersNearZone(zone, nearbyPlayers);
+
+    // The zone's living mobs straight from the hot store: position, health,
+    // velocity and combat state, no full records. Per-thread buffers keep their
+    // capacity between ticks, so a steady-state zone tick does not allocate.
+    static thread_local std::vector<MobHotView> zoneMobs;
+    zoneMobs.clear();
+    mobInstanceManager_->forEachLivingMobInZone(zoneId, [&](const MobHotView &mob)
+        { zoneMobs.push_back(mob); });
+    if (zoneMobs.empty())
     {
         return false; // No mobs to move
     }
 
+    // Nobody nearby: the zone stays dormant unless one of its mobs is engaged
+    // (e.g. just hit by a ranged attack, or still returning from a chase).
+    if (useLod && nearbyPlayers.empty())
+    {
+        const bool anyEngaged = std::any_of(zoneMobs.begin(), zoneMobs.end(), [](const MobHotView &mob)
+            { return mob.motion.engaged; });
+        if (!anyEngaged)
+        {
+            if (activeBatch_)
+                activeBatch_->dormant = true;
+            return false;
+        }
+    }
+
     // Get movement parameters for zone (fetched once per tick)
     auto params = getDefaultMovementParams();
     {
@@ -134,25 +173,225 @@ MobMovementManager::moveMobsInZone(int zoneId)
         }
     }
 
-    // Lightweight positions for collision detection (avoids deep-copying attribute/skill vectors)
-    auto mobPositions = mobInstanceManager_->getMobPositionsInZone(zoneId);
+    // Lightweight positions for collision detection, read from the hot store,
+    // bucketed once per zone tick so separation tests only touch nearby cells.
+    static thread_local NeighborGrid mobGrid;
+    static thread_local std::vector<std::pair<int, PositionStruct>> mobPositions;
+    mobPositions.clear();
+    for (const auto &mob : zoneMobs)
+        mobPositions.emplace_back(mob.uid, mob.position);
+    buildSeparationGrid(mobPositions, params, mobGrid);
 
     float currentTime = getCurrentGameTime();
     bool anyMobMoved = false;
 
-    for (auto &mob : mobsInZone)
+    // Level of detail is decided on the hot columns: idle mobs far from every
+    // player tick less often, or not at all. The tier is recomputed each tick,
+    // so an approaching player wakes them immediately.
+    static thread_local std::vector<int> tickUids;
+    tickUids.clear();
+    for (const auto &mob : zoneMobs)
     {
-        // Skip dead mobs
-        if (mob.isDead || mob.currentHealth <= 0)
-            continue;
+        if (useLod && !mob.motion.engaged)
+        {
+            const LodTier tier = classifyLod(mob.position, nearbyPlayers);
+            if (tier == LodTier::DORMANT)
+                continue;
+            if (tier == LodTier::COARSE && sim)
+            {
+                float &nextTick = sim->coarseNextTick[mob.uid];
+                if (currentTime < nextTick)
+                    continue;
+                nextTick = currentTime + aiConfig_.lodCoarseTickInterval;
+            }
+        }
+        tickUids.push_back(mob.uid);
+    }
 
-        if (runMobTick(mob, zone, params, mobPositions, currentTime))
+    // Only the mobs that run AI this tick need their full record (skills,
+    // attributes, aggro settings), copied under one read lock.
+    static thread_local std::vector<MobDataStruct> tickMobs;
+    mobInstanceManager_->getLivingMobInstances(tickUids, tickMobs);
+    for (auto &mob : tickMobs)
+    {
+        if (runMobTick(mob, zone, params, mobGrid, currentTime))
             anyMobMoved = true;
     }
 
+    // Drop coarse timers of mobs that died or left the zone.
+    if (sim && sim->coarseNextTick.size() > zoneMobs.size() * 2 + 64)
+    {
+        std::unordered_set<int> alive;
+        for (const auto &mob : zoneMobs)
+            alive.insert(mob.uid);
+        for (auto it = sim->coarseNextTick.begin(); it != sim->coarseNextTick.end();)
+        {
+            if (alive.count(it->first))
+                ++it;
+            else
+                it = sim->coarseNextTick.erase(it);
+        }
+    }
+
     return anyMobMoved;
 }
 
+std::vector<int>
+MobMovementManager::moveMobsInZones(const std::vector<int> &zoneIds, ForkJoinPool &pool)
+{
+    std::vector<ZoneTickBatch> batches(zoneIds.size());
+    {
+        std::unique_lock<std::shared_mutex> lock(mutex_);
+        for (size_t i = 0; i < zoneIds.size(); ++i)
+        {
+            auto it = zoneSims_.find(zoneIds[i]);
+            if (it == zoneSims_.end())
+            {
+                ZoneSimState state;
+                state.rng.seed(rngSeed_ ^ (static_cast<uint32_t>(zoneIds[i]) * 0x9E3779B9u));
+                it = zoneSims_.emplace(zoneIds[i], std::move(state)).first;
+            }
+            batches[i].zoneId = zoneIds[i];
+            batches[i].sim = &it->second; // map nodes are stable
+        }
+    }
+    snapshotMeleeSlotHolders();
+
+    pool.parallelFor(zoneIds.size(), [&](size_t i)
+        {
+            activeBatch_ = &batches[i];
+            try
+            {
+                moveMobsInZone(zoneIds[i]);
+            }
+            catch (const std::exception &e)
+            {
+                log_->error("MobMovementManager: zone " + std::to_string(zoneIds[i]) + " tick failed: " + e.what());
+            }
+            activeBatch_ = nullptr;
+        });
+
+    // Barrier passed: apply cross-zone effects in a fixed order.
+    for (auto &batch : batches)
+    {
+        for (auto &action : batch.deferred)
+        {
+            try
+            {
+                action();
+            }
+            catch (const std::exception &e)
+            {
+                log_->error(std::string("MobMovementManager: deferred zone action failed: ") + e.what());
+            }
+        }
+    }
+
+    std::vector<int> dormantZoneIds;
+    for (size_t i = 0; i < zoneIds.size(); ++i)
+    {
+        if (batches[i].dormant)
+            dormantZoneIds.push_back(zoneIds[i]);
+    }
+    return dormantZoneIds;
+}
+
+void
+MobMovementManager::runCrossZoneAction(std::function<void()> action)
+{
+    if (activeBatch_)
+        activeBatch_->deferred.push_back(std::move(action));
+    else
+        action();
+}
+
+namespace
+{
+bool
+holdsMeleeSlot(MobCombatState state)
+{
+    return state == MobCombatState::PREPARING_ATTACK ||
+           state == MobCombatState::ATTACKING ||
+           state == MobCombatState::ATTACK_COOLDOWN;
+}
+} // namespace
+
+void
+MobMovementManager::snapshotMeleeSlotHolders()
+{
+    for (auto &[targetId, holders] : meleeSlotSnapshot_)
+        holders.clear();
+    if (!mobInstanceManager_)
+        return;
+
+    std::vector<std::pair<int, int>> engaged; // mob UID, target player ID
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        for (const auto &[uid, md] : mobMovementData_)
+        {
+            if (md.targetPlayerId > 0 && holdsMeleeSlot(md.combatState))
+                engaged.emplace_back(uid, md.targetPlayerId);
+        }
+    }
+
+    for (const auto &[uid, targetId] : engaged)
+    {
+        MeleeSlotHolder holder;
+        PositionStruct position;
+        if (!mobInstanceManager_->getLivingMobLocation(uid, holder.zoneId, position))
+            continue;
+        holder.uid = uid;
+        holder.x = position.positionX;
+        holder.y = position.positionY;
+        meleeSlotSnapshot_[targetId].push_back(holder);
+    }
+}
+
+int
+MobMovementManager::countMeleeSlotHolders(int targetPlayerId, int excludeUID, float x, float y, float range) const
+{
+    if (!mobInstanceManager_)
+        return 0;
+    const int ownZone = activeBatch_ ? activeBatch_->zoneId : 0;
+    int count = 0;
+
+    // Live read: every mob outside a parallel tick, only the ticking zone's own inside one
+    for (const auto &hit : mobInstanceManager_->getMobsInRange(x, y, range))
+    {
+        if (hit.uid == excludeUID || (activeBatch_ && hit.zoneId != ownZone))
+            continue;
+        auto md = getMobMovementData(hit.uid);
+        if (md.targetPlayerId == targetPlayerId && holdsMeleeSlot(md.combatState))
+            ++count;
+    }
+    if (!activeBatch_)
+        return count;
+
+    auto it = meleeSlotSnapshot_.find(targetPlayerId);
+    if (it == meleeSlotSnapshot_.end())
+        return count;
+    const float rangeSq = range * range;
+    for (const auto &holder : it->second)
+    {
+        if (holder.uid == excludeUID || holder.zoneId == ownZone)
+            continue;
+        const float dx = holder.x - x;
+        const float dy = holder.y - y;
+        if (dx * dx + dy * dy <= rangeSq)
+            ++count;
+    }
+    return count;
+}
+
+std::mt19937 &
+MobMovementManager::rng()
+{
+    if (activeBatch_ && activeBatch_->sim)
+        return activeBatch_->sim->rng;
+    static thread_local std::mt19937 threadRng(std::random_device{}());
+    return threadRng;
+}
+
 bool
 MobMovementManager::moveSingleMob(int mobUID, int zoneId)
 {
@@ -174,9 +413,6 @@ MobMovementManager::moveSingleMob(int mobUID, int zoneId)
         return false;
     }
 
-    // Get lightweight {uid,position} pairs for collision detection (4.1 optimization)
-    auto mobPositions = mobInstanceManager_->getMobPositionsInZone(zoneId);
-
     // Fetch movement params once for the whole function (4.2 optimization)
     auto params = getDefaultMovementParams();
     {
@@ -186,8 +422,13 @@ MobMovementManager::moveSingleMob(int mobUID, int zoneId)
             params = paramIt->second;
     }
 
+    // Get lightweight {uid,position} pairs for collision detection (4.1 optimization)
+    auto mobPositions = mobInstanceManager_->getMobPositionsInZone(zoneId);
+    NeighborGrid mobGrid;
+    buildSeparationGrid(mobPositions, params, mobGrid);
+
     // Delegate to the shared per-mob AI+movement tick.
-    return runMobTick(mob, zone, params, mobPositions, getCurrentGameTime());
+    return runMobTick(mob, zone, params, mobGrid, getCurrentGameTime());
 }
 
 bool
@@ -195,7 +436,7 @@ MobMovementManager::runMobTick(
     MobDataStruct &mob,
     const SpawnZoneStruct &zone,
     const MobMovementParams &params,
-    const std::vector<std::pair<int, PositionStruct>> &mobPositions,
+    const NeighborGrid &mobPositions,
     float currentTime)
 {
     // Get movement data for this mob
@@ -223,7 +464,7 @@ MobMovementManager::runMobTick(
         if (movementData.nextMoveTime == 0.0f)
         {
             std::uniform_real_distribution<float> moveTime(params.moveTimeMin, params.moveTimeMax);
-            movementData.nextMoveTime = currentTime + moveTime(rng_);
+            movementData.nextMoveTime = currentTime + moveTime(rng());
             updateMobMovementData(mob.uid, movementData);
             log_->info("[DEBUG] Fixed non-aggressive mob UID: " + std::to_string(mob.uid) + " movement timing");
         }
@@ -240,7 +481,7 @@ MobMovementManager::runMobTick(
     {
         std::uniform_real_distribution<float> initialDelay(0.0f, params.initialDelayMax);
         std::uniform_real_distribution<float> moveTime(params.moveTimeMin, params.moveTimeMax);
-        movementData.nextMoveTime = currentTime + initialDelay(rng_) + moveTime(rng_);
+        movementData.nextMoveTime = currentTime + initialDelay(rng()) + moveTime(rng());
         updateMobMovementData(mob.uid, movementData);
     }
 
@@ -381,7 +622,7 @@ MobMovementManager::runMobTick(
         if (stuckData.combatState == MobCombatState::PATROLLING)
         {
             std::uniform_real_distribution<float> waitTime(params.moveTimeMin, params.moveTimeMax);
-            stuckData.nextMoveTime = currentTime + waitTime(rng_);
+            stuckData.nextMoveTime = currentTime + waitTime(rng());
             stuckData.movementDirectionX = 0.0f;
             stuckData.movementDirectionY = 0.0f;
             stuckData.hasPatrolTarget = false; // force a new waypoint on next attempt
@@ -400,10 +641,10 @@ MobMovementManager::runMobTick(
                     if (zone.shape == ZoneShape::CIRCLE || zone.shape == ZoneShape::ANNULUS)
                     {
                         std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * M_PI);
-                        float angle = angleDist(rng_);
+                        float angle = angleDist(rng());
                         float rMin = (zone.shape == ZoneShape::ANNULUS) ? zone.innerRadius : 0.0f;
                         std::uniform_real_distribution<float> radiusDist(rMin, zone.outerRadius);
-                        float radius = radiusDist(rng_);
+                        float radius = radiusDist(rng());
                         randPos.positionX = zone.centerX + radius * std::cos(angle);
                         randPos.positionY = zone.centerY + radius * std::sin(angle);
                     }
@@ -411,8 +652,8 @@ MobMovementManager::runMobTick(
                     {
                         std::uniform_real_distribution<float> dxDist(zone.minX, zone.maxX);
                         std::uniform_real_distribution<float> dyDist(zone.minY, zone.maxY);
-                        randPos.positionX = dxDist(rng_);
-                        randPos.positionY = dyDist(rng_);
+                        randPos.positionX = dxDist(rng());
+                        randPos.positionY = dyDist(rng());
                     }
 
                     if (ZoneBounds::contains(zone, randPos))
@@ -445,7 +686,7 @@ std::optional<MobMovementResult>
 MobMovementManager::calculateNewPosition(
     const MobDataStruct &mob,
     const SpawnZoneStruct &zone,
-    const std::vector<std::pair<int, PositionStruct>> &otherMobs,
+    const NeighborGrid &otherMobs,
     const MobMovementParams &params)
 {
     // Get movement data for this mob
@@ -507,7 +748,7 @@ MobMovementManager::calculateNewPosition(
     if (movementData.stepMultiplier == 0.0f)
     {
         std::uniform_real_distribution<float> stepMultiplier(params.stepMultiplierMin, params.stepMultiplierMax);
-        movementData.stepMultiplier = stepMultiplier(rng_);
+        movementData.stepMultiplier = stepMultiplier(rng());
         // Сохраняем обновленный stepMultiplier
         updateMobMovementData(mob.uid, movementData);
 
@@ -519,7 +760,7 @@ MobMovementManager::calculateNewPosition(
     std::uniform_real_distribution<float> baseSpeed(params.baseSpeedMin, params.baseSpeedMax);
     std::uniform_real_distribution<float> randFactor(0.85f, 1.2f);
     float maxStepSize = std::min(((maxX - minX) + (maxY - minY)) * params.maxStepSizePercent, params.maxStepSizeAbsolute);
-    float stepSize = std::clamp(baseSpeed(rng_) * movementData.stepMultiplier * randFactor(rng_),
+    float stepSize = std::clamp(baseSpeed(rng()) * movementData.stepMultiplier * randFactor(rng()),
         params.minMoveDistance * 0.75f,
         maxStepSize);
 
@@ -566,7 +807,7 @@ MobMovementManager::calculateNewPosition(
                     centerX - mob.position.positionX);
             }
             std::uniform_real_distribution<float> borderAngle(params.borderAngleMin, params.borderAngleMax);
-            newAngle = angleToEscape + (borderAngle(rng_) * (M_PI / 180.0f));
+            newAngle = angleToEscape + (borderAngle(rng()) * (M_PI / 180.0f));
         }
         else
         {
@@ -586,8 +827,8 @@ MobMovementManager::calculateNewPosition(
                     {
                         std::uniform_real_distribution<float> angleDist(0.0f, 2.0f * static_cast<float>(M_PI));
                         std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
-                        float angle = angleDist(rng_);
-                        float r = safeRadius * std::sqrt(unitDist(rng_));
+                        float angle = angleDist(rng());
+                        float r = safeRadius * std::sqrt(unitDist(rng()));
                         movementData.patrolTargetPoint.positionX = zone.centerX + r * std::cos(angle);
                         movementData.patrolTargetPoint.positionY = zone.centerY + r * std::sin(angle);
                         waypointSet = true;
@@ -608,10 +849,10 @@ MobMovementManager::calculateNewPosition(
                             -static_cast<float>(M_PI) * 0.5f,
                             static_cast<float>(M_PI) * 0.5f);
                         std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
-                        float angle = mobAngle + arcDist(rng_);
+                        float angle = mobAngle + arcDist(rng());
                         float r2in = safeInner * safeInner;
                         float r2out = safeOuter * safeOuter;
-                        float r = std::sqrt(r2in + unitDist(rng_) * (r2out - r2in));
+                        float r = std::sqrt(r2in + unitDist(rng()) * (r2out - r2in));
                         movementData.patrolTargetPoint.positionX = zone.centerX + r * std::cos(angle);
                         movementData.patrolTargetPoint.positionY = zone.centerY + r * std::sin(angle);
                         waypointSet = true;
@@ -627,8 +868,8 @@ MobMovementManager::calculateNewPosition(
                     {
                         std::uniform_real_distribution<float> ptX(innerMinX, innerMaxX);
                         std::uniform_real_distribution<float> ptY(innerMinY, innerMaxY);
-                        movementData.patrolTargetPoint.positionX = ptX(rng_);
-                        movementData.patrolTargetPoint.positionY = ptY(rng_);
+                        movementData.patrolTargetPoint.positionX = ptX(rng());
+                        movementData.patrolTargetPoint.positionY = ptY(rng());
                         waypointSet = true;
                     }
                 }
@@ -663,19 +904,19 @@ MobMovementManager::calculateNewPosition(
                                movementData.movementDirectionY != 0.0f);
             std::uniform_real_distribution<float> coinFlip(0.0f, 1.0f);
             const float inertiaProbability = (zone.shape == ZoneShape::ANNULUS) ? 0.40f : 0.70f;
-            if (hasPrevDir && coinFlip(rng_) < inertiaProbability)
+            if (hasPrevDir && coinFlip(rng()) < inertiaProbability)
             {
                 float prevAngle = std::atan2(movementData.movementDirectionY,
                     movementData.movementDirectionX);
                 // Blend ±30° (π/6) around previous heading
                 std::uniform_real_distribution<float> inertiaAngle(-M_PI / 6.0f, M_PI / 6.0f);
-                newAngle = prevAngle + inertiaAngle(rng_);
+                newAngle = prevAngle + inertiaAngle(rng());
             }
             else
             {
                 // Re-align to waypoint with a small random scatter (±15°)
                 std::uniform_real_distribution<float> scatter(-M_PI / 12.0f, M_PI / 12.0f);
-                newAngle = angleToWaypoint + scatter(rng_);
+                newAngle = angleToWaypoint + scatter(rng());
             }
         }
 
@@ -741,7 +982,7 @@ MobMovementManager::calculateNewPosition(
         {
             // Blend with previous heading for interior mobs.
             std::uniform_real_distribution<float> directionAdjust(params.directionAdjustMin, params.directionAdjustMax);
-            float adjustFactor = directionAdjust(rng_);
+            float adjustFactor = directionAdjust(rng());
             newDirectionX = (newDirectionX * adjustFactor) + (movementData.movementDirectionX * (1.0f - adjustFactor));
             newDirectionY = (newDirectionY * adjustFactor) + (movementData.movementDirectionY * (1.0f - adjustFactor));
         }
@@ -805,7 +1046,7 @@ MobMovementManager::calculateNewPosition(
 
     // Calculate rotation
     std::uniform_real_distribution<float> rotationJitter(params.rotationJitterMin, params.rotationJitterMax);
-    result.newPosition.rotationZ = atan2(newDirectionY, newDirectionX) * (180.0f / M_PI) + rotationJitter(rng_);
+    result.newPosition.rotationZ = atan2(newDirectionY, newDirectionX) * (180.0f / M_PI) + rotationJitter(rng());
 
     result.newDirectionX = newDirectionX;
     result.newDirectionY = newDirectionY;
@@ -820,9 +1061,22 @@ MobMovementManager::calculateNewPosition(
     return result;
 }
 
+void
+MobMovementManager::buildSeparationGrid(const std::vector<std::pair<int, PositionStruct>> &mobPositions,
+    const MobMovementParams &params,
+    NeighborGrid &grid) const
+{
+    // One cell spans the widest separation query (steering radius), so a
+    // query reads at most the 3x3 block around the mob.
+    grid.reset(std::max(aiConfig_.separationRadius, params.minSeparationDistance));
+    for (const auto &[uid, position] : mobPositions)
+        grid.add(uid, position.positionX, position.positionY);
+    grid.finalize();
+}
+
 bool
 MobMovementManager::isValidPosition(
-    float x, float y, const SpawnZoneStruct &zone, const std::vector<std::pair<int, PositionStruct>> &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params)
+    float x, float y, const SpawnZoneStruct &zone, const NeighborGrid &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params)
 {
     // Shape-aware containment check (RECT / CIRCLE / ANNULUS)
     if (!ZoneBounds::contains(zone, x, y))
@@ -832,42 +1086,19 @@ MobMovementManager::isValidPosition(
     const float mobRadius = (currentMob.radius > 0) ? static_cast<float>(currentMob.radius) : 0.0f;
     const float minSep = (mobRadius > 0.0f) ? (mobRadius * 2.0f) : params.minSeparationDistance;
 
-    for (const auto &otherMob : otherMobs)
-    {
-        if (otherMob.first == currentMob.uid)
-            continue;
-
-        float dx = x - otherMob.second.positionX;
-        float dy = y - otherMob.second.positionY;
-        if (dx * dx + dy * dy < minSep * minSep)
-            return false;
-    }
-
-    return true;
+    // Broad phase: only mobs in the cells around (x, y) are distance-tested.
+    return !otherMobs.anyWithin(x, y, minSep, currentMob.uid);
 }
 
 bool
 MobMovementManager::isValidPositionForChase(
-    float x, float y, const std::vector<std::pair<int, PositionStruct>> &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params)
+    float x, float y, const NeighborGrid &otherMobs, const MobDataStruct &currentMob, const MobMovementParams &params)
 {
     // Same radius-based separation as isValidPosition.
     const float mobRadius = (currentMob.radius > 0) ? static_cast<float>(currentMob.radius) : 0.0f;
     const float minSep = (mobRadius > 0.0f) ? (mobRadius * 2.0f) : params.minSeparationDistance;
 
-    for (const auto &otherMob : otherMobs)
-    {
-        if (otherMob.first == currentMob.uid)
-            continue;
-
-        float dx = x - otherMob.second.positionX;
-        float dy = y - otherMob.second.positionY;
-        if (dx * dx + dy * dy < minSep * minSep)
-        {
-            return false;
-        }
-    }
-
-    return true;
+    return !otherMobs.anyWithin(x, y, minSep, currentMob.uid);
 }
 
 MobMovementParams
@@ -888,6 +1119,25 @@ MobMovementManager::getMobMovementData(int mobUID) const
     return MobMovementData{}; // Return default values
 }
 
+void
+MobMovementManager::getMobReplicationStates(const std::vector<MobHotView> &mobs, std::vector<MobReplicationState> &out) const
+{
+    out.assign(mobs.size(), MobReplicationState{});
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    for (size_t i = 0; i < mobs.size(); ++i)
+    {
+        auto it = mobMovementData_.find(mobs[i].uid);
+        if (it == mobMovementData_.end())
+            continue;
+
+        const MobMovementData &data = it->second;
+        out[i].forceNextUpdate = data.forceNextUpdate;
+        out[i].lastBroadcastMs = data.lastBroadcastMs;
+        out[i].hasPatrolTarget = data.hasPatrolTarget;
+        out[i].patrolTargetPoint = data.patrolTargetPoint;
+    }
+}
+
 bool
 MobMovementManager::shouldSendMobUpdate(int mobUID, const PositionStruct &currentPosition)
 {
@@ -976,6 +1226,64 @@ MobMovementManager::updateLastBroadcastMs(int mobUID, int64_t nowMs)
     }
 }
 
+bool
+MobMovementManager::isMobEngaged(const MobMovementData &data)
+{
+    return data.targetPlayerId > 0 || data.isReturningToSpawn || data.isFleeing || data.isBackpedaling ||
+           data.combatState != MobCombatState::PATROLLING;
+}
+
+void
+MobMovementManager::publishMotion(int mobUID, const MobMovementData &data)
+{
+    if (!mobInstanceManager_)
+        return;
+
+    MobMotionState motion;
+    motion.dirX = data.movementDirectionX;
+    motion.dirY = data.movementDirectionY;
+    motion.speed = data.currentSpeedUnitsPerSec;
+    motion.combatState = data.combatState;
+    motion.stepTimestampMs = data.lastStepTimestampMs;
+    motion.engaged = isMobEngaged(data);
+    mobInstanceManager_->updateMobMotion(mobUID, motion);
+}
+
+void
+MobMovementManager::collectPlayersNearZone(const SpawnZoneStruct &zone, std::vector<PositionStruct> &out) const
+{
+    out.clear();
+    if (!characterManager_)
+        return;
+
+    // Zone AABB centre; the radius reaches lodDormantRange past its farthest corner.
+    const ZoneBounds bounds(zone);
+    const float centerX = (bounds.minX + bounds.maxX) * 0.5f;
+    const float centerY = (bounds.minY + bounds.maxY) * 0.5f;
+    const float halfDiagonal = 0.5f * std::hypot(bounds.maxX - bounds.minX, bounds.maxY - bounds.minY);
+
+    for (const auto &hit : characterManager_->getCharactersInRange(centerX, centerY, halfDiagonal + aiConfig_.lodDormantRange))
+        out.push_back(hit.position);
+}
+
+MobMovementManager::LodTier
+MobMovementManager::classifyLod(const PositionStruct &mobPos, const std::vector<PositionStruct> &players) const
+{
+    const float fullRangeSq = aiConfig_.lodFullRateRange * aiConfig_.lodFullRateRange;
+    const float dormantRangeSq = aiConfig_.lodDormantRange * aiConfig_.lodDormantRange;
+
+    float nearestSq = dormantRangeSq + 1.0f;
+    for (const auto &player : players)
+    {
+        const float dx = player.positionX - mobPos.positionX;
+        const float dy = player.positionY - mobPos.positionY;
+        nearestSq = std::min(nearestSq, dx * dx + dy * dy);
+        if (nearestSq <= fullRangeSq)
+            return LodTier::FULL;
+    }
+    return nearestSq <= dormantRangeSq ? LodTier::COARSE : LodTier::DORMANT;
+}
+
 MobMovementData
 MobMovementManager::getMobMovementDataInternal(int mobUID)
 {
@@ -1007,7 +1315,17 @@ void
 MobMovementManager::updateMobMovementData(int mobUID, const MobMovementData &data)
 {
     std::unique_lock<std::shared_mutex> lock(mutex_);
-    mobMovementData_[mobUID] = data;
+    MobMovementData &stored = mobMovementData_[mobUID];
+    // Published under mutex_ so the hot store never sees two writers' states out of order
+    const bool motionChanged = stored.movementDirectionX != data.movementDirectionX ||
+                               stored.movementDirectionY != data.movementDirectionY ||
+                               stored.currentSpeedUnitsPerSec != data.currentSpeedUnitsPerSec ||
+                               stored.combatState != data.combatState ||
+                               stored.lastStepTimestampMs != data.lastStepTimestampMs ||
+                               isMobEngaged(stored) != isMobEngaged(data);
+    stored = data;
+    if (motionChanged)
+        publishMotion(mobUID, stored);
 }
 
 void
@@ -1029,6 +1347,7 @@ MobMovementManager::updateMobMovementPositionFields(
         it->second.currentSpeedUnitsPerSec = currentSpeed;
         it->second.lastStepTimestampMs = nowMs;
         it->second.lastDeflectionSign = deflectionSign;
+        publishMotion(mobUID, it->second);
     }
 }
 
@@ -1042,7 +1361,7 @@ std::optional<MobMovementResult>
 MobMovementManager::calculateChaseMovement(
     const MobDataStruct &mob,
     const SpawnZoneStruct &zone,
-    const std::vector<std::pair<int, PositionStruct>> &otherMobs,
+    const NeighborGrid &otherMobs,
     int targetPlayerId,
     const MobMovementParams &params)
 {
@@ -1114,8 +1433,12 @@ MobMovementManager::calculateChaseMovement(
         return std::nullopt;
 
     // ---- 7. Desired direction (normalized vector to target) ----
+    // With a navigation grid the direction comes from the flow field toward the
+    // player's cell, shared by every mob chasing that player; otherwise straight.
     float desiredDx = dx / distance;
     float desiredDy = dy / distance;
+    if (navigationManager_)
+        navigationManager_->getStepDirection(mob.position, targetPlayer.characterPosition, desiredDx, desiredDy);
 
     // ---- 8. Separation steering ----
     // Soft repulsion force from nearby mobs. Produces smooth crowd navigation
@@ -1126,26 +1449,19 @@ MobMovementManager::calculateChaseMovement(
         const float mobRadius = (mob.radius > 0) ? static_cast<float>(mob.radius) : 70.0f;
         const float sepRadius = std::max(aiConfig_.separationRadius, mobRadius * 4.0f);
 
-        for (const auto &other : otherMobs)
-        {
-            if (other.first == mob.uid)
-                continue;
-
-            float ox = mob.position.positionX - other.second.positionX;
-            float oy = mob.position.positionY - other.second.positionY;
-            float od2 = ox * ox + oy * oy;
-
-            if (od2 >= sepRadius * sepRadius || od2 < 0.01f)
-                continue;
-
-            float od = std::sqrt(od2);
-            // Strength: inverse-linear falloff (strongest when touching, zero at sepRadius).
-            float strength = (sepRadius - od) / sepRadius;
-            // Square the strength for a sharper near-field repulsion.
-            strength *= strength;
-            sepX += (ox / od) * strength;
-            sepY += (oy / od) * strength;
-        }
+        otherMobs.forEachWithin(mob.position.positionX, mob.position.positionY, sepRadius, mob.uid, [&](int, float ox, float oy, float od2)
+            {
+                if (od2 < 0.01f)
+                    return;
+
+                float od = std::sqrt(od2);
+                // Strength: inverse-linear falloff (strongest when touching, zero at sepRadius).
+                float strength = (sepRadius - od) / sepRadius;
+                // Square the strength for a sharper near-field repulsion.
+                strength *= strength;
+                sepX += (ox / od) * strength;
+                sepY += (oy / od) * strength;
+            });
     }
 
     // ---- 9. Direction smoothing (exponential steering) ----
@@ -1204,7 +1520,7 @@ MobMovementManager::calculateChaseMovement(
     float mobChaseSpeed = aiConfig_.chaseSpeedUnitsPerSec;
     for (const auto &attr : mob.attributes)
     {
-        if (attr.slug == "move_speed" && attr.value > 0)
+        if (attr.slugId == statSymbol(StatId::MOVE_SPEED) && attr.value > 0)
         {
             mobChaseSpeed = static_cast<float>(attr.value) * MOVE_SPEED_SCALE;
             break;
@@ -1241,6 +1557,18 @@ MobMovementManager::calculateChaseMovement(
     float newX = mob.position.positionX + finalDx * stepSize;
     float newY = mob.position.positionY + finalDy * stepSize;
 
+    // Separation and smoothing must not push the mob into a blocked cell: fall
+    // back to the pure path direction, and hold position if that is blocked too.
+    if (navigationManager_ && !navigationManager_->isWalkable(newX, newY))
+    {
+        finalDx = desiredDx;
+        finalDy = desiredDy;
+        newX = mob.position.positionX + finalDx * stepSize;
+        newY = mob.position.positionY + finalDy * stepSize;
+        if (!navigationManager_->isWalkable(newX, newY))
+            return std::nullopt;
+    }
+
     // ---- 12. Return result ----
     MobMovementResult result;
     result.newPosition = mob.position;
@@ -1259,7 +1587,7 @@ std::optional<MobMovementResult>
 MobMovementManager::calculateReturnToSpawnMovement(
     const MobDataStruct &mob,
     const SpawnZoneStruct & /*zone*/,
-    const std::vector<std::pair<int, PositionStruct>> & /*otherMobs*/,
+    const NeighborGrid & /*otherMobs*/,
     const PositionStruct &spawnPosition,
     const MobMovementParams &params)
 {
@@ -1287,7 +1615,7 @@ MobMovementManager::calculateReturnToSpawnMovement(
         // Инициализируем время следующего движения для нормального патруля
         float currentTime = getCurrentGameTime();
         std::uniform_real_distribution<float> moveTime(params.moveTimeMin, params.moveTimeMax);
-        md.nextMoveTime = currentTime + moveTime(rng_);
+        md.nextMoveTime = currentTime + moveTime(rng());
 
         md.stepMultiplier = 0.0f; // Будет переинициализирован при следующем движении
         md.movementDirectionX = 0.0f;
@@ -1326,6 +1654,10 @@ MobMovementManager::calculateReturnToSpawnMovement(
     dx /= dist;
     dy /= dist;
 
+    // Обход препятствий по flow field, если для игровой зоны загружена навигационная сетка
+    if (navigationManager_)
+        navigationManager_->getStepDirection(mob.position, spawnPosition, dx, dy);
+
     // Двигаем моба на один шаг
     MobMovementResult result;
     result.newPosition = mob.position;
@@ -1354,8 +1686,8 @@ MobMovementManager::pickReturnDestination(const PositionStruct &mobPos, const Sp
 
     for (int i = 0; i < maxAttempts; ++i)
     {
-        float angle = angleDist(rng_);
-        float dist = distDist(rng_);
+        float angle = angleDist(rng());
+        float dist = distDist(rng());
         PositionStruct candidate;
         candidate.positionX = mobPos.positionX + std::cos(angle) * dist;
         candidate.positionY = mobPos.positionY + std::sin(angle) * dist;
@@ -1499,14 +1831,14 @@ MobMovementManager::calculateNextMoveTime(float currentTime,
 {
     std::uniform_real_distribution<float> speedTime(params.speedTimeMin, params.speedTimeMax);
     float patrolSpeedFactor = (mob.patrolSpeed > 0.01f) ? mob.patrolSpeed : movementData.speedMultiplier;
-    float nextTime = currentTime + std::max(speedTime(rng_) / patrolSpeedFactor, 2.0f);
+    float nextTime = currentTime + std::max(speedTime(rng()) / patrolSpeedFactor, 2.0f);
 
     // Optional random cooldown pause to add unpredictability
     std::uniform_real_distribution<float> randFactor(0.85f, 1.2f);
-    if (randFactor(rng_) > 1.15f)
+    if (randFactor(rng()) > 1.15f)
     {
         std::uniform_real_distribution<float> cooldown(params.cooldownMin, params.cooldownMax);
-        nextTime += cooldown(rng_) * 0.5f;
+        nextTime += cooldown(rng()) * 0.5f;
     }
     return nextTime;
 }
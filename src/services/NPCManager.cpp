@@ -28,6 +28,7 @@ NPCManager::setNPCsList(const std::vector<NPCDataStruct> &npcs)
     }
 
     npcsLoaded_ = true;
+    version_.fetch_add(1, std::memory_order_relaxed);
     logger_.log("Loaded " + std::to_string(npcs.size()) + " NPCs into NPCManager", GREEN);
 }
 
@@ -50,6 +51,7 @@ NPCManager::setNPCsAttributes(const std::vector<NPCAttributeStruct> &attributes)
     {
         applyAttributesToNPC(pair.second);
     }
+    version_.fetch_add(1, std::memory_order_relaxed);
 
     logger_.log("Loaded attributes for " + std::to_string(attributesMap_.size()) + " NPCs", GREEN);
 }
@@ -136,6 +138,7 @@ NPCManager::clearNPCData()
     npcsMap_.clear();
     attributesMap_.clear();
     npcsLoaded_ = false;
+    version_.fetch_add(1, std::memory_order_relaxed);
 
     log_->info("Cleared all NPC data");
 }
@@ -0,0 +1,324 @@
+#include "services/NavigationManager.hpp"
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <nlohmann/json.hpp>
+#include <queue>
+#include <spdlog/logger.h>
+
+namespace
+{
+// 8-connected moves with integer costs (orthogonal 10, diagonal 14 ≈ 10·√2)
+constexpr int NEIGHBOR_DX[8] = {1, -1, 0, 0, 1, 1, -1, -1};
+constexpr int NEIGHBOR_DY[8] = {0, 0, 1, -1, 1, -1, 1, -1};
+constexpr int NEIGHBOR_COST[8] = {10, 10, 10, 10, 14, 14, 14, 14};
+
+std::string
+navGridDirectory()
+{
+    const char *env = std::getenv("NAV_GRID_DIR");
+    return (env && env[0] != '\0') ? env : "navgrids";
+}
+} // namespace
+
+bool
+NavGrid::contains(float x, float y) const
+{
+    return cellIndex(x, y) >= 0;
+}
+
+int
+NavGrid::cellIndex(float x, float y) const
+{
+    const int cx = static_cast<int>(std::floor((x - originX) / cellSize));
+    const int cy = static_cast<int>(std::floor((y - originY) / cellSize));
+    if (cx < 0 || cy < 0 || cx >= width || cy >= height)
+        return -1;
+    return cy * width + cx;
+}
+
+NavigationManager::NavigationManager(Logger &logger)
+    : logger_(logger),
+      grids_(std::make_shared<const std::vector<std::shared_ptr<const NavGrid>>>())
+{
+    log_ = logger.getSystem("mob");
+}
+
+void
+NavigationManager::loadGameZoneGrids(const std::vector<GameZoneStruct> &zones)
+{
+    const std::string directory = navGridDirectory();
+    auto grids = std::make_shared<std::vector<std::shared_ptr<const NavGrid>>>();
+
+    for (const auto &zone : zones)
+    {
+        if (zone.slug.empty())
+            continue;
+        const std::string path = directory + "/" + zone.slug + ".json";
+        if (auto grid = loadGridFile(zone, path))
+            grids->push_back(std::move(grid));
+    }
+
+    std::atomic_store(&grids_, std::shared_ptr<const std::vector<std::shared_ptr<const NavGrid>>>(std::move(grids)));
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        fieldCache_.clear();
+    }
+
+    log_->info("[NavigationManager] Loaded {} navigation grids from '{}'", std::atomic_load(&grids_)->size(), directory);
+}
+
+std::shared_ptr<const NavGrid>
+NavigationManager::loadGridFile(const GameZoneStruct &zone, const std::string &path) const
+{
+    std::ifstream file(path);
+    if (!file.is_open())
+        return nullptr; // no grid for this zone: straight-line steering
+
+    try
+    {
+        nlohmann::json doc = nlohmann::json::parse(file);
+
+        auto grid = std::make_shared<NavGrid>();
+        grid->gameZoneId = zone.id;
+        grid->cellSize = doc.value("cellSize", 100.0f);
+        grid->originX = doc.value("originX", zone.minX);
+        grid->originY = doc.value("originY", zone.minY);
+        grid->width = doc.at("width").get<int>();
+        grid->height = doc.at("height").get<int>();
+        const auto &rows = doc.at("rows");
+
+        if (grid->cellSize <= 0.0f || grid->width <= 0 || grid->height <= 0 ||
+            static_cast<int64_t>(grid->width) * grid->height > MAX_GRID_CELLS ||
+            rows.size() != static_cast<size_t>(grid->height))
+        {
+            log_->error("[NavigationManager] Invalid grid dimensions in {}", path);
+            return nullptr;
+        }
+
+        // rows[0] is the lowest Y row; '#' marks a blocked cell, anything else is walkable.
+        grid->walkable.assign(static_cast<size_t>(grid->width) * grid->height, 1);
+        for (int cy = 0; cy < grid->height; ++cy)
+        {
+            const std::string row = rows[cy].get<std::string>();
+            if (row.size() != static_cast<size_t>(grid->width))
+            {
+                log_->error("[NavigationManager] Row {} has wrong length in {}", cy, path);
+                return nullptr;
+            }
+            for (int cx = 0; cx < grid->width; ++cx)
+            {
+                if (row[cx] == '#')
+                    grid->walkable[cy * grid->width + cx] = 0;
+            }
+        }
+
+        return grid;
+    }
+    catch (const std::exception &e)
+    {
+        log_->error("[NavigationManager] Failed to load {}: {}", path, e.what());
+        return nullptr;
+    }
+}
+
+std::shared_ptr<const NavGrid>
+NavigationManager::findGrid(float x, float y) const
+{
+    auto grids = std::atomic_load(&grids_);
+    for (const auto &grid : *grids)
+    {
+        if (grid->contains(x, y))
+            return grid;
+    }
+    return nullptr;
+}
+
+bool
+NavigationManager::isWalkable(float x, float y) const
+{
+    auto grid = findGrid(x, y);
+    return !grid || grid->isWalkable(x, y);
+}
+
+bool
+NavigationManager::getStepDirection(const PositionStruct &from, const PositionStruct &to, float &outDx, float &outDy)
+{
+    auto grid = findGrid(from.positionX, from.positionY);
+    if (!grid)
+        return false;
+
+    const int fromCell = grid->cellIndex(from.positionX, from.positionY);
+    const int targetCell = grid->cellIndex(to.positionX, to.positionY);
+    if (targetCell < 0 || fromCell == targetCell)
+        return false; // target off-grid, or already in its cell: straight line is exact
+
+    auto field = getFlowField(grid, targetCell);
+    if (!field)
+        return false;
+
+    const int next = field->next(fromCell);
+    if (next < 0)
+        return false;
+
+    // Aim at the next cell's centre; on the final hop aim at the target itself.
+    float aimX = to.positionX;
+    float aimY = to.positionY;
+    if (next != targetCell)
+    {
+        aimX = grid->originX + (static_cast<float>(next % grid->width) + 0.5f) * grid->cellSize;
+        aimY = grid->originY + (static_cast<float>(next / grid->width) + 0.5f) * grid->cellSize;
+    }
+
+    const float dx = aimX - from.positionX;
+    const float dy = aimY - from.positionY;
+    const float len = std::sqrt(dx * dx + dy * dy);
+    if (len < 0.001f)
+        return false;
+
+    outDx = dx / len;
+    outDy = dy / len;
+    return true;
+}
+
+std::shared_ptr<const FlowField>
+NavigationManager::getFlowField(const std::shared_ptr<const NavGrid> &grid, int targetCell)
+{
+    const auto key = std::make_pair(grid->gameZoneId, targetCell);
+    const auto now = Clock::now();
+    {
+        std::lock_guard<std::mutex> lock(cacheMutex_);
+        auto it = fieldCache_.find(key);
+        if (it != fieldCache_.end() && it->second.field->grid == grid)
+        {
+            it->second.lastUsed = now;
+            return it->second.field;
+        }
+    }
+
+    // Built outside the lock: other zones keep reading cached fields meanwhile.
+    // Two zones racing on the same new key both build; the first insert wins.
+    auto field = buildFlowField(grid, targetCell);
+    if (!field)
+        return nullptr;
+
+    std::lock_guard<std::mutex> lock(cacheMutex_);
+    auto existing = fieldCache_.find(key);
+    if (existing != fieldCache_.end() && existing->second.field->grid == grid)
+    {
+        existing->second.lastUsed = now;
+        return existing->second.field;
+    }
+
+    if (existing != fieldCache_.end())
+    {
+        // Field of a reloaded grid
+        fieldCacheBytes_ -= existing->second.field->bytes();
+        fieldCache_.erase(existing);
+    }
+
+    if (fieldCacheBytes_ + field->bytes() > MAX_CACHE_BYTES)
+    {
+        // Expired fields first, then least recently used until the new field fits.
+        for (auto it = fieldCache_.begin(); it != fieldCache_.end();)
+        {
+            if (now - it->second.lastUsed > FIELD_TTL)
+            {
+                fieldCacheBytes_ -= it->second.field->bytes();
+                it = fieldCache_.erase(it);
+            }
+            else
+                ++it;
+        }
+        while (!fieldCache_.empty() && fieldCacheBytes_ + field->bytes() > MAX_CACHE_BYTES)
+        {
+            auto oldest = std::min_element(fieldCache_.begin(), fieldCache_.end(), [](const auto &a, const auto &b)
+                { return a.second.lastUsed < b.second.lastUsed; });
+            fieldCacheBytes_ -= oldest->second.field->bytes();
+            fieldCache_.erase(oldest);
+        }
+    }
+
+    fieldCacheBytes_ += field->bytes();
+    fieldCache_[key] = CachedField{field, now};
+    return field;
+}
+
+std::shared_ptr<const FlowField>
+NavigationManager::buildFlowField(const std::shared_ptr<const NavGrid> &grid, int targetCell)
+{
+    if (!grid->walkable[targetCell])
+        return nullptr;
+
+    const int gridWidth = grid->width;
+    const int targetCx = targetCell % gridWidth;
+    const int targetCy = targetCell / gridWidth;
+
+    // Search window: the grid clipped to MAX_SEARCH_RADIUS_CELLS around the target.
+    auto field = std::make_shared<FlowField>();
+    field->grid = grid;
+    field->targetCell = targetCell;
+    field->minCx = std::max(0, targetCx - MAX_SEARCH_RADIUS_CELLS);
+    field->minCy = std::max(0, targetCy - MAX_SEARCH_RADIUS_CELLS);
+    field->width = std::min(gridWidth, targetCx + MAX_SEARCH_RADIUS_CELLS + 1) - field->minCx;
+    field->height = std::min(grid->height, targetCy + MAX_SEARCH_RADIUS_CELLS + 1) - field->minCy;
+    const int width = field->width;
+    const int height = field->height;
+    const size_t cellCount = static_cast<size_t>(width) * height;
+    field->nextCell.assign(cellCount, -1);
+
+    // Window-local cell -> grid cell
+    auto toGrid = [&](int local)
+    { return (field->minCy + local / width) * gridWidth + field->minCx + local % width; };
+
+    std::vector<int32_t> cost(cellCount, INT_MAX);
+    using Node = std::pair<int32_t, int32_t>; // (cost, window cell)
+    std::priority_queue<Node, std::vector<Node>, std::greater<Node>> open;
+
+    const int targetLocal = (targetCy - field->minCy) * width + (targetCx - field->minCx);
+    cost[targetLocal] = 0;
+    field->nextCell[targetLocal] = targetCell;
+    open.push({0, targetLocal});
+
+    while (!open.empty())
+    {
+        const auto [nodeCost, cell] = open.top();
+        open.pop();
+        if (nodeCost != cost[cell])
+            continue; // stale entry
+
+        const int cx = cell % width;
+        const int cy = cell / width;
+        const int gx = field->minCx + cx;
+        const int gy = field->minCy + cy;
+        for (int dir = 0; dir < 8; ++dir)
+        {
+            const int nx = cx + NEIGHBOR_DX[dir];
+            const int ny = cy + NEIGHBOR_DY[dir];
+            if (nx < 0 || ny < 0 || nx >= width || ny >= height)
+                continue;
+            const int neighbor = ny * width + nx;
+            const int ngx = gx + NEIGHBOR_DX[dir];
+            const int ngy = gy + NEIGHBOR_DY[dir];
+            if (!grid->walkable[ngy * gridWidth + ngx])
+                continue;
+
+            // No corner cutting: a diagonal needs both orthogonal cells open.
+            if (dir >= 4 && (!grid->walkable[gy * gridWidth + ngx] || !grid->walkable[ngy * gridWidth + gx]))
+                continue;
+
+            const int32_t newCost = nodeCost + NEIGHBOR_COST[dir];
+            if (newCost < cost[neighbor])
+            {
+                cost[neighbor] = newCost;
+                field->nextCell[neighbor] = toGrid(cell); // one step closer to the target
+                open.push({newCost, neighbor});
+            }
+        }
+    }
+
+    return field;
+}
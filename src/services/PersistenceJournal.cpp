@@ -0,0 +1,304 @@
+#include "services/PersistenceJournal.hpp"
+#include <nlohmann/json.hpp>
+#include <spdlog/logger.h>
+
+namespace
+{
+constexpr int ALL_CHARACTERS = 0;
+
+nlohmann::json
+gameServerPacket(const std::string &eventType)
+{
+    nlohmann::json packet;
+    packet["header"]["eventType"] = eventType;
+    packet["header"]["clientId"] = 0;
+    packet["header"]["hash"] = "";
+    return packet;
+}
+
+bool
+samePosition(const PositionStruct &a, const PositionStruct &b)
+{
+    return a.positionX == b.positionX && a.positionY == b.positionY &&
+           a.positionZ == b.positionZ && a.rotationZ == b.rotationZ;
+}
+} // namespace
+
+PersistenceJournal::PersistenceJournal(Logger &logger)
+    : logger_(logger)
+{
+    log_ = logger.getSystem("persist");
+}
+
+void
+PersistenceJournal::setSendCallback(std::function<void(const std::string &)> callback)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    sendCallback_ = std::move(callback);
+}
+
+void
+PersistenceJournal::setQueueDepthProvider(std::function<size_t()> provider)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    queueDepthProvider_ = std::move(provider);
+}
+
+void
+PersistenceJournal::setLimits(size_t highWaterMessages, size_t maxBatchBytes)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    highWaterMessages_ = highWaterMessages;
+    maxBatchBytes_ = maxBatchBytes;
+}
+
+void
+PersistenceJournal::stage(int characterId, const std::string &key, std::string packet)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.staged;
+    auto it = keyedIndex_.find(key);
+    if (it != keyedIndex_.end())
+    {
+        keyed_[it->second].packet = std::move(packet);
+        ++stats_.coalesced;
+        return;
+    }
+    keyedIndex_.emplace(key, keyed_.size());
+    keyed_.push_back({characterId, key, std::move(packet)});
+}
+
+void
+PersistenceJournal::stagePosition(int characterId, const PositionStruct &position)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.staged;
+    auto flushed = flushedPositions_.find(characterId);
+    if (flushed != flushedPositions_.end() && samePosition(flushed->second, position))
+    {
+        if (pendingPositions_.erase(characterId) == 0)
+            ++stats_.unchanged;
+        else
+            ++stats_.coalesced;
+        return;
+    }
+    if (!pendingPositions_.insert_or_assign(characterId, position).second)
+        ++stats_.coalesced;
+}
+
+void
+PersistenceJournal::stageHpMana(int characterId, int currentHp, int currentMana)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.staged;
+    auto flushed = flushedHpMana_.find(characterId);
+    if (flushed != flushedHpMana_.end() && flushed->second.hp == currentHp && flushed->second.mana == currentMana)
+    {
+        if (pendingHpMana_.erase(characterId) == 0)
+            ++stats_.unchanged;
+        else
+            ++stats_.coalesced;
+        return;
+    }
+    if (!pendingHpMana_.insert_or_assign(characterId, HpMana{currentHp, currentMana}).second)
+        ++stats_.coalesced;
+}
+
+void
+PersistenceJournal::stagePlayTime(int characterId, int64_t sessionPlayTimeSec)
+{
+    if (sessionPlayTimeSec <= 0)
+        return;
+    std::lock_guard<std::mutex> lock(mutex_);
+    ++stats_.staged;
+    auto [it, inserted] = pendingPlayTime_.try_emplace(characterId, 0);
+    if (!inserted)
+        ++stats_.coalesced;
+    it->second += sessionPlayTimeSec;
+}
+
+std::vector<std::string>
+PersistenceJournal::takePendingLocked(int onlyCharacterId)
+{
+    auto selected = [onlyCharacterId](int characterId)
+    { return onlyCharacterId == ALL_CHARACTERS || characterId == onlyCharacterId; };
+
+    std::vector<std::string> packets;
+
+    // savePositions / saveHpMana: one packet carrying every changed row
+    nlohmann::json positions = nlohmann::json::array();
+    for (auto it = pendingPositions_.begin(); it != pendingPositions_.end();)
+    {
+        if (!selected(it->first))
+        {
+            ++it;
+            continue;
+        }
+        const PositionStruct &pos = it->second;
+        positions.push_back({{"characterId", it->first},
+            {"posX", pos.positionX},
+            {"posY", pos.positionY},
+            {"posZ", pos.positionZ},
+            {"rotZ", pos.rotationZ}});
+        flushedPositions_[it->first] = pos;
+        it = pendingPositions_.erase(it);
+    }
+    if (!positions.empty())
+    {
+        nlohmann::json packet = gameServerPacket("savePositions");
+        packet["body"]["characters"] = std::move(positions);
+        packets.push_back(packet.dump() + "\n");
+    }
+
+    nlohmann::json hpMana = nlohmann::json::array();
+    for (auto it = pendingHpMana_.begin(); it != pendingHpMana_.end();)
+    {
+        if (!selected(it->first))
+        {
+            ++it;
+            continue;
+        }
+        hpMana.push_back({{"characterId", it->first},
+            {"currentHp", it->second.hp},
+            {"currentMana", it->second.mana}});
+        flushedHpMana_[it->first] = it->second;
+        it = pendingHpMana_.erase(it);
+    }
+    if (!hpMana.empty())
+    {
+        nlohmann::json packet = gameServerPacket("saveHpMana");
+        packet["body"]["characters"] = std::move(hpMana);
+        packets.push_back(packet.dump() + "\n");
+    }
+
+    // savePlayTime has no batch form on the game server: one packet per character
+    for (auto it = pendingPlayTime_.begin(); it != pendingPlayTime_.end();)
+    {
+        if (!selected(it->first))
+        {
+            ++it;
+            continue;
+        }
+        nlohmann::json packet = gameServerPacket("savePlayTime");
+        packet["body"]["characterId"] = it->first;
+        packet["body"]["sessionPlayTimeSec"] = it->second;
+        packet["body"]["lastSessionPlayTimeSec"] = 0;
+        packet["body"]["isDisconnect"] = false;
+        packets.push_back(packet.dump() + "\n");
+        it = pendingPlayTime_.erase(it);
+    }
+
+    // Keyed writes, in staging order
+    if (onlyCharacterId == ALL_CHARACTERS)
+    {
+        for (auto &write : keyed_)
+            packets.push_back(std::move(write.packet));
+        keyed_.clear();
+        keyedIndex_.clear();
+    }
+    else
+    {
+        std::vector<KeyedWrite> kept;
+        for (auto &write : keyed_)
+        {
+            if (write.characterId == onlyCharacterId)
+                packets.push_back(std::move(write.packet));
+            else
+                kept.push_back(std::move(write));
+        }
+        keyed_ = std::move(kept);
+        keyedIndex_.clear();
+        for (size_t i = 0; i < keyed_.size(); ++i)
+            keyedIndex_.emplace(keyed_[i].key, i);
+    }
+
+    stats_.packetsSent += packets.size();
+    return packets;
+}
+
+void
+PersistenceJournal::sendBatches(const std::vector<std::string> &packets)
+{
+    std::function<void(const std::string &)> send;
+    size_t maxBatchBytes = 0;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        send = sendCallback_;
+        maxBatchBytes = maxBatchBytes_;
+    }
+    if (!send)
+    {
+        log_->error("PersistenceJournal: no send callback, dropping " + std::to_string(packets.size()) + " packet(s)");
+        return;
+    }
+
+    size_t batches = 0;
+    std::string batch;
+    for (const auto &packet : packets)
+    {
+        if (!batch.empty() && batch.size() + packet.size() > maxBatchBytes)
+        {
+            send(batch);
+            ++batches;
+            batch.clear();
+        }
+        batch += packet;
+    }
+    if (!batch.empty())
+    {
+        send(batch);
+        ++batches;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex_);
+    stats_.batchesSent += batches;
+}
+
+size_t
+PersistenceJournal::flush(bool force)
+{
+    std::lock_guard<std::mutex> sendLock(sendMutex_);
+    std::vector<std::string> packets;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!force && queueDepthProvider_)
+        {
+            const size_t depth = queueDepthProvider_();
+            if (depth > highWaterMessages_)
+            {
+                ++stats_.deferredFlushes;
+                log_->warn("PersistenceJournal: game-server send queue at " + std::to_string(depth) +
+                           " message(s), deferring flush of " + std::to_string(keyed_.size()) + " keyed write(s)");
+                return 0;
+            }
+        }
+        packets = takePendingLocked(ALL_CHARACTERS);
+    }
+    if (!packets.empty())
+        sendBatches(packets);
+    return packets.size();
+}
+
+void
+PersistenceJournal::flushCharacter(int characterId)
+{
+    if (characterId <= 0)
+        return;
+    std::lock_guard<std::mutex> sendLock(sendMutex_);
+    std::vector<std::string> packets;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        packets = takePendingLocked(characterId);
+        flushedPositions_.erase(characterId);
+        flushedHpMana_.erase(characterId);
+    }
+    if (!packets.empty())
+        sendBatches(packets);
+}
+
+PersistenceJournal::Stats
+PersistenceJournal::getStats() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+}
@@ -84,7 +84,7 @@ PityManager::resetCounter(int characterId, int itemId)
 }
 
 void
-PityManager::setSaveCallback(std::function<void(const std::string &)> callback)
+PityManager::setSaveCallback(PersistWriteCallback callback)
 {
     saveCallback_ = std::move(callback);
 }
@@ -101,7 +101,7 @@ PityManager::persist(int characterId, int itemId, int killCount)
         pkt["body"]["characterId"] = characterId;
         pkt["body"]["itemId"] = itemId;
         pkt["body"]["killCount"] = killCount;
-        saveCallback_(pkt.dump() + "\n");
+        saveCallback_(characterId, "pity:" + std::to_string(characterId) + ":" + std::to_string(itemId), pkt.dump() + "\n");
     }
     catch (const std::exception &e)
     {
@@ -1,5 +1,4 @@
 #include "services/QuestManager.hpp"
-#include "network/GameServerWorker.hpp"
 #include "network/NetworkManager.hpp"
 #include "services/GameServices.hpp"
 #include "utils/ResponseBuilder.hpp"
@@ -12,12 +11,6 @@ QuestManager::QuestManager(GameServices *services, Logger &logger)
     log_ = logger.getSystem("quest");
 }
 
-void
-QuestManager::setGameServerWorker(GameServerWorker *worker)
-{
-    gameServerWorker_ = worker;
-}
-
 void
 QuestManager::setNetworkManager(NetworkManager *nm)
 {
@@ -1098,29 +1091,27 @@ QuestManager::flushDirtyProgress()
             packet["body"]["currentStep"] = pq.currentStep;
             packet["body"]["progress"] = pq.progress;
 
-            if (gameServerWorker_)
-                gameServerWorker_->sendDataToGameServer(packet.dump() + "\n");
+            services_->getPersistenceJournal().stage(characterId,
+                "quest:" + std::to_string(characterId) + ":" + std::to_string(questId), packet.dump() + "\n");
 
             pq.isDirty = false;
         }
     }
 
     // Flush pending flag updates
-    if (gameServerWorker_)
+    for (const auto &fu : pendingFlagUpdates_)
     {
-        for (const auto &fu : pendingFlagUpdates_)
-        {
-            nlohmann::json packet;
-            packet["header"]["eventType"] = "updatePlayerFlag";
-            packet["body"]["characterId"] = fu.characterId;
-            packet["body"]["flagKey"] = fu.flagKey;
-            if (fu.boolValue.has_value())
-                packet["body"]["boolValue"] = fu.boolValue.value();
-            if (fu.intValue.has_value())
-                packet["body"]["intValue"] = fu.intValue.value();
-
-            gameServerWorker_->sendDataToGameServer(packet.dump() + "\n");
-        }
+        nlohmann::json packet;
+        packet["header"]["eventType"] = "updatePlayerFlag";
+        packet["body"]["characterId"] = fu.characterId;
+        packet["body"]["flagKey"] = fu.flagKey;
+        if (fu.boolValue.has_value())
+            packet["body"]["boolValue"] = fu.boolValue.value();
+        if (fu.intValue.has_value())
+            packet["body"]["intValue"] = fu.intValue.value();
+
+        services_->getPersistenceJournal().stage(fu.characterId,
+            "flag:" + std::to_string(fu.characterId) + ":" + fu.flagKey, packet.dump() + "\n");
     }
     pendingFlagUpdates_.clear();
 }
@@ -1145,8 +1136,8 @@ QuestManager::flushAllProgress(int characterId)
         packet["body"]["currentStep"] = pq.currentStep;
         packet["body"]["progress"] = pq.progress;
 
-        if (gameServerWorker_)
-            gameServerWorker_->sendDataToGameServer(packet.dump() + "\n");
+        services_->getPersistenceJournal().stage(characterId,
+            "quest:" + std::to_string(characterId) + ":" + std::to_string(questId), packet.dump() + "\n");
         pq.isDirty = false;
     }
 }
@@ -1155,21 +1146,19 @@ void
 QuestManager::flushPendingFlags()
 {
     std::lock_guard<std::mutex> lock(mutex_);
-    if (gameServerWorker_)
+    for (const auto &fu : pendingFlagUpdates_)
     {
-        for (const auto &fu : pendingFlagUpdates_)
-        {
-            nlohmann::json packet;
-            packet["header"]["eventType"] = "updatePlayerFlag";
-            packet["body"]["characterId"] = fu.characterId;
-            packet["body"]["flagKey"] = fu.flagKey;
-            if (fu.boolValue.has_value())
-                packet["body"]["boolValue"] = fu.boolValue.value();
-            if (fu.intValue.has_value())
-                packet["body"]["intValue"] = fu.intValue.value();
-
-            gameServerWorker_->sendDataToGameServer(packet.dump() + "\n");
-        }
+        nlohmann::json packet;
+        packet["header"]["eventType"] = "updatePlayerFlag";
+        packet["body"]["characterId"] = fu.characterId;
+        packet["body"]["flagKey"] = fu.flagKey;
+        if (fu.boolValue.has_value())
+            packet["body"]["boolValue"] = fu.boolValue.value();
+        if (fu.intValue.has_value())
+            packet["body"]["intValue"] = fu.intValue.value();
+
+        services_->getPersistenceJournal().stage(fu.characterId,
+            "flag:" + std::to_string(fu.characterId) + ":" + fu.flagKey, packet.dump() + "\n");
     }
     pendingFlagUpdates_.clear();
 }
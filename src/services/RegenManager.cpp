@@ -14,28 +14,27 @@ RegenManager::RegenManager(GameServices *gameServices)
     : gameServices_(gameServices)
 {
     log_ = gameServices_->getLogger().getSystem("regen");
-}
 
-/// Returns the base value of a named attribute from a pre-built attribute list.
-static int
-findAttr(const std::vector<CharacterAttributeStruct> &attrs, const std::string &slug)
-{
-    for (const auto &a : attrs)
-        if (a.slug == slug)
-            return a.value;
-    return 0;
+    auto &cfg = gameServices_->getGameConfigService();
+    baseHpRegenKey_ = cfg.key("regen.baseHpRegen");
+    baseMpRegenKey_ = cfg.key("regen.baseMpRegen");
+    hpRegenConCoeffKey_ = cfg.key("regen.hpRegenConCoeff");
+    mpRegenWisCoeffKey_ = cfg.key("regen.mpRegenWisCoeff");
+    disableInCombatMsKey_ = cfg.key("regen.disableInCombatMs");
+    tickIntervalMsKey_ = cfg.key("regen.tickIntervalMs");
 }
 
 void
 RegenManager::tickRegen()
 {
-    // ── Read config (shared_lock inside getFloat/getInt – cheap) ──────────────
+    // ── Read config (pre-resolved keys, lock-free snapshot reads) ─────────────
     auto &cfg = gameServices_->getGameConfigService();
-    const int baseHpRegen = cfg.getInt("regen.baseHpRegen", 2);
-    const int baseMpRegen = cfg.getInt("regen.baseMpRegen", 1);
-    const float hpRegenConCoeff = cfg.getFloat("regen.hpRegenConCoeff", 0.3f);
-    const float mpRegenWisCoeff = cfg.getFloat("regen.mpRegenWisCoeff", 0.5f);
-    const int disableInCombatMs = cfg.getInt("regen.disableInCombatMs", 8000);
+    const int baseHpRegen = cfg.getInt(baseHpRegenKey_, 2);
+    const int baseMpRegen = cfg.getInt(baseMpRegenKey_, 1);
+    const float hpRegenConCoeff = cfg.getFloat(hpRegenConCoeffKey_, 0.3f);
+    const float mpRegenWisCoeff = cfg.getFloat(mpRegenWisCoeffKey_, 0.5f);
+    const int disableInCombatMs = cfg.getInt(disableInCombatMsKey_, 8000);
+    const int tickIntervalMs = cfg.getInt(tickIntervalMsKey_, 4000);
 
     auto &charMgr = gameServices_->getCharacterManager();
     auto &statsNotif = gameServices_->getStatsNotificationService();
@@ -68,78 +67,31 @@ RegenManager::tickRegen()
         }
 
         // ── Compute effective regen and max values ────────────────────────────
-        // Start from base character attributes, then layer active effects and
-        // equipped item bonuses, exactly as CharacterStatsNotificationService does.
-        int hpRegenBase = findAttr(ch.attributes, "hp_regen_per_s");
-        int mpRegenBase = findAttr(ch.attributes, "mp_regen_per_s");
-        int maxHpEff = findAttr(ch.attributes, "max_health");
-        int maxMpEff = findAttr(ch.attributes, "max_mana");
-        // Fallback to stored struct values if the attribute list is incomplete
-        if (maxHpEff <= 0)
-            maxHpEff = ch.characterMaxHealth;
-        if (maxMpEff <= 0)
-            maxMpEff = ch.characterMaxMana;
-
-        // Layer active-effect stat modifiers (skip DoT/HoT ticks)
-        for (const auto &eff : ch.activeEffects)
+        // Base attributes + equipped-item bonuses + active effects without a tick
+        // interval, read from the compiled stat sheet.
+        CharacterStatSheet scratch;
+        const CharacterStatSheet &stats = statSheetFor(ch, scratch, nowSec);
+        const int hpRegenBase = stats.effectiveStatic(StatId::HP_REGEN_PER_S);
+        const int mpRegenBase = stats.effectiveStatic(StatId::MP_REGEN_PER_S);
+        // Fallback to stored struct values if the base attribute is missing
+        auto effectiveMax = [&stats](StatId id, int fallback)
         {
-            if (eff.expiresAt != 0 && eff.expiresAt <= nowSec)
-                continue;
-            if (eff.tickMs > 0)
-                continue;
-            const auto &slug = eff.attributeSlug;
-            const int val = static_cast<int>(std::round(eff.value));
-            if (slug == "hp_regen_per_s")
-                hpRegenBase += val;
-            else if (slug == "mp_regen_per_s")
-                mpRegenBase += val;
-            else if (slug == "max_health")
-                maxHpEff += val;
-            else if (slug == "max_mana")
-                maxMpEff += val;
-        }
-
-        // Layer equipped-item bonuses (apply_on == "equip")
-        try
-        {
-            const auto equipState =
-                gameServices_->getEquipmentManager().getEquipmentState(cid);
-            for (const auto &[slotSlug, slot] : equipState.slots)
-            {
-                if (slot.inventoryItemId == 0)
-                    continue;
-                const auto item =
-                    gameServices_->getItemManager().getItemById(slot.itemId);
-                for (const auto &attr : item.attributes)
-                {
-                    if (attr.apply_on != "equip")
-                        continue;
-                    const int v = attr.value;
-                    if (attr.slug == "hp_regen_per_s")
-                        hpRegenBase += v;
-                    else if (attr.slug == "mp_regen_per_s")
-                        mpRegenBase += v;
-                    else if (attr.slug == "max_health")
-                        maxHpEff += v;
-                    else if (attr.slug == "max_mana")
-                        maxMpEff += v;
-                }
-            }
-        }
-        catch (...)
-        {
-        }
+            const int base = stats.base[static_cast<std::size_t>(id)];
+            return (base > 0 ? base : fallback) + stats.effectiveStatic(id) - base;
+        };
+        const int maxHpEff = effectiveMax(StatId::MAX_HEALTH, ch.characterMaxHealth);
+        const int maxMpEff = effectiveMax(StatId::MAX_MANA, ch.characterMaxMana);
 
         // Final per-tick gains.  Regen attributes are stored as per-second values;
         // tick interval is configurable (default 4 s) so multiply accordingly.
         // The old constitution/wisdom formula is kept as a fallback base bonus.
-        const int conValue = findAttr(ch.attributes, "constitution");
-        const int wisValue = findAttr(ch.attributes, "wisdom");
+        const int conValue = stats.base[static_cast<std::size_t>(StatId::CONSTITUTION)];
+        const int wisValue = stats.base[static_cast<std::size_t>(StatId::WISDOM)];
         const int hpFromStats = baseHpRegen + std::max(0, static_cast<int>(conValue * hpRegenConCoeff));
         const int mpFromStats = baseMpRegen + std::max(0, static_cast<int>(wisValue * mpRegenWisCoeff));
 
         const float tickSec = static_cast<float>(disableInCombatMs > 0
-                                                     ? cfg.getInt("regen.tickIntervalMs", 4000)
+                                                     ? tickIntervalMs
                                                      : 4000) /
                               1000.0f;
         const int hpGain = std::max(hpFromStats,
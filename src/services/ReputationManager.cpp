@@ -151,7 +151,7 @@ ReputationManager::persist(int characterId,
         pkt["body"]["characterId"] = characterId;
         pkt["body"]["factionSlug"] = factionSlug;
         pkt["body"]["value"] = value;
-        saveCallback_(pkt.dump() + "\n");
+        saveCallback_(characterId, "reputation:" + std::to_string(characterId) + ":" + factionSlug, pkt.dump() + "\n");
     }
     catch (const std::exception &e)
     {
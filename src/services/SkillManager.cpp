@@ -254,6 +254,7 @@ SkillManager::useCharacterSkillWithTargetType(int casterId, const std::string &s
                 CharacterAttributeStruct charAttr;
                 charAttr.name = attr.name;
                 charAttr.slug = attr.slug;
+                charAttr.slugId = attr.slugId;
                 charAttr.value = attr.value;
                 tempTargetData.attributes.push_back(charAttr);
             }
@@ -13,7 +13,7 @@ SkillSystem::SkillSystem(GameServices *gameServices)
     : gameServices_(gameServices)
 {
     log_ = gameServices_->getLogger().getSystem("skill");
-    combatCalculator_ = std::make_unique<CombatCalculator>();
+    combatCalculator_ = std::make_unique<CombatCalculator>(&gameServices_->getGameConfigService());
 }
 
 SkillUsageResult
@@ -79,7 +79,7 @@ SkillSystem::useSkill(int casterId, const std::string &skillSlug, int targetId,
         {
             const int gcdMs = (casterType == CasterType::PLAYER) ? skill.gcdMs : 0;
             bool onGCD = false;
-            if (!trySetCooldown(casterId, skillSlug, skill.cooldownMs, gcdMs, &onGCD))
+            if (!trySetCooldown(casterId, skillSymbol(skill), skill.cooldownMs, gcdMs, &onGCD))
             {
                 // Mana was already consumed — refund it since the skill is on cooldown.
                 if (skill.costMp > 0 && casterType == CasterType::PLAYER)
@@ -155,6 +155,7 @@ SkillSystem::useSkill(int casterId, const std::string &skillSlug, int targetId,
                     CharacterAttributeStruct ca;
                     ca.name = a.name;
                     ca.slug = a.slug;
+                    ca.slugId = a.slugId;
                     ca.value = a.value;
                     tempTarget.attributes.push_back(ca);
                 }
@@ -271,14 +272,21 @@ SkillSystem::setCooldown(int casterId, const std::string &skillSlug, int cooldow
 {
     auto now = std::chrono::steady_clock::now();
     auto endTime = now + std::chrono::milliseconds(cooldownMs);
+    const SymbolId skillSlugId = internSymbol(skillSlug);
     std::unique_lock<std::shared_mutex> lock(cooldownsMutex_);
-    cooldowns_[casterId][skillSlug] = endTime;
+    cooldowns_[casterId][skillSlugId] = endTime;
 }
 
 bool
 SkillSystem::trySetCooldown(int casterId, const std::string &skillSlug, int cooldownMs, int gcdMs, bool *outOnGCD)
 {
-    static const std::string GCD_KEY = "__gcd__";
+    return trySetCooldown(casterId, internSymbol(skillSlug), cooldownMs, gcdMs, outOnGCD);
+}
+
+bool
+SkillSystem::trySetCooldown(int casterId, SymbolId skillSlugId, int cooldownMs, int gcdMs, bool *outOnGCD)
+{
+    static const SymbolId GCD_KEY = internSymbol("__gcd__");
 
     // HIGH-1: single unique_lock covers both the check and the set.
     // No other thread can sneak in between, eliminating the TOCTOU race.
@@ -288,7 +296,7 @@ SkillSystem::trySetCooldown(int casterId, const std::string &skillSlug, int cool
     auto &perEntity = cooldowns_[casterId];
 
     // Check per-skill cooldown
-    auto &skillEntry = perEntity[skillSlug];
+    auto &skillEntry = perEntity[skillSlugId];
     if (now < skillEntry)
     {
         if (outOnGCD)
@@ -318,11 +326,14 @@ SkillSystem::trySetCooldown(int casterId, const std::string &skillSlug, int cool
 bool
 SkillSystem::isOnCooldown(int casterId, const std::string &skillSlug)
 {
+    const SymbolId skillSlugId = SymbolTable::instance().find(skillSlug);
+    if (skillSlugId == NO_SYMBOL)
+        return false; // never interned, so never put on cooldown
     std::shared_lock<std::shared_mutex> lock(cooldownsMutex_);
     auto it = cooldowns_.find(casterId);
     if (it == cooldowns_.end())
         return false;
-    auto skillIt = it->second.find(skillSlug);
+    auto skillIt = it->second.find(skillSlugId);
     if (skillIt == it->second.end())
         return false;
     return std::chrono::steady_clock::now() < skillIt->second;
@@ -334,14 +345,15 @@ SkillSystem::restoreCooldown(int casterId, const std::string &skillSlug, int64_t
     if (remainingMs <= 0)
         return;
     auto endTime = std::chrono::steady_clock::now() + std::chrono::milliseconds(remainingMs);
+    const SymbolId skillSlugId = internSymbol(skillSlug);
     std::unique_lock<std::shared_mutex> lock(cooldownsMutex_);
-    cooldowns_[casterId][skillSlug] = endTime;
+    cooldowns_[casterId][skillSlugId] = endTime;
 }
 
 bool
 SkillSystem::isGCDActive(int casterId)
 {
-    static const std::string GCD_KEY = "__gcd__";
+    static const SymbolId GCD_KEY = internSymbol("__gcd__");
     std::shared_lock<std::shared_mutex> lock(cooldownsMutex_);
     auto it = cooldowns_.find(casterId);
     if (it == cooldowns_.end())
@@ -345,7 +345,7 @@ TitleManager::persist(int characterId,
         for (const auto &s : earned)
             arr.push_back(s);
         pkt["body"]["earnedSlugs"] = arr;
-        saveCallback_(pkt.dump() + "\n");
+        saveCallback_(characterId, "title:" + std::to_string(characterId), pkt.dump() + "\n");
     }
     catch (const std::exception &e)
     {
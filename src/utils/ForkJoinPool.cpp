@@ -0,0 +1,112 @@
+#include "utils/ForkJoinPool.hpp"
+
+ForkJoinPool::ForkJoinPool(size_t workerCount)
+{
+    workers_.reserve(workerCount);
+    for (size_t i = 0; i < workerCount; ++i)
+        workers_.emplace_back(&ForkJoinPool::workerLoop, this);
+}
+
+ForkJoinPool::~ForkJoinPool()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_)
+    {
+        if (worker.joinable())
+            worker.join();
+    }
+}
+
+void
+ForkJoinPool::parallelFor(size_t count, const std::function<void(size_t)> &fn)
+{
+    if (count == 0)
+        return;
+
+    std::lock_guard<std::mutex> callLock(callMutex_);
+
+    if (workers_.empty() || count == 1)
+    {
+        next_.store(0, std::memory_order_relaxed);
+        runClaimed(fn, count);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        job_ = &fn;
+        jobCount_ = count;
+        remaining_ = count;
+        next_.store(0, std::memory_order_relaxed);
+        ++generation_;
+    }
+    wake_.notify_all();
+
+    const size_t ran = runClaimed(fn, count);
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    remaining_ -= ran;
+    // Barrier: every index done and no worker still holding a reference to fn.
+    done_.wait(lock, [this]()
+        { return remaining_ == 0 && busyWorkers_ == 0; });
+    job_ = nullptr;
+}
+
+size_t
+ForkJoinPool::runClaimed(const std::function<void(size_t)> &fn, size_t count)
+{
+    size_t ran = 0;
+    while (true)
+    {
+        const size_t index = next_.fetch_add(1, std::memory_order_relaxed);
+        if (index >= count)
+            break;
+        try
+        {
+            fn(index);
+        }
+        catch (...)
+        {
+            // Callers log inside fn; a throw must not break the barrier.
+        }
+        ++ran;
+    }
+    return ran;
+}
+
+void
+ForkJoinPool::workerLoop()
+{
+    uint64_t seenGeneration = 0;
+    while (true)
+    {
+        const std::function<void(size_t)> *fn = nullptr;
+        size_t count = 0;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            wake_.wait(lock, [&]()
+                { return stop_ || generation_ != seenGeneration; });
+            if (stop_)
+                return;
+            seenGeneration = generation_;
+            if (!job_)
+                continue; // woke after that job already completed
+            fn = job_;
+            count = jobCount_;
+            ++busyWorkers_;
+        }
+
+        const size_t ran = runClaimed(*fn, count);
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            remaining_ -= ran;
+            --busyWorkers_;
+        }
+        done_.notify_all();
+    }
+}
@@ -11,6 +11,12 @@ CharacterDataStruct
 JSONParser::parseCharacterData(const char *data, size_t length)
 {
     nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
+    return parseCharacterData(jsonData);
+}
+
+CharacterDataStruct
+JSONParser::parseCharacterData(const nlohmann::json &jsonData)
+{
     CharacterDataStruct characterData;
 
     if (jsonData.contains("body") && jsonData["body"].is_object() &&
@@ -116,6 +122,7 @@ JSONParser::parseCharacterData(const char *data, size_t length)
             {
                 attributeData.value = attribute["value"].get<int>();
             }
+            attributeData.slugId = internSymbol(attributeData.slug);
             characterData.attributes.push_back(attributeData);
 
             // Используем атрибуты для установки максимального здоровья и маны если основные поля неправильные
@@ -226,6 +233,7 @@ JSONParser::parseCharacterData(const char *data, size_t length)
                     skillData.effects.push_back(ed);
                 }
             }
+            resolveSkillSymbols(skillData);
             characterData.skills.push_back(skillData);
         }
     }
@@ -267,6 +275,12 @@ PositionStruct
 JSONParser::parsePositionData(const char *data, size_t length)
 {
     nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
+    return parsePositionData(jsonData);
+}
+
+PositionStruct
+JSONParser::parsePositionData(const nlohmann::json &jsonData)
+{
     PositionStruct positionData;
 
     if (jsonData.contains("body") && jsonData["body"].is_object() &&
@@ -313,6 +327,12 @@ ClientDataStruct
 JSONParser::parseClientData(const char *data, size_t length)
 {
     nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
+    return parseClientData(jsonData);
+}
+
+ClientDataStruct
+JSONParser::parseClientData(const nlohmann::json &jsonData)
+{
     ClientDataStruct clientData;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -327,6 +347,13 @@ JSONParser::parseClientData(const char *data, size_t length)
         clientData.hash = jsonData["header"]["hash"].get<std::string>();
     }
 
+    // Optional wire protocol negotiation (joinGameClient): "binary" enables BinaryCodec frames
+    if (jsonData.contains("header") && jsonData["header"].is_object() &&
+        jsonData["header"].contains("wireProtocol") && jsonData["header"]["wireProtocol"].is_string())
+    {
+        clientData.binaryWire = jsonData["header"]["wireProtocol"].get<std::string>() == "binary";
+    }
+
     return clientData;
 }
 
@@ -359,6 +386,7 @@ JSONParser::parseCharacterAttributesList(const char *data, size_t length)
             {
                 attributeData.value = attribute["value"].get<int>();
             }
+            attributeData.slugId = internSymbol(attributeData.slug);
             attributesList.push_back(attributeData);
         }
     }
@@ -395,6 +423,12 @@ MessageStruct
 JSONParser::parseMessage(const char *data, size_t length)
 {
     nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
+    return parseMessage(jsonData);
+}
+
+MessageStruct
+JSONParser::parseMessage(const nlohmann::json &jsonData)
+{
     MessageStruct message;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -416,6 +450,12 @@ std::string
 JSONParser::parseEventType(const char *data, size_t length)
 {
     nlohmann::json jsonData = nlohmann::json::parse(data, data + length);
+    return parseEventType(jsonData);
+}
+
+std::string
+JSONParser::parseEventType(const nlohmann::json &jsonData)
+{
     std::string eventType;
 
     if (jsonData.contains("header") && jsonData["header"].is_object() &&
@@ -740,6 +780,7 @@ JSONParser::parseMobsAttributesList(const char *data, size_t length)
             {
                 attributeData.value = attribute["value"].get<int>();
             }
+            attributeData.slugId = internSymbol(attributeData.slug);
             mobAttributesList.push_back(attributeData);
         }
     }
@@ -918,6 +959,13 @@ JSONParser::parseItemsList(const char *data, size_t length)
                     {
                         itemAttribute.value = attribute["value"].get<int>();
                     }
+                    if (attribute.contains("apply_on") && attribute["apply_on"].is_string())
+                    {
+                        itemAttribute.applyOn = attribute["apply_on"].get<std::string>() == "use"
+                                                    ? ItemAttributeApplyOn::USE
+                                                    : ItemAttributeApplyOn::EQUIP;
+                    }
+                    itemAttribute.slugId = internSymbol(itemAttribute.slug);
                     itemData.attributes.push_back(itemAttribute);
                 }
             }
@@ -1157,6 +1205,7 @@ JSONParser::parseMobsSkillsMapping(const char *data, size_t length)
                             }
                         }
 
+                        resolveSkillSymbols(skill);
                         skills.push_back(skill);
                     }
 
@@ -1828,6 +1877,7 @@ JSONParser::parsePlayerActiveEffects(const char *data, size_t length)
             // Schedule first tick immediately on load; non-tick effects: nextTickAt stays default
             if (eff.tickMs > 0)
                 eff.nextTickAt = std::chrono::steady_clock::now();
+            resolveEffectSymbols(eff);
             result.push_back(std::move(eff));
         }
     }
@@ -1896,6 +1946,7 @@ JSONParser::parseCharacterAttributesRefresh(const char *data, size_t length)
                     entry.slug = attr["slug"].get<std::string>();
                 if (attr.contains("value") && attr["value"].is_number_integer())
                     entry.value = attr["value"].get<int>();
+                entry.slugId = internSymbol(entry.slug);
                 result.second.push_back(std::move(entry));
             }
         }
@@ -0,0 +1,181 @@
+#include "utils/LaneExecutor.hpp"
+#include <stdexcept>
+
+namespace
+{
+// splitmix64 finalizer: sequential IDs (characterId, mobUID) spread evenly over lanes.
+uint64_t
+mixKey(uint64_t key)
+{
+    key ^= key >> 30;
+    key *= 0xbf58476d1ce4e5b9ULL;
+    key ^= key >> 27;
+    key *= 0x94d049bb133111ebULL;
+    key ^= key >> 31;
+    return key;
+}
+
+double
+elapsedMs(std::chrono::steady_clock::time_point from, std::chrono::steady_clock::time_point to)
+{
+    return std::chrono::duration<double, std::milli>(to - from).count();
+}
+} // namespace
+
+LaneExecutor::LaneExecutor(size_t laneCount, size_t maxTasksPerLane)
+    : maxTasksPerLane_(maxTasksPerLane)
+{
+    if (laneCount == 0)
+        laneCount = 1;
+
+    lanes_.reserve(laneCount);
+    for (size_t i = 0; i < laneCount; ++i)
+        lanes_.push_back(std::make_unique<Lane>());
+
+    for (auto &lane : lanes_)
+    {
+        Lane *lanePtr = lane.get();
+        lane->worker = std::thread([this, lanePtr]()
+            { runLane(*lanePtr); });
+    }
+}
+
+LaneExecutor::~LaneExecutor()
+{
+    stop_ = true;
+    for (auto &lane : lanes_)
+    {
+        // Lock/unlock so a worker between its predicate check and wait() cannot miss the wakeup.
+        {
+            std::lock_guard<std::mutex> lock(lane->mutex);
+        }
+        lane->condition.notify_all();
+        lane->notFull.notify_all();
+    }
+    for (auto &lane : lanes_)
+    {
+        if (lane->worker.joinable())
+            lane->worker.join();
+    }
+}
+
+size_t
+LaneExecutor::laneFor(uint64_t key) const
+{
+    return static_cast<size_t>(mixKey(key) % lanes_.size());
+}
+
+void
+LaneExecutor::enqueue(uint64_t key, std::function<void()> task)
+{
+    Lane &lane = *lanes_[laneFor(key)];
+    {
+        std::unique_lock<std::mutex> lock(lane.mutex);
+        if (!stop_ && lane.tasks.size() >= maxTasksPerLane_)
+        {
+            ++lane.blocked;
+            lane.notFull.wait(lock, [&]()
+                { return stop_ || lane.tasks.size() < maxTasksPerLane_; });
+        }
+        if (stop_)
+            throw std::runtime_error("enqueue on stopped LaneExecutor");
+
+        lane.tasks.push_back({std::move(task), Clock::now()});
+        if (lane.tasks.size() > lane.maxDepth)
+            lane.maxDepth = lane.tasks.size();
+    }
+    lane.condition.notify_one();
+}
+
+void
+LaneExecutor::runLane(Lane &lane)
+{
+    while (true)
+    {
+        Task task;
+        {
+            std::unique_lock<std::mutex> lock(lane.mutex);
+            lane.condition.wait(lock, [&]()
+                { return stop_ || !lane.tasks.empty(); });
+            if (stop_ && lane.tasks.empty())
+                return;
+            task = std::move(lane.tasks.front());
+            lane.tasks.pop_front();
+        }
+        lane.notFull.notify_one();
+
+        const auto startedAt = Clock::now();
+        bool ok = true;
+        try
+        {
+            task.fn();
+        }
+        catch (...)
+        {
+            // Callers log inside the task; a throw must not kill the lane.
+            ok = false;
+        }
+        const auto finishedAt = Clock::now();
+
+        const double waitMs = elapsedMs(task.enqueuedAt, startedAt);
+        const double runMs = elapsedMs(startedAt, finishedAt);
+
+        std::lock_guard<std::mutex> lock(lane.mutex);
+        ++lane.executed;
+        if (!ok)
+            ++lane.failed;
+        lane.waitSumMs += waitMs;
+        lane.runSumMs += runMs;
+        if (waitMs > lane.waitMaxMs)
+            lane.waitMaxMs = waitMs;
+        if (runMs > lane.runMaxMs)
+            lane.runMaxMs = runMs;
+    }
+}
+
+size_t
+LaneExecutor::getTaskQueueSize() const
+{
+    size_t total = 0;
+    for (const auto &lane : lanes_)
+    {
+        std::lock_guard<std::mutex> lock(lane->mutex);
+        total += lane->tasks.size();
+    }
+    return total;
+}
+
+std::vector<LaneStats>
+LaneExecutor::collectStats()
+{
+    std::vector<LaneStats> result;
+    result.reserve(lanes_.size());
+    for (auto &lane : lanes_)
+    {
+        std::lock_guard<std::mutex> lock(lane->mutex);
+        LaneStats stats;
+        stats.depth = lane->tasks.size();
+        stats.maxDepth = lane->maxDepth;
+        stats.executed = lane->executed;
+        stats.failed = lane->failed;
+        stats.blocked = lane->blocked;
+        if (lane->executed > 0)
+        {
+            stats.avgWaitMs = lane->waitSumMs / static_cast<double>(lane->executed);
+            stats.avgRunMs = lane->runSumMs / static_cast<double>(lane->executed);
+        }
+        stats.maxWaitMs = lane->waitMaxMs;
+        stats.maxRunMs = lane->runMaxMs;
+        result.push_back(stats);
+
+        lane->maxDepth = lane->tasks.size();
+        lane->executed = 0;
+        lane->failed = 0;
+        lane->blocked = 0;
+        lane->waitSumMs = 0.0;
+        lane->waitMaxMs = 0.0;
+        lane->runSumMs = 0.0;
+        lane->runMaxMs = 0.0;
+    }
+    return result;
+}
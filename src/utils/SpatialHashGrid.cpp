@@ -0,0 +1,75 @@
+#include "utils/SpatialHashGrid.hpp"
+
+SpatialHashGrid::SpatialHashGrid(float cellSize)
+    : cellSize_(cellSize > 0.0f ? cellSize : 1.0f)
+{
+}
+
+void
+SpatialHashGrid::update(int id, float x, float y)
+{
+    const int64_t key = packCell(cellCoord(x), cellCoord(y));
+    auto [slotIt, inserted] = slots_.try_emplace(id, key);
+
+    if (!inserted)
+    {
+        if (slotIt->second == key)
+        {
+            // Same cell: refresh the stored position in place.
+            for (auto &item : cells_[key])
+            {
+                if (item.id == id)
+                {
+                    item.x = x;
+                    item.y = y;
+                    return;
+                }
+            }
+        }
+        else
+        {
+            eraseFromCell(slotIt->second, id);
+            slotIt->second = key;
+        }
+    }
+
+    cells_[key].push_back({id, x, y});
+}
+
+void
+SpatialHashGrid::remove(int id)
+{
+    auto slotIt = slots_.find(id);
+    if (slotIt == slots_.end())
+        return;
+    eraseFromCell(slotIt->second, id);
+    slots_.erase(slotIt);
+}
+
+void
+SpatialHashGrid::clear()
+{
+    slots_.clear();
+    cells_.clear();
+}
+
+void
+SpatialHashGrid::eraseFromCell(int64_t key, int id)
+{
+    auto cellIt = cells_.find(key);
+    if (cellIt == cells_.end())
+        return;
+
+    auto &items = cellIt->second;
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+        if (items[i].id == id)
+        {
+            items[i] = items.back();
+            items.pop_back();
+            break;
+        }
+    }
+    if (items.empty())
+        cells_.erase(cellIt);
+}
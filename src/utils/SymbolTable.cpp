@@ -0,0 +1,64 @@
+#include "utils/SymbolTable.hpp"
+#include "data/StatSheet.hpp"
+#include <mutex>
+
+SymbolTable &
+SymbolTable::instance()
+{
+    static SymbolTable table;
+    return table;
+}
+
+SymbolTable::SymbolTable()
+{
+    names_.emplace_back();
+    ids_.emplace(std::string(), NO_SYMBOL);
+    // Order matters: statIdFromSymbol() relies on symbol == StatId + 1.
+    for (std::size_t i = 0; i < STAT_COUNT; ++i)
+    {
+        const std::string &slug = statSlug(static_cast<StatId>(i));
+        ids_.emplace(slug, static_cast<SymbolId>(names_.size()));
+        names_.push_back(slug);
+    }
+}
+
+SymbolId
+SymbolTable::intern(const std::string &slug)
+{
+    {
+        std::shared_lock<std::shared_mutex> lock(mutex_);
+        auto it = ids_.find(slug);
+        if (it != ids_.end())
+            return it->second;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    auto [it, inserted] = ids_.emplace(slug, static_cast<SymbolId>(names_.size()));
+    if (inserted)
+        names_.push_back(slug);
+    return it->second;
+}
+
+SymbolId
+SymbolTable::find(const std::string &slug) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    auto it = ids_.find(slug);
+    return it != ids_.end() ? it->second : NO_SYMBOL;
+}
+
+const std::string &
+SymbolTable::name(SymbolId id) const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    if (id >= names_.size())
+        return names_.front();
+    return names_[id];
+}
+
+size_t
+SymbolTable::size() const
+{
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return names_.size();
+}
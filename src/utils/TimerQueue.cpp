@@ -0,0 +1,160 @@
+#include "utils/TimerQueue.hpp"
+#include <algorithm>
+#include <exception>
+
+TimerQueue::TimerQueue()
+{
+    worker_ = std::thread([this]()
+        { run(); });
+}
+
+TimerQueue::~TimerQueue()
+{
+    stop();
+}
+
+TimerQueue::TimerId
+TimerQueue::scheduleAt(Clock::time_point when, std::function<void()> callback)
+{
+    TimerId id;
+    bool newEarliest;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        id = nextId_++;
+        newEarliest = heap_.empty() || when < heap_.top().when;
+        heap_.push({when, id});
+        callbacks_.emplace(id, std::move(callback));
+    }
+    // Only an earlier deadline changes how long the thread should sleep.
+    if (newEarliest)
+        wake_.notify_one();
+    return id;
+}
+
+TimerQueue::TimerId
+TimerQueue::scheduleAfter(std::chrono::milliseconds delay, std::function<void()> callback)
+{
+    return scheduleAt(Clock::now() + delay, std::move(callback));
+}
+
+bool
+TimerQueue::cancel(TimerId id)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return callbacks_.erase(id) > 0;
+}
+
+void
+TimerQueue::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    if (worker_.joinable() && worker_.get_id() != std::this_thread::get_id())
+        worker_.join();
+}
+
+void
+TimerQueue::run()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (!stop_)
+    {
+        if (heap_.empty())
+        {
+            wake_.wait(lock, [this]()
+                { return stop_ || !heap_.empty(); });
+            continue;
+        }
+
+        const Entry next = heap_.top();
+        if (Clock::now() < next.when)
+        {
+            // Woken early by an earlier timer or stop(); the loop re-reads the top.
+            wake_.wait_until(lock, next.when);
+            continue;
+        }
+
+        heap_.pop();
+        auto it = callbacks_.find(next.id);
+        if (it == callbacks_.end())
+            continue; // cancelled
+        auto callback = std::move(it->second);
+        callbacks_.erase(it);
+
+        lock.unlock();
+        const auto latency = Clock::now() - next.when;
+        bool failed = false;
+        try
+        {
+            callback();
+        }
+        catch (const std::exception &)
+        {
+            failed = true; // callers log their own errors; just count it
+        }
+        recordLatency(latency, failed);
+        lock.lock();
+    }
+}
+
+void
+TimerQueue::recordLatency(Clock::duration latency, bool failed)
+{
+    const int64_t latencyUs = std::chrono::duration_cast<std::chrono::microseconds>(latency).count();
+    const auto bound = std::lower_bound(LATENCY_BUCKET_US.begin(), LATENCY_BUCKET_US.end(), latencyUs);
+    const double latencyMs = static_cast<double>(latencyUs) / 1000.0;
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    ++buckets_[static_cast<size_t>(bound - LATENCY_BUCKET_US.begin())];
+    ++fired_;
+    if (failed)
+        ++failed_;
+    totalLatencyMs_ += latencyMs;
+    maxLatencyMs_ = std::max(maxLatencyMs_, latencyMs);
+}
+
+TimerLatencyStats
+TimerQueue::collectStats()
+{
+    TimerLatencyStats stats;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stats.pending = callbacks_.size();
+    }
+
+    std::lock_guard<std::mutex> lock(statsMutex_);
+    stats.fired = fired_;
+    stats.failed = failed_;
+    stats.avgMs = fired_ > 0 ? totalLatencyMs_ / static_cast<double>(fired_) : 0.0;
+    stats.maxMs = maxLatencyMs_;
+    stats.buckets.assign(buckets_.begin(), buckets_.end());
+
+    // Percentiles resolve to a bucket's upper bound; the overflow bucket reports the max.
+    auto percentileMs = [&](double fraction)
+    {
+        const uint64_t rank = static_cast<uint64_t>(fraction * static_cast<double>(fired_));
+        uint64_t seen = 0;
+        for (size_t i = 0; i < LATENCY_BUCKET_US.size(); ++i)
+        {
+            seen += buckets_[i];
+            if (seen > rank)
+                return static_cast<double>(LATENCY_BUCKET_US[i]) / 1000.0;
+        }
+        return maxLatencyMs_;
+    };
+    if (fired_ > 0)
+    {
+        stats.p50Ms = percentileMs(0.50);
+        stats.p99Ms = percentileMs(0.99);
+    }
+
+    buckets_.fill(0);
+    fired_ = 0;
+    failed_ = 0;
+    totalLatencyMs_ = 0.0;
+    maxLatencyMs_ = 0.0;
+    return stats;
+}
@@ -1,8 +1,8 @@
 #include "utils/TimestampUtils.hpp"
+#include <algorithm>
 #include <chrono>
+#include <cstdio>
 #include <ctime>
-#include <iomanip>
-#include <sstream>
 
 long long
 TimestampUtils::getCurrentTimestampMs()
@@ -17,13 +17,33 @@ TimestampUtils::getCurrentTimestampMs()
 std::string
 TimestampUtils::getCurrentTimestamp()
 {
+    char buf[TIMESTAMP_BUFFER_SIZE];
+    return std::string(buf, formatCurrentTimestamp(buf, sizeof(buf)));
+}
+
+size_t
+TimestampUtils::formatCurrentTimestamp(char *buf, size_t size)
+{
+    // "YYYY-MM-DD HH:MM:SS" for the last second seen on this thread
+    thread_local std::time_t cachedSecond = -1;
+    thread_local char cachedPrefix[24];
+    thread_local size_t cachedLength = 0;
+
     auto now = std::chrono::system_clock::now();
     auto ms = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()) % 1000;
     auto t = std::chrono::system_clock::to_time_t(now);
-    std::ostringstream ss;
-    ss << std::put_time(std::localtime(&t), "%Y-%m-%d %H:%M:%S");
-    ss << '.' << std::setfill('0') << std::setw(3) << ms.count();
-    return ss.str();
+    if (t != cachedSecond)
+    {
+        std::tm local{};
+        localtime_r(&t, &local);
+        cachedLength = std::strftime(cachedPrefix, sizeof(cachedPrefix), "%Y-%m-%d %H:%M:%S", &local);
+        cachedSecond = t;
+    }
+
+    int written = std::snprintf(buf, size, "%.*s.%03d", static_cast<int>(cachedLength), cachedPrefix, static_cast<int>(ms.count()));
+    if (written < 0)
+        return 0;
+    return std::min(static_cast<size_t>(written), size - 1);
 }
 
 TimestampStruct
@@ -0,0 +1,91 @@
+#pragma once
+
+#include <cmath>
+#include <cstdio>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Minimal test harness: TEST cases register themselves, CHECK records
+ * failures without aborting the case, runAll() returns the process exit code.
+ */
+namespace test
+{
+struct Case
+{
+    const char *name;
+    std::function<void()> fn;
+};
+
+inline std::vector<Case> &
+registry()
+{
+    static std::vector<Case> cases;
+    return cases;
+}
+
+inline int &
+failures()
+{
+    static int count = 0;
+    return count;
+}
+
+struct Registrar
+{
+    Registrar(const char *name, std::function<void()> fn)
+    {
+        registry().push_back({name, std::move(fn)});
+    }
+};
+
+inline void
+fail(const char *file, int line, const std::string &what)
+{
+    ++failures();
+    std::fprintf(stderr, "%s:%d: CHECK failed: %s\n", file, line, what.c_str());
+}
+
+inline int
+runAll()
+{
+    for (const auto &c : registry())
+    {
+        const int before = failures();
+        c.fn();
+        std::printf("[%s] %s\n", failures() == before ? " OK " : "FAIL", c.name);
+    }
+    std::printf("%zu case(s), %d failed check(s)\n", registry().size(), failures());
+    return failures() == 0 ? 0 : 1;
+}
+} // namespace test
+
+#define TEST_CONCAT_INNER(a, b) a##b
+#define TEST_CONCAT(a, b) TEST_CONCAT_INNER(a, b)
+
+#define TEST(name)                                                                  \
+    static void name();                                                             \
+    static test::Registrar TEST_CONCAT(registrar_, name)(#name, name);              \
+    static void name()
+
+#define CHECK(expr)                                       \
+    do                                                    \
+    {                                                     \
+        if (!(expr))                                      \
+            test::fail(__FILE__, __LINE__, #expr);        \
+    } while (0)
+
+#define CHECK_EQ(a, b)                                                               \
+    do                                                                               \
+    {                                                                                \
+        if (!((a) == (b)))                                                           \
+            test::fail(__FILE__, __LINE__, #a " == " #b);                            \
+    } while (0)
+
+#define CHECK_NEAR(a, b, eps)                                                        \
+    do                                                                               \
+    {                                                                                \
+        if (std::fabs(static_cast<double>(a) - static_cast<double>(b)) > (eps))      \
+            test::fail(__FILE__, __LINE__, #a " ~= " #b);                            \
+    } while (0)
@@ -0,0 +1,347 @@
+// BinaryCodec: frame peeking, moveCharacter round trip and the server → client
+// layouts decoded field by field as a client would.
+
+#include "TestCommon.hpp"
+#include "network/BinaryCodec.hpp"
+#include <cstring>
+
+namespace
+{
+/// Little-endian reader mirroring the documented payload layouts.
+class Reader
+{
+  public:
+    explicit Reader(const std::string &frame, size_t offset = BinaryCodec::FRAME_HEADER_SIZE)
+        : data_(frame), pos_(offset)
+    {
+    }
+
+    uint8_t u8()
+    {
+        return static_cast<uint8_t>(data_.at(pos_++));
+    }
+
+    uint16_t u16()
+    {
+        uint16_t v = u8();
+        v |= static_cast<uint16_t>(u8()) << 8;
+        return v;
+    }
+
+    uint32_t u32()
+    {
+        uint32_t v = 0;
+        for (int i = 0; i < 4; ++i)
+            v |= static_cast<uint32_t>(u8()) << (8 * i);
+        return v;
+    }
+
+    int32_t i32()
+    {
+        return static_cast<int32_t>(u32());
+    }
+
+    int64_t i64()
+    {
+        uint64_t v = 0;
+        for (int i = 0; i < 8; ++i)
+            v |= static_cast<uint64_t>(u8()) << (8 * i);
+        return static_cast<int64_t>(v);
+    }
+
+    float f32()
+    {
+        const uint32_t bits = u32();
+        float v;
+        std::memcpy(&v, &bits, sizeof(v));
+        return v;
+    }
+
+    std::string shortString()
+    {
+        const size_t len = u8();
+        std::string s = data_.substr(pos_, len);
+        pos_ += len;
+        return s;
+    }
+
+    size_t pos() const
+    {
+        return pos_;
+    }
+
+  private:
+    const std::string &data_;
+    size_t pos_;
+};
+
+BinaryFrameHeader
+readyHeader(const std::string &frame)
+{
+    BinaryFrameHeader header;
+    CHECK(BinaryCodec::peekFrame(frame.data(), frame.size(), 8192, header) == BinaryCodec::PeekResult::READY);
+    CHECK_EQ(header.payloadLength + BinaryCodec::FRAME_HEADER_SIZE, frame.size());
+    return header;
+}
+
+MobMoveUpdateStruct
+makeMob(int uid, bool waypoint)
+{
+    MobMoveUpdateStruct mob;
+    mob.uid = uid;
+    mob.zoneId = 3;
+    mob.position = {10.5f * uid, -4.25f, 1.0f, 0.5f};
+    mob.dirX = 0.6f;
+    mob.dirY = -0.8f;
+    mob.speed = 120.0f;
+    mob.combatState = 2;
+    mob.stepTimestampMs = 1760000000000LL + uid;
+    mob.hasWaypoint = waypoint;
+    mob.waypointX = 300.0f;
+    mob.waypointY = -150.0f;
+    return mob;
+}
+
+void
+checkMobRecord(Reader &r, const MobMoveUpdateStruct &mob)
+{
+    CHECK_EQ(r.i32(), mob.uid);
+    CHECK_EQ(r.i32(), mob.zoneId);
+    CHECK_EQ(r.f32(), mob.position.positionX);
+    CHECK_EQ(r.f32(), mob.position.positionY);
+    CHECK_EQ(r.f32(), mob.position.positionZ);
+    CHECK_EQ(r.f32(), mob.position.rotationZ);
+    CHECK_EQ(r.f32(), mob.dirX);
+    CHECK_EQ(r.f32(), mob.dirY);
+    CHECK_EQ(r.f32(), mob.speed);
+    CHECK_EQ(r.u8(), mob.combatState);
+    CHECK_EQ(r.u8(), mob.hasWaypoint ? 1 : 0);
+    CHECK_EQ(r.i64(), mob.stepTimestampMs);
+    if (mob.hasWaypoint)
+    {
+        CHECK_EQ(r.f32(), mob.waypointX);
+        CHECK_EQ(r.f32(), mob.waypointY);
+    }
+}
+} // namespace
+
+TEST(moveCharacterRoundTrip)
+{
+    MovementDataStruct in;
+    in.characterId = 77;
+    in.position = {143.5f, 88.25f, -2.0f, 1.57f};
+    in.isFalling = true;
+    const long long clientSendMs = 1760000123456LL;
+
+    const std::string frame = BinaryCodec::encodeMoveCharacter(in, clientSendMs);
+    CHECK_EQ(frame.size(), BinaryCodec::FRAME_HEADER_SIZE + 29);
+    const BinaryFrameHeader header = readyHeader(frame);
+    CHECK(header.type == BinaryMessageType::MOVE_CHARACTER);
+
+    MovementDataStruct out;
+    long long decodedSendMs = 0;
+    CHECK(BinaryCodec::decodeMoveCharacter(frame.data() + BinaryCodec::FRAME_HEADER_SIZE, header.payloadLength, out, decodedSendMs));
+    CHECK_EQ(out.characterId, in.characterId);
+    CHECK_EQ(out.position.positionX, in.position.positionX);
+    CHECK_EQ(out.position.positionY, in.position.positionY);
+    CHECK_EQ(out.position.positionZ, in.position.positionZ);
+    CHECK_EQ(out.position.rotationZ, in.position.rotationZ);
+    CHECK_EQ(out.isFalling, true);
+    CHECK_EQ(decodedSendMs, clientSendMs);
+}
+
+TEST(moveCharacterTruncatedPayloadIsRejected)
+{
+    MovementDataStruct in;
+    in.characterId = 5;
+    const std::string frame = BinaryCodec::encodeMoveCharacter(in, 1);
+
+    MovementDataStruct out;
+    long long sendMs = 0;
+    for (size_t length = 0; length < 29; ++length)
+        CHECK(!BinaryCodec::decodeMoveCharacter(frame.data() + BinaryCodec::FRAME_HEADER_SIZE, length, out, sendMs));
+}
+
+TEST(peekFrameHandlesPartialAndInvalidInput)
+{
+    MovementDataStruct in;
+    const std::string frame = BinaryCodec::encodeMoveCharacter(in, 0);
+    BinaryFrameHeader header;
+
+    // Every strict prefix is incomplete, including a partial header
+    for (size_t length = 0; length < frame.size(); ++length)
+        CHECK(BinaryCodec::peekFrame(frame.data(), length, 8192, header) == BinaryCodec::PeekResult::INCOMPLETE);
+
+    // Trailing bytes of the next frame do not matter
+    const std::string twoFrames = frame + frame.substr(0, 3);
+    CHECK(BinaryCodec::peekFrame(twoFrames.data(), twoFrames.size(), 8192, header) == BinaryCodec::PeekResult::READY);
+    CHECK_EQ(header.payloadLength, 29u);
+
+    std::string badMagic = frame;
+    badMagic[0] = '{';
+    CHECK(BinaryCodec::peekFrame(badMagic.data(), badMagic.size(), 8192, header) == BinaryCodec::PeekResult::INVALID);
+
+    // Oversized payloads are rejected from the header alone, before the body arrives
+    CHECK(BinaryCodec::peekFrame(frame.data(), BinaryCodec::FRAME_HEADER_SIZE, 28, header) == BinaryCodec::PeekResult::INVALID);
+}
+
+TEST(characterMovedLayout)
+{
+    MovementDataStruct movement;
+    movement.characterId = 9;
+    movement.position = {1.0f, 2.0f, 3.0f, 4.0f};
+    TimestampStruct timestamps;
+    timestamps.serverRecvMs = 100;
+    timestamps.serverSendMs = 200;
+    timestamps.clientSendMsEcho = 50;
+
+    const std::string frame = BinaryCodec::encodeCharacterMoved(42, movement, timestamps);
+    const BinaryFrameHeader header = readyHeader(frame);
+    CHECK(header.type == BinaryMessageType::CHARACTER_MOVED);
+    CHECK_EQ(header.payloadLength, 49u);
+
+    Reader r(frame);
+    CHECK_EQ(r.i32(), 42);
+    CHECK_EQ(r.i32(), 9);
+    CHECK_EQ(r.f32(), 1.0f);
+    CHECK_EQ(r.f32(), 2.0f);
+    CHECK_EQ(r.f32(), 3.0f);
+    CHECK_EQ(r.f32(), 4.0f);
+    CHECK_EQ(r.u8(), 0);
+    CHECK_EQ(r.i64(), 100);
+    CHECK_EQ(r.i64(), 200);
+    CHECK_EQ(r.i64(), 50);
+    CHECK_EQ(r.pos(), frame.size());
+}
+
+TEST(mobMoveUpdateLayoutAndOffsets)
+{
+    const std::vector<MobMoveUpdateStruct> mobs = {makeMob(1, false), makeMob(2, true), makeMob(3, false)};
+    std::vector<uint32_t> offsets;
+    const std::string frame = BinaryCodec::encodeMobMoveUpdate(mobs, 1234, &offsets);
+    const BinaryFrameHeader header = readyHeader(frame);
+    CHECK(header.type == BinaryMessageType::MOB_MOVE_UPDATE);
+    CHECK_EQ(offsets.size(), mobs.size() + 1);
+    CHECK_EQ(offsets.back(), frame.size());
+
+    Reader r(frame);
+    CHECK_EQ(r.i64(), 1234);
+    CHECK_EQ(r.u16(), 3);
+    for (size_t i = 0; i < mobs.size(); ++i)
+    {
+        CHECK_EQ(r.pos(), offsets[i]);
+        checkMobRecord(r, mobs[i]);
+    }
+    CHECK_EQ(r.pos(), frame.size());
+}
+
+TEST(assembleMobMoveUpdateSubsetMatchesDirectEncode)
+{
+    const std::vector<MobMoveUpdateStruct> mobs = {makeMob(1, true), makeMob(2, false), makeMob(3, true), makeMob(4, false)};
+    MobMoveFragmentsStruct fragments;
+    fragments.binaryFrame = BinaryCodec::encodeMobMoveUpdate(mobs, 0, &fragments.binaryOffsets);
+    fragments.jsonOffsets.assign(mobs.size() + 1, 0); // count() only
+
+    // Whole tick: the shared frame, stamped with the send time
+    auto all = BinaryCodec::assembleMobMoveUpdate(fragments, {0, 1, 2, 3}, 999);
+    CHECK(*all == BinaryCodec::encodeMobMoveUpdate(mobs, 999));
+
+    // Subset: byte-identical to encoding just those mobs
+    auto subset = BinaryCodec::assembleMobMoveUpdate(fragments, {2, 0}, 999);
+    const std::string expected = BinaryCodec::encodeMobMoveUpdate({mobs[2], mobs[0]}, 999);
+    CHECK(*subset == expected);
+
+    // Out-of-range indices are skipped
+    auto empty = BinaryCodec::assembleMobMoveUpdate(fragments, {17}, 999);
+    Reader r(*empty);
+    CHECK_EQ(r.i64(), 999);
+    CHECK_EQ(r.u16(), 0);
+}
+
+TEST(combatResultFromJson)
+{
+    nlohmann::json packet;
+    packet["header"]["eventType"] = "combatResult";
+    packet["body"]["skillResult"] = {{"success", true}, {"casterId", 11}, {"targetId", 1200}, {"casterType", 1},
+        {"targetType", 2}, {"isCritical", true}, {"targetDied", true}, {"damage", 345}, {"finalTargetHealth", 0},
+        {"finalTargetMana", 10}, {"finalCasterMana", 55}, {"serverTimestamp", 1760000000001LL}, {"skillSlug", "fireball"}};
+
+    auto frame = BinaryCodec::encodeFromJson(packet);
+    CHECK(frame != nullptr);
+    if (!frame)
+        return;
+    const BinaryFrameHeader header = readyHeader(*frame);
+    CHECK(header.type == BinaryMessageType::COMBAT_RESULT);
+
+    Reader r(*frame);
+    CHECK_EQ(r.i32(), 11);
+    CHECK_EQ(r.i32(), 1200);
+    CHECK_EQ(r.u8(), 1);
+    CHECK_EQ(r.u8(), 2);
+    CHECK_EQ(r.u8(), 0x01 | 0x08);
+    CHECK_EQ(r.i32(), 345);
+    CHECK_EQ(r.i32(), 0);
+    CHECK_EQ(r.i32(), 10);
+    CHECK_EQ(r.i32(), 55);
+    CHECK_EQ(r.i64(), 1760000000001LL);
+    CHECK_EQ(r.shortString(), "fireball");
+    CHECK_EQ(r.pos(), frame->size());
+
+    // Failed casts carry an error payload and stay JSON
+    packet["body"]["skillResult"]["success"] = false;
+    CHECK(BinaryCodec::encodeFromJson(packet) == nullptr);
+}
+
+TEST(effectTickAndVitalsFromJson)
+{
+    nlohmann::json tick;
+    tick["header"]["eventType"] = "effectTick";
+    tick["body"] = {{"characterId", 4}, {"value", 12.5}, {"newHealth", 80}, {"newMana", 20},
+        {"effectTypeSlug", "hot"}, {"effectSlug", "rejuvenation"}};
+    auto tickFrame = BinaryCodec::encodeFromJson(tick);
+    CHECK(tickFrame != nullptr);
+    if (tickFrame)
+    {
+        CHECK(readyHeader(*tickFrame).type == BinaryMessageType::EFFECT_TICK);
+        Reader r(*tickFrame);
+        CHECK_EQ(r.i32(), 4);
+        CHECK_NEAR(r.f32(), 12.5, 1e-6);
+        CHECK_EQ(r.i32(), 80);
+        CHECK_EQ(r.i32(), 20);
+        CHECK_EQ(r.u8(), 0x02);
+        CHECK_EQ(r.shortString(), "rejuvenation");
+    }
+
+    nlohmann::json vitals;
+    vitals["header"]["eventType"] = "stats_update";
+    vitals["body"] = {{"source", "regen"}, {"characterId", 4}, {"health", {{"current", 90}, {"max", 100}}},
+        {"mana", {{"current", 30}, {"max", 50}}}};
+    auto vitalsFrame = BinaryCodec::encodeFromJson(vitals);
+    CHECK(vitalsFrame != nullptr);
+    if (vitalsFrame)
+    {
+        CHECK(readyHeader(*vitalsFrame).type == BinaryMessageType::VITALS_UPDATE);
+        Reader r(*vitalsFrame);
+        CHECK_EQ(r.i32(), 4);
+        CHECK_EQ(r.i32(), 90);
+        CHECK_EQ(r.i32(), 100);
+        CHECK_EQ(r.i32(), 30);
+        CHECK_EQ(r.i32(), 50);
+        CHECK_EQ(r.pos(), vitalsFrame->size());
+    }
+
+    // Non-regen stat updates carry the full sheet and stay JSON
+    vitals["body"]["source"] = "equipment";
+    CHECK(BinaryCodec::encodeFromJson(vitals) == nullptr);
+
+    nlohmann::json chat;
+    chat["header"]["eventType"] = "chatMessage";
+    chat["body"] = nlohmann::json::object();
+    CHECK(BinaryCodec::encodeFromJson(chat) == nullptr);
+}
+
+int
+main()
+{
+    return test::runAll();
+}
@@ -0,0 +1,251 @@
+// EventQueue: exactly-once delivery under multi-producer/multi-consumer load,
+// the RING overflow policies' dropped counts, and stop() releasing parked
+// consumers and BLOCK producers.
+
+#include "TestCommon.hpp"
+#include "events/EventQueue.hpp"
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+namespace
+{
+/// Events carry their sequence number in clientID.
+Event
+numbered(int id)
+{
+    return Event(Event::PING_CLIENT, id, 0);
+}
+
+std::vector<int>
+drain(EventQueue &queue)
+{
+    std::vector<int> ids;
+    std::vector<Event> batch;
+    while (!queue.empty())
+    {
+        batch.clear();
+        if (!queue.popBatch(batch, 64))
+            break;
+        for (const auto &event : batch)
+            ids.push_back(event.getClientID());
+    }
+    return ids;
+}
+
+/// Producers push disjoint id ranges, consumers record what they pop; returns per-id counts.
+std::vector<int>
+runProducersConsumers(EventQueue &queue, int producers, int consumers, int perProducer)
+{
+    const int total = producers * perProducer;
+    std::vector<std::atomic<int>> seen(static_cast<size_t>(total));
+
+    std::vector<std::thread> consumerThreads;
+    for (int c = 0; c < consumers; ++c)
+    {
+        consumerThreads.emplace_back([&, c]
+            {
+                std::vector<Event> batch;
+                Event single;
+                // Half the consumers use pop(), half popBatch(), to cover both paths
+                if (c % 2 == 0)
+                {
+                    while (queue.pop(single))
+                        seen[static_cast<size_t>(single.getClientID())].fetch_add(1);
+                    return;
+                }
+                while (queue.popBatch(batch, 32))
+                {
+                    for (const auto &event : batch)
+                        seen[static_cast<size_t>(event.getClientID())].fetch_add(1);
+                    batch.clear();
+                } });
+    }
+
+    std::vector<std::thread> producerThreads;
+    for (int p = 0; p < producers; ++p)
+    {
+        producerThreads.emplace_back([&, p]
+            {
+                const int first = p * perProducer;
+                std::vector<Event> batch;
+                for (int i = 0; i < perProducer; ++i)
+                {
+                    // Mix single pushes with small move batches
+                    if (i % 3 == 0)
+                    {
+                        queue.push(numbered(first + i));
+                        continue;
+                    }
+                    batch.push_back(numbered(first + i));
+                    if (batch.size() == 8)
+                    {
+                        queue.pushBatch(std::move(batch));
+                        batch.clear();
+                    }
+                }
+                if (!batch.empty())
+                    queue.pushBatch(std::move(batch)); });
+    }
+
+    for (auto &t : producerThreads)
+        t.join();
+    // stop() lets consumers drain what is left before pop() returns false
+    queue.stop();
+    for (auto &t : consumerThreads)
+        t.join();
+
+    std::vector<int> counts;
+    counts.reserve(seen.size());
+    for (const auto &n : seen)
+        counts.push_back(n.load());
+    return counts;
+}
+
+bool
+allExactlyOnce(const std::vector<int> &counts)
+{
+    for (int n : counts)
+        if (n != 1)
+            return false;
+    return true;
+}
+} // namespace
+
+TEST(ring_block_delivers_every_event_exactly_once)
+{
+    // A small ring so producers hit the full path and park constantly
+    EventQueue queue(64, EventQueueBackend::RING, EventQueueOverflowPolicy::BLOCK);
+    const auto counts = runProducersConsumers(queue, 4, 4, 20000);
+    CHECK(allExactlyOnce(counts));
+    CHECK_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(ring_without_overflow_delivers_every_event_exactly_once)
+{
+    EventQueue queue(1 << 17, EventQueueBackend::RING, EventQueueOverflowPolicy::DROP_OLDEST);
+    const auto counts = runProducersConsumers(queue, 4, 3, 20000);
+    CHECK(allExactlyOnce(counts));
+    CHECK_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(mutex_backend_delivers_every_event_exactly_once)
+{
+    EventQueue queue(1 << 17, EventQueueBackend::MUTEX);
+    const auto counts = runProducersConsumers(queue, 4, 3, 20000);
+    CHECK(allExactlyOnce(counts));
+    CHECK_EQ(queue.getDroppedCount(), 0u);
+}
+
+TEST(ring_drop_oldest_keeps_newest_and_counts_drops)
+{
+    EventQueue queue(8, EventQueueBackend::RING, EventQueueOverflowPolicy::DROP_OLDEST);
+    for (int i = 0; i < 20; ++i)
+        queue.push(numbered(i));
+
+    CHECK_EQ(queue.getDroppedCount(), 12u);
+    CHECK_EQ(queue.getDroppedCount(), 0u); // reset on read
+    const auto ids = drain(queue);
+    CHECK_EQ(ids.size(), 8u);
+    for (size_t i = 0; i < ids.size(); ++i)
+        CHECK_EQ(ids[i], static_cast<int>(12 + i));
+}
+
+TEST(ring_reject_keeps_oldest_and_counts_rejections)
+{
+    EventQueue queue(8, EventQueueBackend::RING, EventQueueOverflowPolicy::REJECT);
+    std::vector<Event> batch;
+    for (int i = 0; i < 20; ++i)
+        batch.push_back(numbered(i));
+    queue.pushBatch(std::move(batch));
+
+    CHECK_EQ(queue.getDroppedCount(), 12u);
+    const auto ids = drain(queue);
+    CHECK_EQ(ids.size(), 8u);
+    for (size_t i = 0; i < ids.size(); ++i)
+        CHECK_EQ(ids[i], static_cast<int>(i));
+}
+
+TEST(stop_releases_blocked_consumers)
+{
+    for (auto backend : {EventQueueBackend::MUTEX, EventQueueBackend::RING})
+    {
+        EventQueue queue(16, backend);
+        std::atomic<int> returnedFalse{0};
+        std::vector<std::thread> consumers;
+        for (int c = 0; c < 3; ++c)
+        {
+            consumers.emplace_back([&, c]
+                {
+                    Event event;
+                    std::vector<Event> batch;
+                    const bool got = c == 0 ? queue.pop(event) : queue.popBatch(batch, 8);
+                    if (!got)
+                        returnedFalse.fetch_add(1); });
+        }
+
+        std::this_thread::sleep_for(std::chrono::milliseconds(50));
+        queue.stop();
+        for (auto &t : consumers)
+            t.join();
+        CHECK_EQ(returnedFalse.load(), 3);
+        CHECK(queue.isStopped());
+    }
+}
+
+TEST(stop_releases_blocked_producer)
+{
+    EventQueue queue(2, EventQueueBackend::RING, EventQueueOverflowPolicy::BLOCK);
+    queue.push(numbered(0));
+    queue.push(numbered(1));
+
+    std::atomic<bool> returned{false};
+    std::thread producer([&]
+        {
+            queue.push(numbered(2)); // ring full: parks until stop()
+            returned.store(true); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    CHECK(!returned.load());
+    queue.stop();
+    producer.join();
+    CHECK(returned.load());
+    CHECK_EQ(queue.getDroppedCount(), 1u);
+
+    // The events already queued are still delivered after stop()
+    CHECK_EQ(drain(queue).size(), 2u);
+}
+
+TEST(block_producer_resumes_when_a_slot_frees)
+{
+    EventQueue queue(2, EventQueueBackend::RING, EventQueueOverflowPolicy::BLOCK);
+    queue.push(numbered(0));
+    queue.push(numbered(1));
+
+    std::atomic<bool> returned{false};
+    std::thread producer([&]
+        {
+            queue.push(numbered(2));
+            returned.store(true); });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    Event event;
+    CHECK(queue.pop(event));
+    CHECK_EQ(event.getClientID(), 0);
+    producer.join();
+    CHECK(returned.load());
+    CHECK_EQ(queue.getDroppedCount(), 0u);
+    const auto ids = drain(queue);
+    CHECK_EQ(ids.size(), 2u);
+    if (ids.size() == 2)
+    {
+        CHECK_EQ(ids[0], 1);
+        CHECK_EQ(ids[1], 2);
+    }
+}
+
+int
+main()
+{
+    return test::runAll();
+}
@@ -0,0 +1,259 @@
+// PersistenceJournal: keyed coalescing, unchanged-row suppression, play-time
+// summing, per-character flushes and back-pressure deferral, observed through
+// the packets handed to the send callback.
+
+#include "TestCommon.hpp"
+#include "services/PersistenceJournal.hpp"
+#include <nlohmann/json.hpp>
+#include <sstream>
+#include <utility>
+
+namespace
+{
+Logger &
+testLogger()
+{
+    static Logger logger("test_persistence_journal");
+    return logger;
+}
+
+/// Journal wired to an in-memory send callback that splits batches back into packets.
+struct Harness
+{
+    PersistenceJournal journal{testLogger()};
+    std::vector<nlohmann::json> sent;
+    size_t queueDepth = 0;
+
+    Harness()
+    {
+        journal.setSendCallback([this](const std::string &batch)
+            {
+                std::istringstream lines(batch);
+                std::string line;
+                while (std::getline(lines, line))
+                    sent.push_back(nlohmann::json::parse(line));
+            });
+        journal.setQueueDepthProvider([this]
+            { return queueDepth; });
+    }
+
+    std::vector<nlohmann::json> take()
+    {
+        return std::exchange(sent, {});
+    }
+};
+
+std::string
+keyedPacket(const std::string &eventType, int value)
+{
+    nlohmann::json packet;
+    packet["header"]["eventType"] = eventType;
+    packet["body"]["value"] = value;
+    return packet.dump() + "\n";
+}
+
+PositionStruct
+position(float x, float y)
+{
+    PositionStruct pos;
+    pos.positionX = x;
+    pos.positionY = y;
+    return pos;
+}
+
+const nlohmann::json *
+findEvent(const std::vector<nlohmann::json> &packets, const std::string &eventType)
+{
+    for (const auto &p : packets)
+        if (p["header"]["eventType"] == eventType)
+            return &p;
+    return nullptr;
+}
+} // namespace
+
+TEST(keyed_write_replaces_value_and_keeps_first_position)
+{
+    Harness h;
+    h.journal.stage(1, "durability:10", keyedPacket("a", 1));
+    h.journal.stage(1, "flag:1:intro", keyedPacket("b", 1));
+    h.journal.stage(1, "durability:10", keyedPacket("a", 2));
+
+    CHECK_EQ(h.journal.flush(), 2u);
+    auto sent = h.take();
+    CHECK_EQ(sent.size(), 2u);
+    if (sent.size() == 2)
+    {
+        // The replacement carries the newest value but stays ahead of "b"
+        CHECK_EQ(sent[0]["header"]["eventType"], "a");
+        CHECK_EQ(sent[0]["body"]["value"], 2);
+        CHECK_EQ(sent[1]["header"]["eventType"], "b");
+    }
+
+    const auto stats = h.journal.getStats();
+    CHECK_EQ(stats.staged, 3u);
+    CHECK_EQ(stats.coalesced, 1u);
+}
+
+TEST(unchanged_position_and_hp_rows_are_dropped)
+{
+    Harness h;
+    h.journal.stagePosition(1, position(10.0f, 20.0f));
+    h.journal.stageHpMana(1, 100, 50);
+    h.journal.flush();
+    CHECK_EQ(h.take().size(), 2u);
+
+    // Same rows as the last flush: nothing to send
+    h.journal.stagePosition(1, position(10.0f, 20.0f));
+    h.journal.stageHpMana(1, 100, 50);
+    CHECK_EQ(h.journal.flush(), 0u);
+    CHECK(h.take().empty());
+    CHECK_EQ(h.journal.getStats().unchanged, 2u);
+
+    // A change that is reverted before the flush cancels the pending row
+    h.journal.stagePosition(1, position(11.0f, 20.0f));
+    h.journal.stagePosition(1, position(10.0f, 20.0f));
+    CHECK_EQ(h.journal.flush(), 0u);
+
+    // Changed rows are batched, one packet per kind
+    h.journal.stagePosition(1, position(12.0f, 20.0f));
+    h.journal.stagePosition(2, position(1.0f, 2.0f));
+    h.journal.stageHpMana(1, 90, 50);
+    CHECK_EQ(h.journal.flush(), 2u);
+    auto sent = h.take();
+    const nlohmann::json *positions = findEvent(sent, "savePositions");
+    const nlohmann::json *hpMana = findEvent(sent, "saveHpMana");
+    CHECK(positions != nullptr);
+    CHECK(hpMana != nullptr);
+    if (positions)
+        CHECK_EQ((*positions)["body"]["characters"].size(), 2u);
+    if (hpMana)
+    {
+        CHECK_EQ((*hpMana)["body"]["characters"].size(), 1u);
+        CHECK_EQ((*hpMana)["body"]["characters"][0]["currentHp"], 90);
+    }
+}
+
+TEST(play_time_deltas_are_summed)
+{
+    Harness h;
+    h.journal.stagePlayTime(7, 30);
+    h.journal.stagePlayTime(7, 45);
+    h.journal.stagePlayTime(7, 0); // ignored
+    h.journal.stagePlayTime(8, 5);
+
+    CHECK_EQ(h.journal.flush(), 2u);
+    auto sent = h.take();
+    int64_t seven = -1, eight = -1;
+    for (const auto &p : sent)
+    {
+        CHECK_EQ(p["header"]["eventType"], "savePlayTime");
+        if (p["body"]["characterId"] == 7)
+            seven = p["body"]["sessionPlayTimeSec"].get<int64_t>();
+        else if (p["body"]["characterId"] == 8)
+            eight = p["body"]["sessionPlayTimeSec"].get<int64_t>();
+    }
+    CHECK_EQ(seven, 75);
+    CHECK_EQ(eight, 5);
+
+    // The sum restarts after a flush
+    h.journal.stagePlayTime(7, 10);
+    h.journal.flush();
+    sent = h.take();
+    CHECK_EQ(sent.size(), 1u);
+    if (!sent.empty())
+        CHECK_EQ(sent[0]["body"]["sessionPlayTimeSec"], 10);
+}
+
+TEST(flush_character_takes_only_that_character)
+{
+    Harness h;
+    h.journal.stage(1, "quest:1:5", keyedPacket("q1", 1));
+    h.journal.stage(2, "quest:2:5", keyedPacket("q2", 1));
+    h.journal.stage(1, "title:1", keyedPacket("t1", 1));
+    h.journal.stagePosition(1, position(1.0f, 1.0f));
+    h.journal.stagePosition(2, position(2.0f, 2.0f));
+    h.journal.stagePlayTime(2, 60);
+
+    h.journal.flushCharacter(1);
+    auto sent = h.take();
+    CHECK_EQ(sent.size(), 3u);
+    CHECK(findEvent(sent, "q1") != nullptr);
+    CHECK(findEvent(sent, "t1") != nullptr);
+    CHECK(findEvent(sent, "q2") == nullptr);
+    CHECK(findEvent(sent, "savePlayTime") == nullptr);
+    if (const nlohmann::json *positions = findEvent(sent, "savePositions"))
+    {
+        CHECK_EQ((*positions)["body"]["characters"].size(), 1u);
+        CHECK_EQ((*positions)["body"]["characters"][0]["characterId"], 1);
+    }
+    else
+        CHECK(false);
+
+    // Character 2's writes are still pending, and its key still coalesces
+    h.journal.stage(2, "quest:2:5", keyedPacket("q2", 2));
+    CHECK_EQ(h.journal.flush(), 3u);
+    sent = h.take();
+    const nlohmann::json *q2 = findEvent(sent, "q2");
+    CHECK(q2 != nullptr);
+    if (q2)
+        CHECK_EQ((*q2)["body"]["value"], 2);
+    CHECK(findEvent(sent, "savePlayTime") != nullptr);
+    CHECK(findEvent(sent, "savePositions") != nullptr);
+
+    // flushCharacter drops the baselines: the same row is sent again next session
+    h.journal.stagePosition(1, position(1.0f, 1.0f));
+    CHECK_EQ(h.journal.flush(), 1u);
+}
+
+TEST(flush_is_deferred_above_high_water)
+{
+    Harness h;
+    h.journal.setLimits(4, 64 * 1024);
+    h.journal.stage(1, "durability:1", keyedPacket("d", 1));
+
+    h.queueDepth = 5;
+    CHECK_EQ(h.journal.flush(), 0u);
+    CHECK(h.take().empty());
+    CHECK_EQ(h.journal.getStats().deferredFlushes, 1u);
+
+    // Writes keep coalescing while deferred
+    h.journal.stage(1, "durability:1", keyedPacket("d", 2));
+
+    // flushCharacter and forced flushes ignore back-pressure
+    h.journal.stage(2, "durability:2", keyedPacket("e", 1));
+    h.journal.flushCharacter(2);
+    CHECK_EQ(h.take().size(), 1u);
+    CHECK_EQ(h.journal.flush(true), 1u);
+    auto sent = h.take();
+    CHECK_EQ(sent.size(), 1u);
+    if (!sent.empty())
+        CHECK_EQ(sent[0]["body"]["value"], 2);
+
+    // At the mark (not above it) a regular flush goes through
+    h.journal.stage(1, "durability:1", keyedPacket("d", 3));
+    h.queueDepth = 4;
+    CHECK_EQ(h.journal.flush(), 1u);
+    CHECK_EQ(h.journal.getStats().deferredFlushes, 1u);
+}
+
+TEST(packets_are_split_into_batches_by_size)
+{
+    Harness h;
+    size_t batches = 0;
+    h.journal.setSendCallback([&](const std::string &)
+        { ++batches; });
+    const std::string packet = keyedPacket("x", 1);
+    h.journal.setLimits(256, packet.size() * 2);
+    for (int i = 0; i < 5; ++i)
+        h.journal.stage(1, "k" + std::to_string(i), packet);
+
+    CHECK_EQ(h.journal.flush(), 5u);
+    CHECK_EQ(batches, 3u);
+    CHECK_EQ(h.journal.getStats().batchesSent, 3u);
+}
+
+int
+main()
+{
+    return test::runAll();
+}